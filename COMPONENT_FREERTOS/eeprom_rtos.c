@@ -0,0 +1,324 @@
+/******************************************************************************
+* File Name: eeprom_rtos.c
+*
+* Description: This file contains the FreeRTOS access layer. Reads are served
+*              from a RAM image of the committed EEPROM content, guarded by a
+*              sequence counter instead of a mutex, so they never wait for a
+*              flash operation. Writes are queued to one writer task, which
+*              programs the flash and then publishes the new content to the
+*              image. This directory is only built with COMPONENTS+=FREERTOS.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdbool.h>
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_io.h"
+#include "eeprom_status.h"
+#include "eeprom_rtos.h"
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Write request, on the stack of the requesting task until it is notified. */
+typedef struct
+{
+    uint32_t addr;
+    const void *data;
+    uint32_t size;
+    TaskHandle_t requester;
+    /* Set by the writer task once it no longer uses the request. */
+    volatile cy_en_em_eeprom_status_t status;
+    volatile bool done;
+} rtos_request_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void rtos_writer_task(void *arg);
+static void rtos_publish(eeprom_rtos_t *rtos, uint32_t addr, const void *data, uint32_t size);
+
+
+/*******************************************************************************
+* Function Name: eeprom_rtos_init
+********************************************************************************
+*
+* Summary:
+* Fills the image from the EEPROM and creates the write queue. Call it before
+* the scheduler starts or before any task uses the instance.
+*
+* Parameters:
+* eeprom_rtos_t *rtos: access layer instance.
+* cy_stc_eeprom_context_t *context: Em_EEPROM instance. Only the writer task
+*  accesses it after eeprom_rtos_start().
+* uint32_t base: logical address of the first byte of the image.
+* uint8_t *image: RAM image of size bytes.
+* uint32_t size: size of the image.
+*
+* Return: cy_en_em_eeprom_status_t
+*  EEPROM_STATUS_NO_MEMORY if the queue cannot be created.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_rtos_init(eeprom_rtos_t *rtos, cy_stc_eeprom_context_t *context,
+                                          uint32_t base, uint8_t *image, uint32_t size)
+{
+    if((NULL == rtos) || (NULL == context) || (NULL == image) || (0u == size))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    rtos->context = context;
+    rtos->image = image;
+    rtos->base = base;
+    rtos->size = size;
+    rtos->sequence = 0u;
+    rtos->writer = NULL;
+    rtos->queue = xQueueCreate(EEPROM_RTOS_QUEUE_DEPTH, sizeof(rtos_request_t *));
+    if(NULL == rtos->queue)
+    {
+        return EEPROM_STATUS_NO_MEMORY;
+    }
+
+    return eeprom_io_read(base, image, size, context);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_rtos_start
+********************************************************************************
+*
+* Summary:
+* Creates the writer task. Give it a lower priority than the tasks that must
+* not be delayed by flash operations; readers are not affected by it.
+*
+* Parameters:
+* eeprom_rtos_t *rtos: access layer instance.
+* UBaseType_t priority: priority of the writer task.
+*
+* Return: cy_en_em_eeprom_status_t
+*  EEPROM_STATUS_NO_MEMORY if the task cannot be created.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_rtos_start(eeprom_rtos_t *rtos, UBaseType_t priority)
+{
+    if((NULL == rtos) || (NULL == rtos->queue) || (NULL != rtos->writer))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    if(pdPASS != xTaskCreate(rtos_writer_task, "eeprom", EEPROM_RTOS_WRITER_STACK_SIZE,
+                             rtos, priority, &rtos->writer))
+    {
+        rtos->writer = NULL;
+        return EEPROM_STATUS_NO_MEMORY;
+    }
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_rtos_read
+********************************************************************************
+*
+* Summary:
+* Copies committed data out of the image. Does not block: if the writer
+* publishes a write while the data is copied, the copy is repeated.
+*
+* Parameters:
+* eeprom_rtos_t *rtos: access layer instance.
+* uint32_t addr: logical address.
+* void *data: destination buffer.
+* uint32_t size: size in bytes.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_BAD_PARAM if the range is outside the image.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_rtos_read(eeprom_rtos_t *rtos, uint32_t addr,
+                                          void *data, uint32_t size)
+{
+    uint32_t sequence;
+
+    if((NULL == rtos) || (NULL == data) || (addr < rtos->base) ||
+       ((addr - rtos->base) > rtos->size) || (size > (rtos->size - (addr - rtos->base))))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    do
+    {
+        sequence = rtos->sequence;
+        __DMB();
+        memcpy(data, &rtos->image[addr - rtos->base], size);
+        __DMB();
+    } while((0u != (sequence & 1u)) || (sequence != rtos->sequence));
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_rtos_write
+********************************************************************************
+*
+* Summary:
+* Queues a write to the writer task and waits for its status. Readers see the
+* new data once the write is committed to the flash.
+*
+* Parameters:
+* eeprom_rtos_t *rtos: access layer instance.
+* uint32_t addr: logical address.
+* const void *data: data, must stay valid until the function returns.
+* uint32_t size: size in bytes.
+* TickType_t timeout: how long to wait for a free queue entry.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_BAD_PARAM if the range is outside the image, the writer task is
+*  not started or the function is called by the writer task itself.
+*  EEPROM_STATUS_BUSY if the queue stays full for the timeout. Nothing is
+*  written; retry the call later.
+*  The notification of the calling task is used to wait for the writer task,
+*  so a notification pending on entry is consumed.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_rtos_write(eeprom_rtos_t *rtos, uint32_t addr,
+                                           const void *data, uint32_t size,
+                                           TickType_t timeout)
+{
+    rtos_request_t request;
+    rtos_request_t *entry = &request;
+    uint32_t notified;
+
+    if((NULL == rtos) || (NULL == data) || (NULL == rtos->writer) ||
+       (xTaskGetCurrentTaskHandle() == rtos->writer) || (addr < rtos->base) ||
+       ((addr - rtos->base) > rtos->size) || (size > (rtos->size - (addr - rtos->base))))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    request.addr = addr;
+    request.data = data;
+    request.size = size;
+    request.requester = xTaskGetCurrentTaskHandle();
+    request.status = CY_EM_EEPROM_SUCCESS;
+    request.done = false;
+
+    /* Drop a notification left over from earlier, so that it cannot end the
+     * wait below before the writer task has finished with the request.
+     */
+    (void) xTaskNotifyStateClear(NULL);
+
+    if(pdPASS != xQueueSend(rtos->queue, &entry, timeout))
+    {
+        return EEPROM_STATUS_BUSY;
+    }
+
+    /* The request is on this stack, so wait for it however long it takes. A
+     * notification from another source does not set done and is waited out.
+     */
+    while(!request.done)
+    {
+        (void) xTaskNotifyWait(0u, UINT32_MAX, &notified, portMAX_DELAY);
+    }
+    return request.status;
+}
+
+
+/*******************************************************************************
+* Function Name: rtos_writer_task
+********************************************************************************
+*
+* Summary:
+* Writer task. Programs the queued writes one after the other and publishes
+* the successful ones to the image.
+*
+*******************************************************************************/
+static void rtos_writer_task(void *arg)
+{
+    eeprom_rtos_t *rtos = (eeprom_rtos_t *) arg;
+    rtos_request_t *request;
+    TaskHandle_t requester;
+    cy_en_em_eeprom_status_t status;
+
+    for(;;)
+    {
+        if(pdPASS == xQueueReceive(rtos->queue, &request, portMAX_DELAY))
+        {
+            status = eeprom_io_write(request->addr, request->data, request->size,
+                                     rtos->context);
+            if((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status))
+            {
+                rtos_publish(rtos, request->addr, request->data, request->size);
+            }
+            /* The request may leave the stack of the requester as soon as
+             * done is set, so nothing of it is used afterwards.
+             */
+            requester = request->requester;
+            request->status = status;
+            __DMB();
+            request->done = true;
+            (void) xTaskNotify(requester, (uint32_t) status, eSetValueWithOverwrite);
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: rtos_publish
+********************************************************************************
+*
+* Summary:
+* Copies committed data into the image. The update is short and runs in a
+* critical section, so on a single core a reader never has to spin on it; the
+* sequence counter still lets a reader detect it on any other core.
+*
+*******************************************************************************/
+static void rtos_publish(eeprom_rtos_t *rtos, uint32_t addr, const void *data, uint32_t size)
+{
+    taskENTER_CRITICAL();
+    rtos->sequence++;
+    __DMB();
+    memcpy(&rtos->image[addr - rtos->base], data, size);
+    __DMB();
+    rtos->sequence++;
+    taskEXIT_CRITICAL();
+}
+
+
+/* [] END OF FILE */
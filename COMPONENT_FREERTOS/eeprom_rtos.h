@@ -0,0 +1,101 @@
+/******************************************************************************
+* File Name: eeprom_rtos.h
+*
+* Description: This file contains the interface of the FreeRTOS access layer.
+*              Tasks read the committed EEPROM content from a RAM image without
+*              locks; a single writer task owns the flash programming.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_RTOS_H
+#define EEPROM_RTOS_H
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of writes that can wait for the writer task. */
+#ifndef EEPROM_RTOS_QUEUE_DEPTH
+#define EEPROM_RTOS_QUEUE_DEPTH         (8u)
+#endif
+
+/* Stack of the writer task in words. */
+#ifndef EEPROM_RTOS_WRITER_STACK_SIZE
+#define EEPROM_RTOS_WRITER_STACK_SIZE   (configMINIMAL_STACK_SIZE * 2u)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    cy_stc_eeprom_context_t *context;
+    /* Committed content of the logical EEPROM from base to base + size. It
+     * is updated after each successful write, under the sequence counter.
+     */
+    uint8_t *image;
+    uint32_t base;
+    uint32_t size;
+    /* Odd while the writer updates the image. */
+    volatile uint32_t sequence;
+    QueueHandle_t queue;
+    TaskHandle_t writer;
+} eeprom_rtos_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_rtos_init(eeprom_rtos_t *rtos, cy_stc_eeprom_context_t *context,
+                                          uint32_t base, uint8_t *image, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_rtos_start(eeprom_rtos_t *rtos, UBaseType_t priority);
+cy_en_em_eeprom_status_t eeprom_rtos_read(eeprom_rtos_t *rtos, uint32_t addr,
+                                          void *data, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_rtos_write(eeprom_rtos_t *rtos, uint32_t addr,
+                                           const void *data, uint32_t size,
+                                           TickType_t timeout);
+
+#endif /* EEPROM_RTOS_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,152 @@
+/******************************************************************************
+* File Name: eeprom_area.h
+*
+* Description: This file contains the physical layout of an Em_EEPROM v2 area
+*              that the modules reading the flash directly depend on, checked
+*              against the macros of the middleware where they allow it.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_AREA_H
+#define EEPROM_AREA_H
+
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Row of the normal (non-simple) mode, as described in the Em_EEPROM API
+ * Reference Manual, section "Em_EEPROM Operation". The first half holds the
+ * sequence number of the write, the logical address and length of the data it
+ * wrote, that data itself and the row checksum. The second half holds a copy
+ * of one row of logical data with all writes up to this one applied: the row
+ * with sequence number s holds logical row (s % numberOfRows), so the last
+ * numberOfRows rows written hold all of them. Rows are written in a ring of
+ * numberOfRows * wearLevelingFactor rows, and the redundant copy of the ring
+ * follows it.
+ */
+#define EEPROM_AREA_SEQ_OFFSET          (0u)
+#define EEPROM_AREA_ADDR_OFFSET         (4u)
+#define EEPROM_AREA_LEN_OFFSET          (8u)
+#define EEPROM_AREA_DATA_OFFSET         (CY_EM_EEPROM_FLASH_SIZEOF_ROW - CY_EM_EEPROM_EEPROM_DATA_LEN(0u))
+
+/* Data one write stores in the first half of a row, between the 16-byte
+ * header and the checksum. Cy_Em_EEPROM_Write() splits a longer write into
+ * one row write per this many bytes, so only a write of at most this size is
+ * committed by a single row write.
+ */
+#define EEPROM_AREA_WRITE_DATA_LEN      ((CY_EM_EEPROM_FLASH_SIZEOF_ROW / 2u) - 16u)
+
+/* The parts of the layout above that the macros of the middleware expose. */
+_Static_assert(CY_EM_EEPROM_EEPROM_DATA_LEN(0u) == (CY_EM_EEPROM_FLASH_SIZEOF_ROW / 2u),
+               "Em_EEPROM no longer keeps the logical data in the second half of a row");
+_Static_assert(CY_EM_EEPROM_EEPROM_DATA_LEN(1u) == CY_EM_EEPROM_FLASH_SIZEOF_ROW,
+               "Em_EEPROM no longer stores whole rows of data in simple mode");
+_Static_assert(CY_EM_EEPROM_GET_PHYSICAL_SIZE(CY_EM_EEPROM_EEPROM_DATA_LEN(0u), 0u, 2u, 0u) ==
+               (2u * CY_EM_EEPROM_FLASH_SIZEOF_ROW),
+               "Em_EEPROM no longer takes wearLevelingFactor rows per row of data");
+_Static_assert(CY_EM_EEPROM_GET_PHYSICAL_SIZE(CY_EM_EEPROM_EEPROM_DATA_LEN(0u), 0u, 2u, 1u) ==
+               (2u * CY_EM_EEPROM_GET_PHYSICAL_SIZE(CY_EM_EEPROM_EEPROM_DATA_LEN(0u), 0u, 2u, 0u)),
+               "Em_EEPROM no longer doubles the area for the redundant copy");
+
+
+/*******************************************************************************
+* Function Name: eeprom_area_size
+********************************************************************************
+*
+* Summary:
+* Returns the size of the flash area of an instance in bytes.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t eeprom_area_size(const cy_stc_eeprom_config_t *config)
+{
+    return CY_EM_EEPROM_GET_PHYSICAL_SIZE(config->eepromSize, config->simpleMode,
+                                          config->wearLevelingFactor, config->redundantCopy);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_area_data_rows
+********************************************************************************
+*
+* Summary:
+* Returns the number of rows of logical data, numberOfRows of the context.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t eeprom_area_data_rows(const cy_stc_eeprom_config_t *config)
+{
+    uint32_t row_data = CY_EM_EEPROM_EEPROM_DATA_LEN(config->simpleMode);
+
+    return (config->eepromSize + row_data - 1u) / row_data;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_area_ring_rows
+********************************************************************************
+*
+* Summary:
+* Returns the number of rows the writes rotate through, which is the number of
+* rows of one copy. The redundant copy starts that many rows after the area.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t eeprom_area_ring_rows(const cy_stc_eeprom_config_t *config)
+{
+    return (eeprom_area_size(config) / CY_EM_EEPROM_FLASH_SIZEOF_ROW) /
+           ((0u != config->simpleMode) ? 1u : ((uint32_t) config->redundantCopy + 1u));
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_area_word
+********************************************************************************
+*
+* Summary:
+* Reads a header word of a row.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t eeprom_area_word(uint32_t row_addr, uint32_t offset)
+{
+    return *(const volatile uint32_t *) (row_addr + offset);
+}
+
+#endif /* EEPROM_AREA_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,427 @@
+/******************************************************************************
+* File Name: eeprom_async.c
+*
+* Description: This file implements a deferred queue of Emulated EEPROM
+*              write jobs with per-job completion callbacks. Submitting a write
+*              only copies the data into the queue; the write runs later, as
+*              one blocking Em_EEPROM write per job, from a low-priority
+*              interrupt or from the main loop.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_async.h"
+#include "eeprom_io.h"
+#include "eeprom_status.h"
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static cy_en_em_eeprom_status_t async_submit(eeprom_async_t *engine, uint32_t addr,
+                                             const void *data, uint32_t size,
+                                             eeprom_cache_t *cache,
+                                             eeprom_async_callback_t callback,
+                                             void *arg);
+static void async_kick(void);
+#if defined(EEPROM_ASYNC_IRQN)
+static void async_isr(void);
+#endif
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+#if defined(EEPROM_ASYNC_IRQN)
+/* Engine served by the software-triggered interrupt. */
+static eeprom_async_t *irq_engine = NULL;
+#endif
+
+
+/*******************************************************************************
+* Function Name: eeprom_async_init
+********************************************************************************
+*
+* Summary:
+* Binds the engine to an initialized Em_EEPROM context. Configure the
+* Em_EEPROM with blockingWrite = 0 so that interrupts keep being served while
+* the flash is programmed.
+*
+* Parameters:
+* eeprom_async_t *engine: engine instance to initialize.
+* cy_stc_eeprom_context_t *context: initialized Em_EEPROM context.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_async_init(eeprom_async_t *engine,
+                                           cy_stc_eeprom_context_t *context)
+{
+    if((NULL == engine) || (NULL == context))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    engine->context = context;
+    engine->head = 0u;
+    engine->tail = 0u;
+    engine->running = false;
+
+#if defined(EEPROM_ASYNC_IRQN)
+    const cy_stc_sysint_t async_intr_config =
+    {
+        .intrSrc = EEPROM_ASYNC_IRQN,
+        .intrPriority = EEPROM_ASYNC_INTR_PRIORITY
+    };
+
+    irq_engine = engine;
+    (void) Cy_SysInt_Init(&async_intr_config, async_isr);
+    NVIC_ClearPendingIRQ(EEPROM_ASYNC_IRQN);
+    NVIC_EnableIRQ(EEPROM_ASYNC_IRQN);
+#endif
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_async_write
+********************************************************************************
+*
+* Summary:
+* Queues a write of size bytes at logical address addr. The data is copied, so
+* the caller does not have to keep the buffer. Can be called from interrupts.
+*
+* Parameters:
+* eeprom_async_t *engine: engine instance.
+* uint32_t addr: logical Em_EEPROM address.
+* const void *data: source buffer.
+* uint32_t size: number of bytes, at most EEPROM_ASYNC_MAX_DATA.
+* eeprom_async_callback_t callback: completion callback, can be NULL.
+* void *arg: argument passed to the callback.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_SUCCESS if the job is queued, EEPROM_STATUS_BUSY if the queue
+* is full. Nothing is queued then; retry once a job has completed.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_async_write(eeprom_async_t *engine, uint32_t addr,
+                                            const void *data, uint32_t size,
+                                            eeprom_async_callback_t callback,
+                                            void *arg)
+{
+    cy_en_em_eeprom_status_t status;
+
+    status = async_submit(engine, addr, data, size, NULL, callback, arg);
+
+    if(CY_EM_EEPROM_SUCCESS == status)
+    {
+        async_kick();
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_async_flush_cache
+********************************************************************************
+*
+* Summary:
+* Queues the dirty data of a write-back cache, one job per dirty Em_EEPROM
+* row covering its dirty span, and marks the queued data clean. Each job is
+* one row program, counted by eeprom_cache_rows_touched(). The jobs read the
+* data from the cache image when they run, so data written to the cache
+* before then is programmed with them; it is dirty again and the next flush
+* writes it once more. The callback is called for every queued job. The data
+* of a failed job is dirty again.
+*
+* The queued jobs own the flush of the cache (eeprom_cache_begin_flush())
+* until the last one has run, so the LVD hook saves the cache only after the
+* queued data is written, and the Deep Sleep hook fails its check until then.
+*
+* Parameters:
+* eeprom_async_t *engine: engine instance.
+* eeprom_cache_t *cache: cache attached to the same Em_EEPROM context.
+* eeprom_async_callback_t callback: completion callback, can be NULL.
+* void *arg: argument passed to the callback.
+*
+* Return: cy_en_em_eeprom_status_t
+* EEPROM_STATUS_BUSY if the queue cannot take all data, or if another flush
+* owns the cache. Nothing is lost: the data that was not queued stays dirty in
+* the cache. Let the queue drain and call it again until it returns
+* CY_EM_EEPROM_SUCCESS.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_async_flush_cache(eeprom_async_t *engine,
+                                                  eeprom_cache_t *cache,
+                                                  eeprom_async_callback_t callback,
+                                                  void *arg)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    eeprom_cache_range_t range;
+    uint32_t interrupt_state;
+    uint32_t first_job;
+
+    if((NULL == engine) || (NULL == cache))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    if(!eeprom_cache_begin_flush(cache))
+    {
+        return EEPROM_STATUS_BUSY;
+    }
+
+    /* Queue all jobs before the engine can run the first one, so that the
+     * last job is known when it runs.
+     */
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    first_job = engine->head;
+
+    while((CY_EM_EEPROM_SUCCESS == status) && eeprom_cache_take_row(cache, &range))
+    {
+        status = async_submit(engine, range.start,
+                              &cache->image[range.start - cache->base],
+                              range.end - range.start, cache, callback, arg);
+        if(CY_EM_EEPROM_SUCCESS == status)
+        {
+            cache->rows_touched++;
+        }
+        else
+        {
+            /* Queue full: return the span to the cache. */
+            eeprom_cache_mark_dirty(cache, range.start, range.end - range.start);
+        }
+    }
+
+    if(first_job != engine->head)
+    {
+        engine->jobs[(engine->head - 1u) % EEPROM_ASYNC_QUEUE_DEPTH].flush_end = true;
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    if(first_job == engine->head)
+    {
+        /* Nothing queued, so no job ends the flush. */
+        (void) eeprom_cache_end_flush(cache);
+    }
+
+    async_kick();
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_async_process
+********************************************************************************
+*
+* Summary:
+* Executes the queued jobs in submission order and calls their completion
+* callbacks. Each job is a complete Em_EEPROM write, so this returns only when
+* the queue is empty. Runs from the engine interrupt when EEPROM_ASYNC_IRQN is
+* defined; otherwise call it from the main loop.
+*
+* Parameters:
+* eeprom_async_t *engine: engine instance.
+*
+*******************************************************************************/
+void eeprom_async_process(eeprom_async_t *engine)
+{
+    eeprom_async_job_t *job;
+    cy_en_em_eeprom_status_t status;
+    uint32_t interrupt_state;
+
+    if(NULL == engine)
+    {
+        return;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    if(engine->running)
+    {
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+        return;
+    }
+    engine->running = true;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    while(engine->tail != engine->head)
+    {
+        job = &engine->jobs[engine->tail % EEPROM_ASYNC_QUEUE_DEPTH];
+
+        status = eeprom_io_write(job->addr, job->source, job->size,
+                                 engine->context);
+
+        if(NULL != job->cache)
+        {
+            if(eeprom_status_failed(status))
+            {
+                eeprom_cache_mark_dirty(job->cache, job->addr, job->size);
+            }
+            if(job->flush_end)
+            {
+                status = eeprom_status_combine(status, eeprom_cache_end_flush(job->cache));
+            }
+        }
+
+        if(NULL != job->callback)
+        {
+            job->callback(status, job->arg);
+        }
+
+        /* Release the slot only after the callback has seen the job. */
+        engine->tail++;
+    }
+
+    engine->running = false;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_async_is_busy
+********************************************************************************
+*
+* Summary:
+* Checks whether any job is queued or in progress.
+*
+* Parameters:
+* const eeprom_async_t *engine: engine instance.
+*
+* Return: bool
+*
+*******************************************************************************/
+bool eeprom_async_is_busy(const eeprom_async_t *engine)
+{
+    return ((NULL != engine) && ((engine->tail != engine->head) || engine->running));
+}
+
+
+/*******************************************************************************
+* Function Name: async_submit
+********************************************************************************
+*
+* Summary:
+* Puts a job into the next free queue slot. For a job of eeprom_async_write(),
+* cache is NULL and the data is copied into the job; otherwise the job refers
+* to the cache image.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t async_submit(eeprom_async_t *engine, uint32_t addr,
+                                             const void *data, uint32_t size,
+                                             eeprom_cache_t *cache,
+                                             eeprom_async_callback_t callback,
+                                             void *arg)
+{
+    bool copy = (NULL == cache);
+    eeprom_async_job_t *job;
+    uint32_t interrupt_state;
+
+    if((NULL == engine) || (NULL == data) || (0u == size) ||
+       (copy && (size > EEPROM_ASYNC_MAX_DATA)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    if((engine->head - engine->tail) >= EEPROM_ASYNC_QUEUE_DEPTH)
+    {
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+        return EEPROM_STATUS_BUSY;
+    }
+
+    job = &engine->jobs[engine->head % EEPROM_ASYNC_QUEUE_DEPTH];
+    job->addr = addr;
+    job->size = size;
+    job->callback = callback;
+    job->arg = arg;
+    job->cache = cache;
+    job->flush_end = false;
+    if(copy)
+    {
+        memcpy(job->data, data, size);
+        job->source = job->data;
+    }
+    else
+    {
+        job->source = (const uint8_t *) data;
+    }
+    engine->head++;
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: async_kick
+********************************************************************************
+*
+* Summary:
+* Starts the engine interrupt, if one is configured.
+*
+*******************************************************************************/
+static void async_kick(void)
+{
+#if defined(EEPROM_ASYNC_IRQN)
+    NVIC_SetPendingIRQ(EEPROM_ASYNC_IRQN);
+#endif
+}
+
+
+#if defined(EEPROM_ASYNC_IRQN)
+/*******************************************************************************
+* Function Name: async_isr
+********************************************************************************
+*
+* Summary:
+* Engine interrupt handler. Drains the job queue.
+*
+*******************************************************************************/
+static void async_isr(void)
+{
+    eeprom_async_process(irq_engine);
+}
+#endif
+
+
+/* [] END OF FILE */
@@ -0,0 +1,132 @@
+/******************************************************************************
+* File Name: eeprom_async.h
+*
+* Description: This file contains the interface of the deferred Emulated
+*              EEPROM write queue.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_ASYNC_H
+#define EEPROM_ASYNC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+#include "eeprom_cache.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of write jobs that can be queued at the same time. */
+#ifndef EEPROM_ASYNC_QUEUE_DEPTH
+#define EEPROM_ASYNC_QUEUE_DEPTH        (4u)
+#endif
+
+/* Largest payload of one eeprom_async_write() job. The data is copied into the
+ * job on submission so the caller's buffer can be reused immediately. Jobs
+ * queued by eeprom_async_flush_cache() do not copy and can cover a whole
+ * Em_EEPROM row.
+ */
+#ifndef EEPROM_ASYNC_MAX_DATA
+#define EEPROM_ASYNC_MAX_DATA           (32u)
+#endif
+
+/* Interrupt line used to run the engine. When EEPROM_ASYNC_IRQN is defined,
+ * submitting a job pends this (otherwise unused) interrupt and the jobs are
+ * executed in its handler, at EEPROM_ASYNC_INTR_PRIORITY. Give it the lowest
+ * priority in the system so that every other interrupt preempts the flash
+ * operation. When it is not defined, call eeprom_async_process() from the
+ * main loop.
+ */
+#ifndef EEPROM_ASYNC_INTR_PRIORITY
+#define EEPROM_ASYNC_INTR_PRIORITY      (7u)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Completion callback, called once per job with the Em_EEPROM write status.
+ * CY_EM_EEPROM_REDUNDANT_COPY_USED is passed through unchanged.
+ */
+typedef void (*eeprom_async_callback_t)(cy_en_em_eeprom_status_t status, void *arg);
+
+typedef struct
+{
+    uint32_t addr;
+    uint32_t size;
+    /* The copy in data, or the image of the flushed cache. */
+    const uint8_t *source;
+    /* Cache flushed by the job, NULL for eeprom_async_write(). */
+    eeprom_cache_t *cache;
+    /* Last job of an eeprom_async_flush_cache() call. */
+    bool flush_end;
+    eeprom_async_callback_t callback;
+    void *arg;
+    uint8_t data[EEPROM_ASYNC_MAX_DATA];
+} eeprom_async_job_t;
+
+typedef struct
+{
+    cy_stc_eeprom_context_t *context;
+    eeprom_async_job_t jobs[EEPROM_ASYNC_QUEUE_DEPTH];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile bool running;
+} eeprom_async_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_async_init(eeprom_async_t *engine,
+                                           cy_stc_eeprom_context_t *context);
+cy_en_em_eeprom_status_t eeprom_async_write(eeprom_async_t *engine, uint32_t addr,
+                                            const void *data, uint32_t size,
+                                            eeprom_async_callback_t callback,
+                                            void *arg);
+cy_en_em_eeprom_status_t eeprom_async_flush_cache(eeprom_async_t *engine,
+                                                  eeprom_cache_t *cache,
+                                                  eeprom_async_callback_t callback,
+                                                  void *arg);
+void eeprom_async_process(eeprom_async_t *engine);
+bool eeprom_async_is_busy(const eeprom_async_t *engine);
+
+#endif /* EEPROM_ASYNC_H */
+
+/* [] END OF FILE */
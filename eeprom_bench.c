@@ -0,0 +1,427 @@
+/******************************************************************************
+* File Name: eeprom_bench.c
+*
+* Description: This file implements the Emulated EEPROM benchmark. It sweeps
+*              the Em_EEPROM configuration and prints the cycle counts of
+*              Cy_Em_EEPROM_Init(), Cy_Em_EEPROM_Read() and Cy_Em_EEPROM_Write()
+*              together with the number of flash rows programmed per write.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <string.h>
+#include "cy_pdl.h"
+#include "cy_em_eeprom.h"
+#include "eeprom_bench.h"
+#include "eeprom_crc.h"
+#include "eeprom_cycles.h"
+#include "eeprom_fastinit.h"
+
+/* Everything below, the flash area in particular, is linked only into the
+ * benchmark configuration, so the demo keeps the whole Em_EEPROM region.
+ */
+#if defined(EEPROM_BENCH)
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define BENCH_STORAGE_SIZE  (EEPROM_BENCH_STORAGE_SIZE)
+#define BENCH_STORAGE_ROWS  (BENCH_STORAGE_SIZE / CY_EM_EEPROM_FLASH_SIZEOF_ROW)
+
+#if (defined(CY_DEVICE_SECURE) && !CY_EM_EEPROM_SIZE)
+#error "The benchmark needs the emulated EEPROM flash region on secure targets"
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* One point of the configuration sweep. */
+typedef struct
+{
+    uint32_t eeprom_size;
+    uint8_t wear_levelling_factor;
+    uint8_t redundant_copy;
+    uint8_t simple_mode;
+} bench_case_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void bench_run_case(const bench_case_t *bench_case);
+static uint32_t bench_rows_changed(uint32_t *signatures, uint32_t rows);
+static void bench_run_crc(uint32_t eeprom_size);
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Configurations measured by the benchmark. Simple mode does not support wear
+ * leveling or a redundant copy.
+ */
+static const bench_case_t bench_cases[] =
+{
+    {   64u, 1u, 0u, 1u }, {   64u, 1u, 0u, 0u }, {   64u, 1u, 1u, 0u },
+    {   64u, 2u, 0u, 0u }, {   64u, 2u, 1u, 0u }, {   64u, 4u, 1u, 0u },
+    {  256u, 1u, 0u, 1u }, {  256u, 1u, 0u, 0u }, {  256u, 1u, 1u, 0u },
+    {  256u, 2u, 0u, 0u }, {  256u, 2u, 1u, 0u }, {  256u, 4u, 1u, 0u },
+    { 1024u, 1u, 0u, 1u }, { 1024u, 1u, 0u, 0u }, { 1024u, 1u, 1u, 0u },
+    { 1024u, 2u, 0u, 0u }, { 1024u, 2u, 1u, 0u }, { 1024u, 4u, 1u, 0u },
+};
+
+/* Em_EEPROM sizes of the CRC backend comparison. */
+static const uint32_t bench_crc_sizes[] = { 64u, 256u, 1024u };
+
+#if CY_EM_EEPROM_SIZE
+CY_SECTION(".cy_em_eeprom")
+#endif
+CY_ALIGN(CY_EM_EEPROM_FLASH_SIZEOF_ROW)
+static const uint8_t bench_storage[BENCH_STORAGE_SIZE] = {0u};
+
+static uint8_t bench_buffer[EEPROM_BENCH_MAX_SIZE];
+static uint32_t bench_init_samples[EEPROM_BENCH_ITERATIONS];
+static uint32_t bench_read_samples[EEPROM_BENCH_ITERATIONS];
+static uint32_t bench_write_samples[EEPROM_BENCH_ITERATIONS];
+static uint32_t bench_row_samples[EEPROM_BENCH_ITERATIONS];
+static uint32_t bench_signatures[BENCH_STORAGE_ROWS];
+
+
+/*******************************************************************************
+* Function Name: eeprom_bench_run
+********************************************************************************
+*
+* Summary:
+* Runs the whole configuration sweep and prints the results over retarget-io.
+*
+*******************************************************************************/
+void eeprom_bench_run(void)
+{
+    eeprom_cycles_init();
+
+    printf("Em_EEPROM benchmark, %lu samples per configuration, %lu Hz\r\n",
+           (unsigned long) EEPROM_BENCH_ITERATIONS, (unsigned long) SystemCoreClock);
+    printf("Cycles are reported as min/median/max\r\n\r\n");
+
+    for(uint32_t i = 0u; i < (sizeof(bench_cases) / sizeof(bench_cases[0])); i++)
+    {
+        bench_run_case(&bench_cases[i]);
+    }
+
+    printf("CRC backends, WEAR_LEVELLING_FACTOR 2, REDUNDANT_COPY 1, fast initialization\r\n\r\n");
+    for(uint32_t i = 0u; i < (sizeof(bench_crc_sizes) / sizeof(bench_crc_sizes[0])); i++)
+    {
+        bench_run_crc(bench_crc_sizes[i]);
+    }
+
+    printf("Benchmark done\r\n");
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_bench_stats
+********************************************************************************
+*
+* Summary:
+* Sorts the samples in place and extracts the minimum, median and maximum.
+*
+* Parameters:
+* uint32_t *samples: sample array, reordered by the call.
+* uint32_t count: number of samples, at least one.
+* eeprom_bench_stats_t *stats: result.
+*
+*******************************************************************************/
+void eeprom_bench_stats(uint32_t *samples, uint32_t count, eeprom_bench_stats_t *stats)
+{
+    uint32_t value;
+    uint32_t j;
+
+    /* Insertion sort, the sample sets are small. */
+    for(uint32_t i = 1u; i < count; i++)
+    {
+        value = samples[i];
+        for(j = i; (j > 0u) && (samples[j - 1u] > value); j--)
+        {
+            samples[j] = samples[j - 1u];
+        }
+        samples[j] = value;
+    }
+
+    stats->min = samples[0];
+    stats->median = samples[count / 2u];
+    stats->max = samples[count - 1u];
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_bench_print
+********************************************************************************
+*
+* Summary:
+* Prints one line of statistics.
+*
+*******************************************************************************/
+void eeprom_bench_print(const char *name, const eeprom_bench_stats_t *stats)
+{
+    printf("  %-6s %9lu/%9lu/%9lu cycles (median %lu us)\r\n", name,
+           (unsigned long) stats->min, (unsigned long) stats->median,
+           (unsigned long) stats->max,
+           (unsigned long) eeprom_cycles_to_us(stats->median));
+}
+
+
+/*******************************************************************************
+* Function Name: bench_run_case
+********************************************************************************
+*
+* Summary:
+* Measures one configuration. The area is erased first so that every
+* configuration starts from the same state, then each iteration times Init,
+* a read of the whole Em_EEPROM and a reset-counter sized write.
+*
+*******************************************************************************/
+static void bench_run_case(const bench_case_t *bench_case)
+{
+    cy_stc_eeprom_config_t config =
+    {
+        .eepromSize = bench_case->eeprom_size,
+        .blockingWrite = 1u,
+        .redundantCopy = bench_case->redundant_copy,
+        .wearLevelingFactor = bench_case->wear_levelling_factor,
+        .userFlashStartAddr = (uint32_t) bench_storage,
+        .simpleMode = bench_case->simple_mode,
+    };
+    cy_stc_eeprom_context_t context;
+    cy_en_em_eeprom_status_t status;
+    eeprom_bench_stats_t stats;
+    uint8_t counter[EEPROM_BENCH_WRITE_SIZE];
+    uint32_t rows;
+    uint32_t start;
+
+    rows = CY_EM_EEPROM_GET_PHYSICAL_SIZE(config.eepromSize, config.simpleMode,
+                                          config.wearLevelingFactor,
+                                          config.redundantCopy) / CY_EM_EEPROM_FLASH_SIZEOF_ROW;
+
+    printf("EEPROM_SIZE %lu, WEAR_LEVELLING_FACTOR %u, REDUNDANT_COPY %u, SIMPLE_MODE %u, %lu rows\r\n",
+           (unsigned long) config.eepromSize, config.wearLevelingFactor,
+           config.redundantCopy, config.simpleMode, (unsigned long) rows);
+
+    status = Cy_Em_EEPROM_Init(&config, &context);
+    if(CY_EM_EEPROM_SUCCESS == status)
+    {
+        status = Cy_Em_EEPROM_Erase(&context);
+    }
+    if(CY_EM_EEPROM_SUCCESS != status)
+    {
+        printf("  skipped, status 0x%x\r\n\r\n", (unsigned int) status);
+        return;
+    }
+
+    (void) bench_rows_changed(bench_signatures, rows);
+    memset(counter, 0, sizeof(counter));
+
+    for(uint32_t i = 0u; i < EEPROM_BENCH_ITERATIONS; i++)
+    {
+        start = eeprom_cycles_now();
+        status = Cy_Em_EEPROM_Init(&config, &context);
+        bench_init_samples[i] = eeprom_cycles_now() - start;
+
+        start = eeprom_cycles_now();
+        status |= Cy_Em_EEPROM_Read(0u, bench_buffer, config.eepromSize, &context);
+        bench_read_samples[i] = eeprom_cycles_now() - start;
+
+        counter[i % EEPROM_BENCH_WRITE_SIZE]++;
+
+        start = eeprom_cycles_now();
+        status |= Cy_Em_EEPROM_Write(EEPROM_BENCH_WRITE_LOCATION, counter,
+                                     EEPROM_BENCH_WRITE_SIZE, &context);
+        bench_write_samples[i] = eeprom_cycles_now() - start;
+
+        bench_row_samples[i] = bench_rows_changed(bench_signatures, rows);
+
+        if(CY_EM_EEPROM_SUCCESS != status)
+        {
+            printf("  failed, status 0x%x\r\n\r\n", (unsigned int) status);
+            return;
+        }
+    }
+
+    eeprom_bench_stats(bench_init_samples, EEPROM_BENCH_ITERATIONS, &stats);
+    eeprom_bench_print("Init", &stats);
+    eeprom_bench_stats(bench_read_samples, EEPROM_BENCH_ITERATIONS, &stats);
+    eeprom_bench_print("Read", &stats);
+    eeprom_bench_stats(bench_write_samples, EEPROM_BENCH_ITERATIONS, &stats);
+    eeprom_bench_print("Write", &stats);
+    eeprom_bench_stats(bench_row_samples, EEPROM_BENCH_ITERATIONS, &stats);
+    printf("  Rows programmed per write %lu/%lu/%lu\r\n\r\n",
+           (unsigned long) stats.min, (unsigned long) stats.median,
+           (unsigned long) stats.max);
+}
+
+
+/*******************************************************************************
+* Function Name: bench_run_crc
+********************************************************************************
+*
+* Summary:
+* Compares the CRC backends on the paths that use eeprom_crc32_update(): the
+* fast initialization, which checks two rows, the write followed by the hint
+* update, which computes the CRCs of two rows, and the CRC of one row.
+*
+*******************************************************************************/
+static void bench_run_crc(uint32_t eeprom_size)
+{
+    static const eeprom_crc_backend_t backends[] = { EEPROM_CRC_SOFTWARE, EEPROM_CRC_HARDWARE };
+    cy_stc_eeprom_config_t config =
+    {
+        .eepromSize = eeprom_size,
+        .blockingWrite = 1u,
+        .redundantCopy = 1u,
+        .wearLevelingFactor = 2u,
+        .userFlashStartAddr = (uint32_t) bench_storage,
+        .simpleMode = 0u,
+    };
+    cy_stc_eeprom_context_t context;
+    cy_en_em_eeprom_status_t status;
+    eeprom_bench_stats_t stats;
+    uint8_t counter[EEPROM_BENCH_WRITE_SIZE];
+    bool fast_path = true;
+    uint32_t start;
+
+    printf("EEPROM_SIZE %lu\r\n", (unsigned long) eeprom_size);
+
+    status = Cy_Em_EEPROM_Init(&config, &context);
+    if(CY_EM_EEPROM_SUCCESS == status)
+    {
+        status = Cy_Em_EEPROM_Erase(&context);
+    }
+    if(CY_EM_EEPROM_SUCCESS != status)
+    {
+        printf("  skipped, status 0x%x\r\n\r\n", (unsigned int) status);
+        return;
+    }
+    memset(counter, 0, sizeof(counter));
+
+    for(uint32_t b = 0u; b < (sizeof(backends) / sizeof(backends[0])); b++)
+    {
+        if(backends[b] != eeprom_crc_select(backends[b]))
+        {
+            printf("  hardware CRC not available\r\n");
+            continue;
+        }
+        printf("  %s CRC\r\n", (EEPROM_CRC_HARDWARE == backends[b]) ? "hardware" : "software");
+
+        for(uint32_t i = 0u; i < EEPROM_BENCH_ITERATIONS; i++)
+        {
+            counter[i % EEPROM_BENCH_WRITE_SIZE]++;
+
+            start = eeprom_cycles_now();
+            status = Cy_Em_EEPROM_Write(EEPROM_BENCH_WRITE_LOCATION, counter,
+                                        EEPROM_BENCH_WRITE_SIZE, &context);
+            eeprom_fastinit_update(&config, &context);
+            bench_write_samples[i] = eeprom_cycles_now() - start;
+
+            start = eeprom_cycles_now();
+            status |= eeprom_fastinit_init(&config, &context, &fast_path);
+            bench_init_samples[i] = eeprom_cycles_now() - start;
+
+            start = eeprom_cycles_now();
+            (void) eeprom_crc32_update(0u, bench_storage, CY_EM_EEPROM_FLASH_SIZEOF_ROW);
+            bench_read_samples[i] = eeprom_cycles_now() - start;
+
+            if((CY_EM_EEPROM_SUCCESS != status) || !fast_path)
+            {
+                printf("  failed, status 0x%x\r\n\r\n", (unsigned int) status);
+                (void) eeprom_crc_select(EEPROM_CRC_SOFTWARE);
+                return;
+            }
+        }
+
+        eeprom_bench_stats(bench_init_samples, EEPROM_BENCH_ITERATIONS, &stats);
+        eeprom_bench_print("Init", &stats);
+        eeprom_bench_stats(bench_write_samples, EEPROM_BENCH_ITERATIONS, &stats);
+        eeprom_bench_print("Write", &stats);
+        eeprom_bench_stats(bench_read_samples, EEPROM_BENCH_ITERATIONS, &stats);
+        eeprom_bench_print("Row", &stats);
+    }
+
+    (void) eeprom_crc_select(EEPROM_CRC_SOFTWARE);
+    printf("\r\n");
+}
+
+
+/*******************************************************************************
+* Function Name: bench_rows_changed
+********************************************************************************
+*
+* Summary:
+* Counts the rows of the benchmark area whose content changed since the last
+* call. The Em_EEPROM middleware does not report its flash operations, so a row
+* is counted as programmed when its signature differs.
+*
+*******************************************************************************/
+static uint32_t bench_rows_changed(uint32_t *signatures, uint32_t rows)
+{
+    const uint32_t *word = (const uint32_t *) bench_storage;
+    uint32_t changed = 0u;
+    uint32_t signature;
+
+    for(uint32_t row = 0u; row < rows; row++)
+    {
+        signature = 0u;
+        for(uint32_t i = 0u; i < (CY_EM_EEPROM_FLASH_SIZEOF_ROW / sizeof(uint32_t)); i++)
+        {
+            /* Rotate-xor keeps the signature position dependent. */
+            signature = ((signature << 5u) | (signature >> 27u)) ^ *word++;
+        }
+
+        if(signature != signatures[row])
+        {
+            signatures[row] = signature;
+            changed++;
+        }
+    }
+
+    return changed;
+}
+
+
+#endif /* EEPROM_BENCH */
+
+/* [] END OF FILE */
@@ -0,0 +1,98 @@
+/******************************************************************************
+* File Name: eeprom_bench.h
+*
+* Description: This file contains the interface of the Emulated EEPROM
+*              benchmark built with CONFIG=Bench.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_BENCH_H
+#define EEPROM_BENCH_H
+
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+#include "eeprom_layout.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of Init/Read/Write samples taken per configuration. */
+#ifndef EEPROM_BENCH_ITERATIONS
+#define EEPROM_BENCH_ITERATIONS         (15u)
+#endif
+
+/* Largest Em_EEPROM size and wear leveling factor of the sweep. They size the
+ * flash area reserved for the benchmark.
+ */
+#define EEPROM_BENCH_MAX_SIZE           (1024u)
+#define EEPROM_BENCH_MAX_WEAR_LEVELLING (4u)
+
+/* Flash area of the benchmark in the emulated EEPROM flash region. */
+#define EEPROM_BENCH_STORAGE_SIZE       (CY_EM_EEPROM_GET_PHYSICAL_SIZE(EEPROM_BENCH_MAX_SIZE, 0u, \
+                                         EEPROM_BENCH_MAX_WEAR_LEVELLING, 1u))
+
+/* Logical address and size of the write measured in each iteration. This is
+ * the reset counter update of the demo, with the layout of eeprom_layout.h at
+ * the start of the benchmark instance.
+ */
+#define EEPROM_BENCH_WRITE_LOCATION     (EEPROM_FIELD_OFFSET(reset_count))
+#define EEPROM_BENCH_WRITE_SIZE         (EEPROM_FIELD_SIZE(reset_count))
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Cycle statistics of one measured operation. */
+typedef struct
+{
+    uint32_t min;
+    uint32_t median;
+    uint32_t max;
+} eeprom_bench_stats_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+void eeprom_bench_run(void);
+void eeprom_bench_stats(uint32_t *samples, uint32_t count, eeprom_bench_stats_t *stats);
+void eeprom_bench_print(const char *name, const eeprom_bench_stats_t *stats);
+
+#endif /* EEPROM_BENCH_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,847 @@
+/******************************************************************************
+* File Name: eeprom_cache.c
+*
+* Description: This file implements a write-back RAM cache placed in
+*              front of Cy_Em_EEPROM_Write(). Small writes are collected in a RAM
+*              image and the dirty byte ranges are merged, so that a flush commits
+*              each merged range with a single Em_EEPROM write.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_cache.h"
+#include "eeprom_flash.h"
+#include "eeprom_io.h"
+#include "eeprom_registry.h"
+#include "eeprom_status.h"
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void cache_add_range(eeprom_cache_t *cache, uint32_t start, uint32_t end);
+static void cache_remove_range(eeprom_cache_t *cache, uint32_t index);
+static void cache_lvd_isr(void);
+static void cache_brownout_save(void);
+static cy_en_syspm_status_t cache_syspm_callback(cy_stc_syspm_callback_params_t *params,
+                                                 cy_en_syspm_callback_mode_t mode);
+static cy_en_em_eeprom_status_t cache_save_journal(eeprom_cache_t *cache,
+                                                   eeprom_journal_t *journal);
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Caches by instance, so that readers that bypass them can tell whether the
+ * flash is current.
+ */
+EEPROM_REGISTRY_DEFINE(cache_registry, EEPROM_CACHE_MAX_INSTANCES);
+
+/* Cache flushed from the LVD interrupt. */
+static eeprom_cache_t *lvd_cache = NULL;
+/* Journal the LVD interrupt saves the dirty data to instead, if any. */
+static eeprom_journal_t *lvd_journal = NULL;
+
+/* Deep Sleep callback of the cache flushed before the transition. */
+static cy_stc_syspm_callback_params_t syspm_params;
+static cy_stc_syspm_callback_t syspm_callback =
+{
+    .callback = cache_syspm_callback,
+    .type = CY_SYSPM_DEEPSLEEP,
+    .skipMode = 0u,
+    .callbackParams = &syspm_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = EEPROM_CACHE_SYSPM_ORDER,
+};
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_init
+********************************************************************************
+*
+* Summary:
+* Binds the cache to an initialized Em_EEPROM context and fills the RAM image
+* with the current content of the logical window [base, base + size). One
+* cache can be attached to an instance.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance to initialize.
+* cy_stc_eeprom_context_t *context: initialized Em_EEPROM context.
+* uint32_t base: first logical address held by the cache.
+* uint8_t *image: RAM buffer of at least size bytes.
+* uint32_t size: number of bytes held by the cache.
+*
+* Return: cy_en_em_eeprom_status_t
+* Status of the Em_EEPROM read used to fill the image. CY_EM_EEPROM_BAD_PARAM
+* if EEPROM_CACHE_MAX_INSTANCES caches are attached already.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_cache_init(eeprom_cache_t *cache,
+                                           cy_stc_eeprom_context_t *context,
+                                           uint32_t base, uint8_t *image,
+                                           uint32_t size)
+{
+    uint32_t free_slot;
+
+    if((NULL == cache) || (NULL == context) || (NULL == image) || (0u == size))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    free_slot = eeprom_registry_slot(&cache_registry, cache, context);
+    if(EEPROM_CACHE_MAX_INSTANCES == free_slot)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    cache->context = context;
+    cache->image = image;
+    cache->base = base;
+    cache->size = size;
+    cache->range_count = 0u;
+    cache->rows_touched = 0u;
+    cache->flushing = false;
+    cache->dirty_since_ms = 0u;
+    cache->dirty_seen = false;
+    eeprom_registry_set(&cache_registry, free_slot, cache, context);
+
+    return eeprom_io_read(base, image, size, context);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_find
+********************************************************************************
+*
+* Summary:
+* Returns the cache attached to an Em_EEPROM instance, or NULL.
+*
+*******************************************************************************/
+eeprom_cache_t *eeprom_cache_find(const cy_stc_eeprom_context_t *context)
+{
+    return (eeprom_cache_t *) eeprom_registry_find(&cache_registry, context);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_read
+********************************************************************************
+*
+* Summary:
+* Reads data from the RAM image. Pending writes are visible to the reader.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance.
+* uint32_t addr: logical Em_EEPROM address.
+* void *data: destination buffer.
+* uint32_t size: number of bytes to read.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_cache_read(eeprom_cache_t *cache, uint32_t addr,
+                                           void *data, uint32_t size)
+{
+    if((NULL == cache) || (NULL == data) || (addr < cache->base) ||
+       ((addr - cache->base) > cache->size) ||
+       (size > (cache->size - (addr - cache->base))))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    memcpy(data, &cache->image[addr - cache->base], size);
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_write
+********************************************************************************
+*
+* Summary:
+* Updates the RAM image and records the written bytes as dirty, unless the
+* image holds the data already. Nothing is written to flash until
+* eeprom_cache_flush() is called.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance.
+* uint32_t addr: logical Em_EEPROM address.
+* const void *data: source buffer.
+* uint32_t size: number of bytes to write.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_cache_write(eeprom_cache_t *cache, uint32_t addr,
+                                            const void *data, uint32_t size)
+{
+    uint32_t interrupt_state;
+
+    if((NULL == cache) || (NULL == data) || (addr < cache->base) ||
+       ((addr - cache->base) > cache->size) ||
+       (size > (cache->size - (addr - cache->base))))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    if(0u != size)
+    {
+        /* The LVD hook may flush at any time, keep image and ranges coherent. */
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+        if(0 != memcmp(&cache->image[addr - cache->base], data, size))
+        {
+            memcpy(&cache->image[addr - cache->base], data, size);
+            cache_add_range(cache, addr, addr + size);
+        }
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+    }
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_flush
+********************************************************************************
+*
+* Summary:
+* Commits the dirty data with one Cy_Em_EEPROM_Write() call per affected
+* Em_EEPROM row, so each row is programmed at most once per flush. The data of
+* a failed write stays dirty, so the flush can be retried.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_REDUNDANT_COPY_USED is reported if any of the writes reported
+* it and no write failed.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_cache_flush(eeprom_cache_t *cache)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    cy_en_em_eeprom_status_t write_status;
+    eeprom_cache_range_t range;
+
+    if(NULL == cache)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    /* A flush interrupted by the LVD hook, or queued by eeprom_async.c, is
+     * completed by its owner.
+     */
+    if(!eeprom_cache_begin_flush(cache))
+    {
+        return CY_EM_EEPROM_SUCCESS;
+    }
+
+    while(eeprom_cache_take_row(cache, &range))
+    {
+        write_status = eeprom_io_write(range.start,
+                                       &cache->image[range.start - cache->base],
+                                       range.end - range.start,
+                                       cache->context);
+        cache->rows_touched++;
+
+        if((CY_EM_EEPROM_SUCCESS != write_status) &&
+           (CY_EM_EEPROM_REDUNDANT_COPY_USED != write_status))
+        {
+            eeprom_cache_mark_dirty(cache, range.start, range.end - range.start);
+
+            status = write_status;
+            break;
+        }
+
+        if(CY_EM_EEPROM_REDUNDANT_COPY_USED == write_status)
+        {
+            status = write_status;
+        }
+    }
+
+    return eeprom_status_combine(status, eeprom_cache_end_flush(cache));
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_begin_flush
+********************************************************************************
+*
+* Summary:
+* Makes the caller the owner of a flush of the cache. Until the matching
+* eeprom_cache_end_flush(), the Deep Sleep hook fails its check, and the LVD
+* hook is deferred so that it does not save the ranges already taken but not
+* yet written.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance.
+*
+* Return: bool
+* false if another flush owns the cache.
+*
+*******************************************************************************/
+bool eeprom_cache_begin_flush(eeprom_cache_t *cache)
+{
+    uint32_t interrupt_state;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    if(cache->flushing)
+    {
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+        return false;
+    }
+    cache->flushing = true;
+    eeprom_flash_enter();
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_end_flush
+********************************************************************************
+*
+* Summary:
+* Ends a flush started with eeprom_cache_begin_flush(). If all data is written,
+* the brown-out journal, which holds older data of the cache, is discarded.
+* Then the hooks are released; an LVD interrupt that came in the meantime runs
+* its save now, in the context of the caller.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance.
+*
+* Return: cy_en_em_eeprom_status_t
+* Status of the journal discard, CY_EM_EEPROM_SUCCESS if there was none.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_cache_end_flush(eeprom_cache_t *cache)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+
+    if((cache == lvd_cache) && !eeprom_journal_is_empty(lvd_journal) &&
+       (0u == cache->range_count))
+    {
+        status = eeprom_journal_discard(lvd_journal);
+    }
+
+    cache->flushing = false;
+    eeprom_flash_exit();
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_take_row
+********************************************************************************
+*
+* Summary:
+* Removes the dirty data of the lowest dirty Em_EEPROM row from the cache and
+* returns the span that covers it. Dirty ranges in the same row are combined
+* into one span, the clean bytes between them are taken from the image; a
+* range that crosses a row boundary is split at the boundary. The caller
+* writes the span, counts it in rows_touched, and returns it with
+* eeprom_cache_mark_dirty() on failure.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance.
+* eeprom_cache_range_t *range: returned span, within one row.
+*
+* Return: bool
+* false if the cache is clean.
+*
+*******************************************************************************/
+bool eeprom_cache_take_row(eeprom_cache_t *cache, eeprom_cache_range_t *range)
+{
+    uint32_t interrupt_state;
+    uint32_t row_end;
+    bool taken = false;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    if(0u != cache->range_count)
+    {
+        range->start = cache->ranges[0].start;
+        row_end = ((range->start / EEPROM_CACHE_ROW_DATA_SIZE) + 1u) * EEPROM_CACHE_ROW_DATA_SIZE;
+
+        while((0u != cache->range_count) && (cache->ranges[0].start < row_end))
+        {
+            if(cache->ranges[0].end <= row_end)
+            {
+                range->end = cache->ranges[0].end;
+                cache_remove_range(cache, 0u);
+            }
+            else
+            {
+                range->end = row_end;
+                cache->ranges[0].start = row_end;
+                break;
+            }
+        }
+
+        taken = true;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    return taken;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_mark_dirty
+********************************************************************************
+*
+* Summary:
+* Marks a range of the image as dirty without changing its content.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance.
+* uint32_t addr: logical Em_EEPROM address, within the cache window.
+* uint32_t size: number of bytes.
+*
+*******************************************************************************/
+void eeprom_cache_mark_dirty(eeprom_cache_t *cache, uint32_t addr, uint32_t size)
+{
+    uint32_t interrupt_state;
+
+    if(0u != size)
+    {
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+        cache_add_range(cache, addr, addr + size);
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_rows_touched
+********************************************************************************
+*
+* Summary:
+* Returns the number of Em_EEPROM row writes issued by the cache since
+* initialization. Compare it with the number of flushes to tune the layout.
+*
+* Parameters:
+* const eeprom_cache_t *cache: cache instance.
+*
+* Return: uint32_t
+*
+*******************************************************************************/
+uint32_t eeprom_cache_rows_touched(const eeprom_cache_t *cache)
+{
+    return cache->rows_touched;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_is_dirty
+********************************************************************************
+*
+* Summary:
+* Checks whether the cache holds data that is not yet written to flash.
+*
+* Parameters:
+* const eeprom_cache_t *cache: cache instance.
+*
+* Return: bool
+*
+*******************************************************************************/
+bool eeprom_cache_is_dirty(const eeprom_cache_t *cache)
+{
+    return ((NULL != cache) && (0u != cache->range_count));
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_enable_brownout_flush
+********************************************************************************
+*
+* Summary:
+* Arms the low-voltage detector so that the cache is flushed when the supply
+* falls below EEPROM_CACHE_LVD_THRESHOLD. Only one cache can be attached to the
+* LVD hook; a later call replaces the earlier one.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance to flush on brown-out.
+*
+* Note: The flush runs in the SRSS interrupt, so BLOCKING_WRITE must be used for
+* the attached Em_EEPROM.
+*
+*******************************************************************************/
+void eeprom_cache_enable_brownout_flush(eeprom_cache_t *cache)
+{
+    const cy_stc_sysint_t lvd_intr_config =
+    {
+        .intrSrc = srss_interrupt_IRQn,
+        .intrPriority = EEPROM_CACHE_LVD_INTR_PRIORITY
+    };
+
+    lvd_cache = cache;
+
+    Cy_LVD_Disable();
+    Cy_LVD_SetThreshold(EEPROM_CACHE_LVD_THRESHOLD);
+    Cy_LVD_SetInterruptConfig(CY_LVD_INTR_FALLING);
+    Cy_LVD_Enable();
+
+    /* The LVD output needs to settle before its interrupt can be trusted. */
+    Cy_SysLib_DelayUs(20u);
+    Cy_LVD_ClearInterrupt();
+    Cy_LVD_SetInterruptMask();
+
+    (void) Cy_SysInt_Init(&lvd_intr_config, cache_lvd_isr);
+    NVIC_ClearPendingIRQ(srss_interrupt_IRQn);
+    NVIC_EnableIRQ(srss_interrupt_IRQn);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_enable_brownout_journal
+********************************************************************************
+*
+* Summary:
+* Arms the low-voltage detector like eeprom_cache_enable_brownout_flush(), but
+* the interrupt saves the dirty ranges to an emergency journal with one row
+* program instead of writing them to the Em_EEPROM, which needs less hold-up
+* time. The cache is flushed if the journal cannot take the ranges. The
+* ranges stay dirty, so a flush after the supply recovered writes them and
+* erases the journal.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance to save on brown-out.
+* eeprom_journal_t *journal: journal of the Em_EEPROM instance of the cache.
+*
+*******************************************************************************/
+void eeprom_cache_enable_brownout_journal(eeprom_cache_t *cache, eeprom_journal_t *journal)
+{
+    lvd_journal = journal;
+    eeprom_cache_enable_brownout_flush(cache);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_enable_deepsleep_flush
+********************************************************************************
+*
+* Summary:
+* Registers a SysPm callback that flushes the cache before the CPU enters Deep
+* Sleep, so that the writes deferred while the device is awake reach the
+* flash in one burst. The transition is refused while the cache stays dirty,
+* which happens when a flush fails or another one is in progress. Only one
+* cache can be attached; calling it again attaches the new cache and keeps
+* the callback registered once.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance to flush.
+*
+* Note: The flush runs in the context that requests Deep Sleep, so
+* BLOCKING_WRITE must be used for the attached Em_EEPROM. Writes that must be
+* durable before that still need eeprom_cache_flush().
+*
+*******************************************************************************/
+void eeprom_cache_enable_deepsleep_flush(eeprom_cache_t *cache)
+{
+    syspm_params.context = cache;
+
+    /* Fails harmlessly if the callback is already registered. */
+    (void) Cy_SysPm_RegisterCallback(&syspm_callback);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cache_poll
+********************************************************************************
+*
+* Summary:
+* Flushes the cache once its data has been dirty for
+* EEPROM_CACHE_MAX_STALENESS_MS, which bounds the data lost by a reset without
+* a flush while writes are otherwise deferred to the next Deep Sleep entry.
+* Call it periodically; the age is counted from the first call that sees the
+* cache dirty, so the bound is exceeded by up to one polling period.
+*
+* Parameters:
+* eeprom_cache_t *cache: cache instance.
+* uint32_t now_ms: current time in milliseconds, wrapping around.
+*
+* Return: cy_en_em_eeprom_status_t
+* Status of the flush, CY_EM_EEPROM_SUCCESS if none was due.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_cache_poll(eeprom_cache_t *cache, uint32_t now_ms)
+{
+    if(NULL == cache)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    if(!eeprom_cache_is_dirty(cache))
+    {
+        cache->dirty_seen = false;
+        return CY_EM_EEPROM_SUCCESS;
+    }
+
+    if(!cache->dirty_seen)
+    {
+        cache->dirty_seen = true;
+        cache->dirty_since_ms = now_ms;
+    }
+
+    if((now_ms - cache->dirty_since_ms) < EEPROM_CACHE_MAX_STALENESS_MS)
+    {
+        return CY_EM_EEPROM_SUCCESS;
+    }
+
+    /* Data written from now on starts a new period. */
+    cache->dirty_seen = false;
+
+    return eeprom_cache_flush(cache);
+}
+
+
+/*******************************************************************************
+* Function Name: cache_syspm_callback
+********************************************************************************
+*
+* Summary:
+* Deep Sleep callback. Flushes the attached cache when the transition is
+* checked and fails the check if anything stays dirty.
+*
+*******************************************************************************/
+static cy_en_syspm_status_t cache_syspm_callback(cy_stc_syspm_callback_params_t *params,
+                                                 cy_en_syspm_callback_mode_t mode)
+{
+    eeprom_cache_t *cache = (eeprom_cache_t *) params->context;
+    cy_en_em_eeprom_status_t status;
+
+    if((CY_SYSPM_CHECK_READY != mode) || (NULL == cache))
+    {
+        return CY_SYSPM_SUCCESS;
+    }
+
+    /* An interrupted flush, or the jobs queued by eeprom_async.c, own the
+     * cache.
+     */
+    if(cache->flushing)
+    {
+        return CY_SYSPM_FAIL;
+    }
+
+    status = eeprom_cache_flush(cache);
+    if(((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status)) ||
+       eeprom_cache_is_dirty(cache))
+    {
+        return CY_SYSPM_FAIL;
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: cache_lvd_isr
+********************************************************************************
+*
+* Summary:
+* LVD interrupt handler. The Em_EEPROM middleware and the flash driver are not
+* reentrant, so if the interrupt caught a flash operation of the interrupted
+* context in the middle, the save runs right after that operation instead.
+*
+*******************************************************************************/
+static void cache_lvd_isr(void)
+{
+    if(0u != Cy_LVD_GetInterruptStatus())
+    {
+        Cy_LVD_ClearInterrupt();
+        eeprom_flash_run_or_defer(cache_brownout_save);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: cache_brownout_save
+********************************************************************************
+*
+* Summary:
+* Saves the attached cache to its journal, or flushes it, while the supply
+* still holds up.
+*
+*******************************************************************************/
+static void cache_brownout_save(void)
+{
+    if((NULL != lvd_cache) &&
+       ((NULL == lvd_journal) ||
+        (CY_EM_EEPROM_SUCCESS != cache_save_journal(lvd_cache, lvd_journal))))
+    {
+        (void) eeprom_cache_flush(lvd_cache);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: cache_save_journal
+********************************************************************************
+*
+* Summary:
+* Stages every dirty range of the cache in the journal and programs them with
+* one row program. The dirty ranges are left in place.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t cache_save_journal(eeprom_cache_t *cache,
+                                                   eeprom_journal_t *journal)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+
+    for(uint32_t i = 0u; (i < cache->range_count) && (CY_EM_EEPROM_SUCCESS == status); i++)
+    {
+        status = eeprom_journal_stage(journal, cache->ranges[i].start,
+                                      &cache->image[cache->ranges[i].start - cache->base],
+                                      cache->ranges[i].end - cache->ranges[i].start);
+    }
+
+    if(CY_EM_EEPROM_SUCCESS == status)
+    {
+        status = eeprom_journal_commit(journal);
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: cache_add_range
+********************************************************************************
+*
+* Summary:
+* Inserts [start, end) into the sorted dirty range list. Overlapping and
+* adjacent ranges are merged. If the list is full, the two ranges with the
+* smallest gap are merged; the bytes in the gap are clean copies of flash
+* content, so writing them again is harmless.
+*
+*******************************************************************************/
+static void cache_add_range(eeprom_cache_t *cache, uint32_t start, uint32_t end)
+{
+    uint32_t index;
+    uint32_t smallest_gap;
+    uint32_t merge_index;
+
+    /* Find the first range that ends at or after the new start. */
+    for(index = 0u; index < cache->range_count; index++)
+    {
+        if(cache->ranges[index].end >= start)
+        {
+            break;
+        }
+    }
+
+    if((index < cache->range_count) && (cache->ranges[index].start <= end))
+    {
+        /* Overlapping or adjacent: extend the range in place. */
+        if(start < cache->ranges[index].start)
+        {
+            cache->ranges[index].start = start;
+        }
+        if(end > cache->ranges[index].end)
+        {
+            cache->ranges[index].end = end;
+        }
+    }
+    else
+    {
+        if(EEPROM_CACHE_MAX_RANGES == cache->range_count)
+        {
+            /* Make room by merging the closest neighbours. The new range is
+             * inserted afterwards, so recompute its position.
+             */
+            smallest_gap = UINT32_MAX;
+            merge_index = 0u;
+            for(uint32_t i = 0u; (i + 1u) < cache->range_count; i++)
+            {
+                if((cache->ranges[i + 1u].start - cache->ranges[i].end) < smallest_gap)
+                {
+                    smallest_gap = cache->ranges[i + 1u].start - cache->ranges[i].end;
+                    merge_index = i;
+                }
+            }
+            cache->ranges[merge_index].end = cache->ranges[merge_index + 1u].end;
+            cache_remove_range(cache, merge_index + 1u);
+
+            cache_add_range(cache, start, end);
+            return;
+        }
+
+        memmove(&cache->ranges[index + 1u], &cache->ranges[index],
+                (cache->range_count - index) * sizeof(eeprom_cache_range_t));
+        cache->ranges[index].start = start;
+        cache->ranges[index].end = end;
+        cache->range_count++;
+    }
+
+    /* The extended range may now reach its successors. */
+    while(((index + 1u) < cache->range_count) &&
+          (cache->ranges[index + 1u].start <= cache->ranges[index].end))
+    {
+        if(cache->ranges[index + 1u].end > cache->ranges[index].end)
+        {
+            cache->ranges[index].end = cache->ranges[index + 1u].end;
+        }
+        cache_remove_range(cache, index + 1u);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: cache_remove_range
+********************************************************************************
+*
+* Summary:
+* Removes one entry from the dirty range list.
+*
+*******************************************************************************/
+static void cache_remove_range(eeprom_cache_t *cache, uint32_t index)
+{
+    memmove(&cache->ranges[index], &cache->ranges[index + 1u],
+            (cache->range_count - index - 1u) * sizeof(eeprom_cache_range_t));
+    cache->range_count--;
+}
+
+
+/* [] END OF FILE */
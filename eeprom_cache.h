@@ -0,0 +1,153 @@
+/******************************************************************************
+* File Name: eeprom_cache.h
+*
+* Description: This file contains the interface of the write-back RAM cache
+*              placed in front of the Emulated EEPROM.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_CACHE_H
+#define EEPROM_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+#include "eeprom_journal.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Maximum number of disjoint dirty ranges tracked by one cache. When a new
+ * range does not fit, the two closest ranges are merged so that the cache
+ * never has to flush behind the caller's back.
+ */
+#ifndef EEPROM_CACHE_MAX_RANGES
+#define EEPROM_CACHE_MAX_RANGES         (4u)
+#endif
+
+/* Number of caches that can be attached to Em_EEPROM instances at a time. */
+#ifndef EEPROM_CACHE_MAX_INSTANCES
+#define EEPROM_CACHE_MAX_INSTANCES      (2u)
+#endif
+
+/* Logical bytes stored per Em_EEPROM row. A flush issues one write per row
+ * that holds dirty data. The default matches the normal (non-simple) mode,
+ * which also gives correct, if more, writes in simple mode.
+ */
+#ifndef EEPROM_CACHE_ROW_DATA_SIZE
+#define EEPROM_CACHE_ROW_DATA_SIZE      (CY_EM_EEPROM_EEPROM_DATA_LEN(0u))
+#endif
+
+/* LVD trip point used by the brown-out flush hook. Pick a threshold that leaves
+ * enough hold-up time on the supply to complete one flash row program per
+ * dirty range.
+ */
+#ifndef EEPROM_CACHE_LVD_THRESHOLD
+#define EEPROM_CACHE_LVD_THRESHOLD      (CY_LVD_THRESHOLD_2_8_V)
+#endif
+
+/* Priority of the LVD (SRSS) interrupt used by the brown-out flush hook. */
+#ifndef EEPROM_CACHE_LVD_INTR_PRIORITY
+#define EEPROM_CACHE_LVD_INTR_PRIORITY  (0u)
+#endif
+
+/* Longest time eeprom_cache_poll() lets data stay dirty before it flushes. */
+#ifndef EEPROM_CACHE_MAX_STALENESS_MS
+#define EEPROM_CACHE_MAX_STALENESS_MS   (60000u)
+#endif
+
+/* Position of the Deep Sleep flush among the SysPm callbacks. */
+#ifndef EEPROM_CACHE_SYSPM_ORDER
+#define EEPROM_CACHE_SYSPM_ORDER        (0u)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Half-open dirty byte range [start, end) in Em_EEPROM logical addresses. */
+typedef struct
+{
+    uint32_t start;
+    uint32_t end;
+} eeprom_cache_range_t;
+
+/* Write-back cache of the logical window [base, base + size). */
+typedef struct
+{
+    cy_stc_eeprom_context_t *context;
+    uint8_t *image;
+    uint32_t base;
+    uint32_t size;
+    uint32_t range_count;
+    eeprom_cache_range_t ranges[EEPROM_CACHE_MAX_RANGES];
+    uint32_t rows_touched;
+    volatile bool flushing;
+    /* Time eeprom_cache_poll() first saw the current dirty data. */
+    uint32_t dirty_since_ms;
+    bool dirty_seen;
+} eeprom_cache_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_cache_init(eeprom_cache_t *cache,
+                                           cy_stc_eeprom_context_t *context,
+                                           uint32_t base, uint8_t *image,
+                                           uint32_t size);
+eeprom_cache_t *eeprom_cache_find(const cy_stc_eeprom_context_t *context);
+cy_en_em_eeprom_status_t eeprom_cache_read(eeprom_cache_t *cache, uint32_t addr,
+                                           void *data, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_cache_write(eeprom_cache_t *cache, uint32_t addr,
+                                            const void *data, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_cache_flush(eeprom_cache_t *cache);
+bool eeprom_cache_begin_flush(eeprom_cache_t *cache);
+cy_en_em_eeprom_status_t eeprom_cache_end_flush(eeprom_cache_t *cache);
+bool eeprom_cache_take_row(eeprom_cache_t *cache, eeprom_cache_range_t *range);
+void eeprom_cache_mark_dirty(eeprom_cache_t *cache, uint32_t addr, uint32_t size);
+uint32_t eeprom_cache_rows_touched(const eeprom_cache_t *cache);
+bool eeprom_cache_is_dirty(const eeprom_cache_t *cache);
+void eeprom_cache_enable_brownout_flush(eeprom_cache_t *cache);
+void eeprom_cache_enable_brownout_journal(eeprom_cache_t *cache, eeprom_journal_t *journal);
+void eeprom_cache_enable_deepsleep_flush(eeprom_cache_t *cache);
+cy_en_em_eeprom_status_t eeprom_cache_poll(eeprom_cache_t *cache, uint32_t now_ms);
+
+#endif /* EEPROM_CACHE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,291 @@
+/******************************************************************************
+* File Name: eeprom_counter.c
+*
+* Description: This file implements a 64-bit monotonic counter with unary
+*              encoding. Each row holds a base value followed by a bit field.
+*              An increment programs the next bit of the field without erasing the
+*              row; the row is only erased once per EEPROM_COUNTER_BITS_PER_ROW
+*              increments, when the count moves to the other row.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "eeprom_counter.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define COUNTER_BASE_LOW        (0u)
+#define COUNTER_BASE_HIGH       (1u)
+#define COUNTER_BASE_LOW_INV    (2u)
+#define COUNTER_BASE_HIGH_INV   (3u)
+
+#define COUNTER_ROW_ADDR(counter, index) ((counter)->area + ((index) * EEPROM_FLASH_ROW_SIZE))
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static bool counter_parse_row(uint32_t row_addr, uint64_t *base, uint32_t *used);
+static cy_en_flashdrv_status_t counter_start_row(eeprom_counter_t *counter,
+                                                 uint32_t index, uint64_t base);
+
+
+/*******************************************************************************
+* Function Name: eeprom_counter_init
+********************************************************************************
+*
+* Summary:
+* Restores the counter from its two rows. The row a rollover leaves behind
+* stays valid until the next rollover erases it, so if both rows are valid, the
+* one with the higher value is used. If neither is valid, the counter starts
+* at zero.
+*
+* Parameters:
+* eeprom_counter_t *counter: counter instance to initialize.
+* uint32_t area: row-aligned flash address of EEPROM_COUNTER_AREA_SIZE bytes.
+*
+* Return: cy_en_flashdrv_status_t
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t eeprom_counter_init(eeprom_counter_t *counter, uint32_t area)
+{
+    uint64_t base[2];
+    uint32_t used[2];
+    bool valid[2];
+    uint32_t index;
+
+    if((NULL == counter) || (0u != (area % EEPROM_FLASH_ROW_SIZE)))
+    {
+        return CY_FLASH_DRV_INVALID_INPUT_PARAMETERS;
+    }
+
+    counter->area = area;
+    counter->active = 0u;
+    counter->base = 0u;
+    counter->used = 0u;
+
+    valid[0] = counter_parse_row(COUNTER_ROW_ADDR(counter, 0u), &base[0], &used[0]);
+    valid[1] = counter_parse_row(COUNTER_ROW_ADDR(counter, 1u), &base[1], &used[1]);
+
+    if(!valid[0] && !valid[1])
+    {
+        return counter_start_row(counter, 0u, 0u);
+    }
+
+    if(valid[0] && valid[1])
+    {
+        /* A rollover starts the new row at the value of the old row plus
+         * one, so the new row holds the higher value. A row whose header a
+         * power loss left incomplete is not valid.
+         */
+        index = (((base[1] + used[1]) > (base[0] + used[0])) ||
+                 (((base[1] + used[1]) == (base[0] + used[0])) && (base[1] > base[0]))) ? 1u : 0u;
+    }
+    else
+    {
+        index = valid[1] ? 1u : 0u;
+    }
+
+    counter->active = index;
+    counter->base = base[index];
+    counter->used = used[index];
+    memcpy(counter->row, (const void *) COUNTER_ROW_ADDR(counter, index), EEPROM_FLASH_ROW_SIZE);
+
+    return CY_FLASH_DRV_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_counter_get
+********************************************************************************
+*
+* Summary:
+* Returns the current counter value. Callers of a 32-bit counter use the low
+* word.
+*
+* Parameters:
+* const eeprom_counter_t *counter: counter instance.
+*
+* Return: uint64_t
+*
+*******************************************************************************/
+uint64_t eeprom_counter_get(const eeprom_counter_t *counter)
+{
+    return counter->base + counter->used;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_counter_increment
+********************************************************************************
+*
+* Summary:
+* Increments the counter by one. Normally this programs one more bit of the
+* active row without an erase. When the row is full, the other row is erased
+* and started with the incremented value as its base.
+*
+* Parameters:
+* eeprom_counter_t *counter: counter instance.
+*
+* Return: cy_en_flashdrv_status_t
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t eeprom_counter_increment(eeprom_counter_t *counter)
+{
+    cy_en_flashdrv_status_t status;
+    uint32_t word;
+    uint32_t mask;
+
+    /* A row filled under a higher EEPROM_FLASH_MAX_PROGRAMS is full as well. */
+    if(counter->used >= EEPROM_COUNTER_BITS_PER_ROW)
+    {
+        return counter_start_row(counter, counter->active ^ 1u,
+                                 counter->base + counter->used + 1u);
+    }
+
+    /* Flip the first bit still in its erased state. The bits are normally
+     * used in order, but a bit the flash lost or gained must not make the
+     * program repeat a bit that is already set. Fewer bits than the field
+     * holds are set, so one is left.
+     */
+    word = EEPROM_COUNTER_HEADER_WORDS;
+    while((EEPROM_FLASH_ERASED_WORD ^ counter->row[word]) == 0xFFFFFFFFuL)
+    {
+        word++;
+    }
+    mask = (EEPROM_FLASH_ERASED_WORD ^ counter->row[word]) + 1u;
+    mask &= ~(EEPROM_FLASH_ERASED_WORD ^ counter->row[word]);
+    counter->row[word] ^= mask;
+
+    status = eeprom_flash_program_row(COUNTER_ROW_ADDR(counter, counter->active), counter->row);
+
+    if(CY_FLASH_DRV_SUCCESS == status)
+    {
+        counter->used++;
+    }
+    else
+    {
+        counter->row[word] ^= mask;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: counter_parse_row
+********************************************************************************
+*
+* Summary:
+* Checks the header of a row and counts the programmed bits of its field. An
+* erased row fails the header check because its complement words do not
+* match.
+*
+*******************************************************************************/
+static bool counter_parse_row(uint32_t row_addr, uint64_t *base, uint32_t *used)
+{
+    const uint32_t *row = (const uint32_t *) row_addr;
+    uint32_t bits = 0u;
+    uint32_t word;
+
+    if((row[COUNTER_BASE_LOW_INV] != ~row[COUNTER_BASE_LOW]) ||
+       (row[COUNTER_BASE_HIGH_INV] != ~row[COUNTER_BASE_HIGH]))
+    {
+        return false;
+    }
+
+    for(uint32_t i = EEPROM_COUNTER_HEADER_WORDS; i < EEPROM_FLASH_ROW_WORDS; i++)
+    {
+        /* Count programmed bits, relative to the erased value. */
+        word = row[i] ^ EEPROM_FLASH_ERASED_WORD;
+        while(0u != word)
+        {
+            word &= word - 1u;
+            bits++;
+        }
+    }
+
+    *base = ((uint64_t) row[COUNTER_BASE_HIGH] << 32u) | row[COUNTER_BASE_LOW];
+    *used = bits;
+
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: counter_start_row
+********************************************************************************
+*
+* Summary:
+* Erases a row and programs its header with a new base value. The previous row
+* is left as it is, so a reset during the operation keeps the old value.
+*
+*******************************************************************************/
+static cy_en_flashdrv_status_t counter_start_row(eeprom_counter_t *counter,
+                                                 uint32_t index, uint64_t base)
+{
+    cy_en_flashdrv_status_t status;
+
+    memset(counter->row, EEPROM_FLASH_ERASED_VALUE, sizeof(counter->row));
+    counter->row[COUNTER_BASE_LOW] = (uint32_t) base;
+    counter->row[COUNTER_BASE_HIGH] = (uint32_t) (base >> 32u);
+    counter->row[COUNTER_BASE_LOW_INV] = ~counter->row[COUNTER_BASE_LOW];
+    counter->row[COUNTER_BASE_HIGH_INV] = ~counter->row[COUNTER_BASE_HIGH];
+
+    status = eeprom_flash_write_row(COUNTER_ROW_ADDR(counter, index), counter->row);
+
+    if(CY_FLASH_DRV_SUCCESS == status)
+    {
+        counter->active = index;
+        counter->base = base;
+        counter->used = 0u;
+    }
+    else
+    {
+        /* Keep programming the previous row. */
+        memcpy(counter->row, (const void *) COUNTER_ROW_ADDR(counter, counter->active),
+               EEPROM_FLASH_ROW_SIZE);
+    }
+
+    return status;
+}
+
+
+/* [] END OF FILE */
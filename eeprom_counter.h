@@ -0,0 +1,98 @@
+/******************************************************************************
+* File Name: eeprom_counter.h
+*
+* Description: This file contains the interface of the wear-aware monotonic
+*              counter stored in two dedicated flash rows.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_COUNTER_H
+#define EEPROM_COUNTER_H
+
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "eeprom_flash.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Flash needed by one counter: two rows used alternately. Place the area on a
+ * row boundary.
+ */
+#define EEPROM_COUNTER_AREA_SIZE        (2u * EEPROM_FLASH_ROW_SIZE)
+
+/* Words at the start of each row holding the base value and its complement. */
+#define EEPROM_COUNTER_HEADER_WORDS     (4u)
+
+/* Bits of the field following the header of a row. */
+#define EEPROM_COUNTER_FIELD_BITS       ((EEPROM_FLASH_ROW_WORDS - EEPROM_COUNTER_HEADER_WORDS) * 32u)
+
+/* Increments recorded in one row before it has to be erased. Each of them
+ * programs the row once more after the header, so the count is capped by
+ * EEPROM_FLASH_MAX_PROGRAMS rather than by the size of the field. An increment
+ * cut by a power loss before its bit is set leaves no trace in the row, so
+ * each such power loss may add one program to the row.
+ */
+#define EEPROM_COUNTER_BITS_PER_ROW     \
+    ((EEPROM_COUNTER_FIELD_BITS < (EEPROM_FLASH_MAX_PROGRAMS - 1u)) ? \
+     EEPROM_COUNTER_FIELD_BITS : (EEPROM_FLASH_MAX_PROGRAMS - 1u))
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t area;
+    uint32_t active;
+    uint64_t base;
+    uint32_t used;
+    uint32_t row[EEPROM_FLASH_ROW_WORDS];
+} eeprom_counter_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_flashdrv_status_t eeprom_counter_init(eeprom_counter_t *counter, uint32_t area);
+uint64_t eeprom_counter_get(const eeprom_counter_t *counter);
+cy_en_flashdrv_status_t eeprom_counter_increment(eeprom_counter_t *counter);
+
+#endif /* EEPROM_COUNTER_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,246 @@
+/******************************************************************************
+* File Name: eeprom_crc.c
+*
+* Description: This file implements a table-driven CRC-32 routine. A nibble
+*              table is used to keep the flash footprint small. On devices
+*              with the Crypto block, the CRC can run on its CRC unit instead.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdbool.h>
+#include "cy_pdl.h"
+#include "eeprom_crc.h"
+#if EEPROM_CRC_HW
+#include "cyhal.h"
+#endif
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t crc_software(uint32_t crc, const uint8_t *byte, uint32_t size);
+#if EEPROM_CRC_HW
+static bool crc_hardware(uint32_t *crc, const uint8_t *byte, uint32_t size);
+#endif
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* CRC-32 of every nibble value, polynomial 0xEDB88320. */
+static const uint32_t crc32_nibble_table[16] =
+{
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+    0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+#if EEPROM_CRC_HW
+static cyhal_crc_t crc_unit;
+static bool crc_unit_ready = false;
+/* Set while a computation owns the CRC unit. A computation that preempts it
+ * falls back to software.
+ */
+static volatile bool crc_unit_busy = false;
+#endif
+static eeprom_crc_backend_t crc_backend = EEPROM_CRC_SOFTWARE;
+
+
+/*******************************************************************************
+* Function Name: eeprom_crc_select
+********************************************************************************
+*
+* Summary:
+* Selects the implementation used by eeprom_crc32_update(). The hardware
+* backend is checked against the software implementation once; if the CRC
+* unit cannot be reserved or disagrees, the software implementation stays
+* selected. Both produce the same CRC, so the selection can change at any
+* time without invalidating stored CRCs.
+*
+* Parameters:
+* eeprom_crc_backend_t backend: requested implementation.
+*
+* Return: eeprom_crc_backend_t
+* Implementation in use.
+*
+*******************************************************************************/
+eeprom_crc_backend_t eeprom_crc_select(eeprom_crc_backend_t backend)
+{
+    crc_backend = EEPROM_CRC_SOFTWARE;
+
+#if EEPROM_CRC_HW
+    if(EEPROM_CRC_HARDWARE == backend)
+    {
+        if(!crc_unit_ready)
+        {
+            crc_unit_ready = (CY_RSLT_SUCCESS == cyhal_crc_init(&crc_unit));
+        }
+
+        if(crc_unit_ready)
+        {
+            static const uint8_t check[] = "123456789";
+            uint32_t whole = 0u;
+            uint32_t split = 0u;
+
+            /* Whole and continued computations both have to match. */
+            if(crc_hardware(&whole, check, sizeof(check) - 1u) &&
+               crc_hardware(&split, check, 4u) &&
+               crc_hardware(&split, &check[4], sizeof(check) - 5u) &&
+               (crc_software(0u, check, sizeof(check) - 1u) == whole) && (whole == split))
+            {
+                crc_backend = EEPROM_CRC_HARDWARE;
+            }
+        }
+    }
+#else
+    (void) backend;
+#endif
+
+    return crc_backend;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_crc32_update
+********************************************************************************
+*
+* Summary:
+* Continues a CRC-32 computation over size bytes of data with the backend
+* chosen by eeprom_crc_select(), software by default.
+*
+* Parameters:
+* uint32_t crc: CRC of the preceding data, or 0 for the first piece.
+* const void *data: data to process.
+* uint32_t size: number of bytes.
+*
+* Return: uint32_t
+* CRC-32 of the preceding data followed by this piece.
+*
+*******************************************************************************/
+uint32_t eeprom_crc32_update(uint32_t crc, const void *data, uint32_t size)
+{
+#if EEPROM_CRC_HW
+    if((EEPROM_CRC_HARDWARE == crc_backend) && (size >= EEPROM_CRC_HW_MIN_SIZE) &&
+       crc_hardware(&crc, (const uint8_t *) data, size))
+    {
+        return crc;
+    }
+#endif
+
+    return crc_software(crc, (const uint8_t *) data, size);
+}
+
+
+/*******************************************************************************
+* Function Name: crc_software
+********************************************************************************
+*
+* Summary:
+* Table-driven CRC-32, one nibble per lookup.
+*
+*******************************************************************************/
+static uint32_t crc_software(uint32_t crc, const uint8_t *byte, uint32_t size)
+{
+    crc = ~crc;
+
+    while(0u != size)
+    {
+        crc ^= *byte++;
+        crc = (crc >> 4u) ^ crc32_nibble_table[crc & 0x0Fu];
+        crc = (crc >> 4u) ^ crc32_nibble_table[crc & 0x0Fu];
+        size--;
+    }
+
+    return ~crc;
+}
+
+
+#if EEPROM_CRC_HW
+/*******************************************************************************
+* Function Name: crc_hardware
+********************************************************************************
+*
+* Summary:
+* Continues the CRC on the CRC unit. The unit shifts MSB first, so the
+* reflected CRC of the preceding data is turned into its seed.
+*
+* Return: bool
+* false if the unit is in use or reports an error; crc is unchanged then.
+*
+*******************************************************************************/
+static bool crc_hardware(uint32_t *crc, const uint8_t *byte, uint32_t size)
+{
+    crc_algorithm_t algorithm =
+    {
+        .width = 32u,
+        .polynomial = 0x04C11DB7u,
+        .lfsrInitState = __RBIT(~(*crc)),
+        .dataReverse = 1u,
+        .dataXor = 0u,
+        .remReverse = 1u,
+        .remXor = 0xFFFFFFFFu,
+    };
+    uint32_t interrupt_state;
+    uint32_t result = 0u;
+    bool done;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    done = !crc_unit_busy;
+    crc_unit_busy = true;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+    if(!done)
+    {
+        return false;
+    }
+
+    done = (CY_RSLT_SUCCESS == cyhal_crc_start(&crc_unit, &algorithm)) &&
+           (CY_RSLT_SUCCESS == cyhal_crc_compute(&crc_unit, byte, size)) &&
+           (CY_RSLT_SUCCESS == cyhal_crc_finish(&crc_unit, &result));
+    crc_unit_busy = false;
+
+    if(done)
+    {
+        *crc = result;
+    }
+    return done;
+}
+#endif
+
+
+/* [] END OF FILE */
@@ -0,0 +1,95 @@
+/******************************************************************************
+* File Name: eeprom_crc.h
+*
+* Description: This file contains the interface of the CRC-32 routine used
+*              to validate the records kept by the Emulated EEPROM helpers.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_CRC_H
+#define EEPROM_CRC_H
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Build the hardware backend, which runs the CRC on the CRC unit of the
+ * Crypto block through the HAL. Devices without the Crypto block always use
+ * the software implementation.
+ */
+#ifndef EEPROM_CRC_HW
+#if defined(CY_IP_MXCRYPTO)
+#define EEPROM_CRC_HW                   (1u)
+#else
+#define EEPROM_CRC_HW                   (0u)
+#endif
+#endif
+
+/* Pieces shorter than this are computed in software even with the hardware
+ * backend, they take less time than setting the CRC unit up.
+ */
+#ifndef EEPROM_CRC_HW_MIN_SIZE
+#define EEPROM_CRC_HW_MIN_SIZE          (64u)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef enum
+{
+    EEPROM_CRC_SOFTWARE,
+    EEPROM_CRC_HARDWARE,
+} eeprom_crc_backend_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+eeprom_crc_backend_t eeprom_crc_select(eeprom_crc_backend_t backend);
+
+/* CRC-32 (IEEE 802.3, reflected, polynomial 0xEDB88320). Start with crc = 0
+ * and feed the data in any number of pieces; the returned value is the final
+ * CRC of all data seen so far.
+ */
+uint32_t eeprom_crc32_update(uint32_t crc, const void *data, uint32_t size);
+
+#endif /* EEPROM_CRC_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,100 @@
+/******************************************************************************
+* File Name: eeprom_cycles.h
+*
+* Description: This file contains helpers to measure execution time with the
+*              DWT cycle counter of the CM4 CPU.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_CYCLES_H
+#define EEPROM_CYCLES_H
+
+#include <stdint.h>
+#include "cy_pdl.h"
+
+
+/*******************************************************************************
+* Function Name: eeprom_cycles_init
+********************************************************************************
+*
+* Summary:
+* Enables the DWT cycle counter. A running counter is left alone, so that the
+* trace timestamps stay monotonic when several modules call it.
+*
+*******************************************************************************/
+__STATIC_INLINE void eeprom_cycles_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    if(0u == (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        DWT->CYCCNT = 0u;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cycles_now
+********************************************************************************
+*
+* Summary:
+* Returns the current value of the cycle counter. The difference of two values
+* is correct across one counter wrap-around.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t eeprom_cycles_now(void)
+{
+    return DWT->CYCCNT;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_cycles_to_us
+********************************************************************************
+*
+* Summary:
+* Converts a number of CPU cycles to microseconds.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t eeprom_cycles_to_us(uint32_t cycles)
+{
+    return (uint32_t) (((uint64_t) cycles * 1000000u) / SystemCoreClock);
+}
+
+#endif /* EEPROM_CYCLES_H */
+
+/* [] END OF FILE */
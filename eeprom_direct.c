@@ -0,0 +1,262 @@
+/******************************************************************************
+* File Name: eeprom_direct.c
+*
+* Description: This file implements a zero-copy read of the Emulated EEPROM.
+*              Flash is memory-mapped, so when the current value of a logical
+*              range is stored contiguously in one row, a pointer into the
+*              Em_EEPROM area is returned instead of copying the data.
+*              Otherwise the data is copied to a caller-provided buffer with
+*              Cy_Em_EEPROM_Read().
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_area.h"
+#include "eeprom_cache.h"
+#include "eeprom_direct.h"
+#include "eeprom_io.h"
+#include "eeprom_relocate.h"
+#include "eeprom_status.h"
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static const uint8_t *direct_map_rows(const cy_stc_eeprom_config_t *config,
+                                      const cy_stc_eeprom_context_t *context,
+                                      uint32_t addr, uint32_t size);
+
+
+/*******************************************************************************
+* Function Name: eeprom_direct_read
+********************************************************************************
+*
+* Summary:
+* Returns a pointer to size bytes at logical address addr. A lazily
+* initialized instance is initialized first. If eeprom_direct_map() finds the
+* current value of the range in one row, *data points into the Em_EEPROM area
+* and nothing is copied. Otherwise the range is copied to the fallback buffer
+* and *data points to it.
+*
+* Parameters:
+* const cy_stc_eeprom_config_t *config: Em_EEPROM configuration.
+* cy_stc_eeprom_context_t *context: Em_EEPROM context.
+* uint32_t addr: logical Em_EEPROM address.
+* uint32_t size: number of bytes.
+* uint8_t *fallback: buffer of at least size bytes, used when the range is not
+* mapped. Can be NULL if the caller only accepts zero-copy reads.
+* const uint8_t **data: returned pointer to the data.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_BAD_PARAM if the range is not mapped and no fallback buffer is
+* given. EEPROM_STATUS_BUSY if the write-back cache of the instance holds data
+* that is not in flash yet; flush it and read again.
+*
+* Note: The read bypasses the write-back cache, so it is refused while the
+* cache is dirty or a flush is in progress, instead of returning stale data.
+* A pointer into flash stays valid only until the next write to the
+* Em_EEPROM.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_direct_read(const cy_stc_eeprom_config_t *config,
+                                            cy_stc_eeprom_context_t *context,
+                                            uint32_t addr, uint32_t size,
+                                            uint8_t *fallback,
+                                            const uint8_t **data)
+{
+    const eeprom_cache_t *cache;
+    const uint8_t *mapped;
+    cy_en_em_eeprom_status_t status;
+
+    if((NULL == config) || (NULL == context) || (NULL == data) ||
+       (addr > config->eepromSize) || (size > (config->eepromSize - addr)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    cache = eeprom_cache_find(context);
+    if((NULL != cache) && (cache->flushing || eeprom_cache_is_dirty(cache)))
+    {
+        return EEPROM_STATUS_BUSY;
+    }
+
+    status = eeprom_io_ready(context);
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+
+    mapped = eeprom_direct_map(config, context, addr, size);
+    if(NULL != mapped)
+    {
+        *data = mapped;
+        return status;
+    }
+
+    if(NULL == fallback)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    *data = fallback;
+
+    return eeprom_status_combine(status, eeprom_io_read(addr, fallback, size, context));
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_direct_map
+********************************************************************************
+*
+* Summary:
+* Finds the current value of a logical range in flash. In simple mode, the
+* logical data is stored as-is from the start of the area, so any range maps
+* to one contiguous flash range. In the normal mode, the range must lie within
+* one row of logical data and is found in the row written last for it, see
+* direct_map_rows(). An instance with hot blocks relocated to another instance
+* is never mapped.
+*
+* Parameters:
+* const cy_stc_eeprom_config_t *config: Em_EEPROM configuration.
+* const cy_stc_eeprom_context_t *context: initialized Em_EEPROM context.
+* uint32_t addr: logical Em_EEPROM address.
+* uint32_t size: number of bytes.
+*
+* Return: const uint8_t *
+* The data in flash, or NULL if it has to be read with Cy_Em_EEPROM_Read().
+*
+*******************************************************************************/
+const uint8_t *eeprom_direct_map(const cy_stc_eeprom_config_t *config,
+                                 const cy_stc_eeprom_context_t *context,
+                                 uint32_t addr, uint32_t size)
+{
+    if((0u == size) || (NULL != eeprom_relocate_find(context)))
+    {
+        return NULL;
+    }
+
+    if(0u != config->simpleMode)
+    {
+        return (const uint8_t *) (config->userFlashStartAddr + addr);
+    }
+
+    return direct_map_rows(config, context, addr, size);
+}
+
+
+/*******************************************************************************
+* Function Name: direct_map_rows
+********************************************************************************
+*
+* Summary:
+* Maps a range of the normal mode, which keeps a current copy of each row of
+* logical data in the row written last for it (eeprom_area.h). That row is
+* found by walking back from context->ptrLastWrittenRow. The rows written
+* after it record the data of their own writes only in their first half, so
+* the range is mapped only if none of those writes overlaps it. With the
+* redundant copy, the range must read the same in both copies; the row
+* checksums are left to Cy_Em_EEPROM_Read(), which picks the valid copy when
+* they differ. Without it, the range is not checked, as in simple mode.
+*
+*******************************************************************************/
+static const uint8_t *direct_map_rows(const cy_stc_eeprom_config_t *config,
+                                      const cy_stc_eeprom_context_t *context,
+                                      uint32_t addr, uint32_t size)
+{
+    const uint32_t row_data = CY_EM_EEPROM_EEPROM_DATA_LEN(0u);
+    uint32_t data_rows = eeprom_area_data_rows(config);
+    uint32_t ring_rows = eeprom_area_ring_rows(config);
+    uint32_t head_addr = (uint32_t) context->ptrLastWrittenRow;
+    uint32_t logical_row = addr / row_data;
+    uint32_t head_index;
+    uint32_t head_seq;
+    uint32_t distance;
+    uint32_t row_addr = head_addr;
+    const uint8_t *mapped;
+
+    if((logical_row != ((addr + size - 1u) / row_data)) || (0u == ring_rows) ||
+       (head_addr < config->userFlashStartAddr) ||
+       (head_addr >= (config->userFlashStartAddr + (ring_rows * CY_EM_EEPROM_FLASH_SIZEOF_ROW))) ||
+       (0u != ((head_addr - config->userFlashStartAddr) % CY_EM_EEPROM_FLASH_SIZEOF_ROW)))
+    {
+        return NULL;
+    }
+
+    head_index = (head_addr - config->userFlashStartAddr) / CY_EM_EEPROM_FLASH_SIZEOF_ROW;
+    head_seq = eeprom_area_word(head_addr, EEPROM_AREA_SEQ_OFFSET);
+    distance = ((head_seq % data_rows) + data_rows - logical_row) % data_rows;
+
+    for(uint32_t back = 0u; back <= distance; back++)
+    {
+        row_addr = config->userFlashStartAddr +
+                   (((head_index + ring_rows - back) % ring_rows) * CY_EM_EEPROM_FLASH_SIZEOF_ROW);
+
+        /* A gap in the sequence, such as on a new area, leaves it to the
+         * middleware.
+         */
+        if(eeprom_area_word(row_addr, EEPROM_AREA_SEQ_OFFSET) != (head_seq - back))
+        {
+            return NULL;
+        }
+
+        if(back < distance)
+        {
+            uint32_t written = eeprom_area_word(row_addr, EEPROM_AREA_ADDR_OFFSET);
+            uint32_t length = eeprom_area_word(row_addr, EEPROM_AREA_LEN_OFFSET);
+
+            if((0u != length) && (written < (addr + size)) && (addr < (written + length)))
+            {
+                return NULL;
+            }
+        }
+    }
+
+    mapped = (const uint8_t *) (row_addr + EEPROM_AREA_DATA_OFFSET + (addr % row_data));
+
+    if((0u != config->redundantCopy) &&
+       (0 != memcmp(mapped, mapped + (ring_rows * CY_EM_EEPROM_FLASH_SIZEOF_ROW), size)))
+    {
+        return NULL;
+    }
+
+    return mapped;
+}
+
+
+/* [] END OF FILE */
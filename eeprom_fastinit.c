@@ -0,0 +1,293 @@
+/******************************************************************************
+* File Name: eeprom_fastinit.c
+*
+* Description: This file implements a fast path for Cy_Em_EEPROM_Init().
+*              After every write, a snapshot of the Em_EEPROM context and the CRCs
+*              of the head row and of the row written next are kept in the backup
+*              registers. On the next start-up, only these two rows are validated
+*              instead of scanning the whole Em_EEPROM area. Any mismatch falls
+*              back to Cy_Em_EEPROM_Init().
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_area.h"
+#include "eeprom_crc.h"
+#include "eeprom_fastinit.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define FASTINIT_MAGIC          (0x45454632u) /* "EEF2" */
+
+#define FASTINIT_WORD_MAGIC     (0u)
+#define FASTINIT_WORD_CONFIG    (1u)
+#define FASTINIT_WORD_INDEX     (2u)
+#define FASTINIT_WORD_HEAD      (3u)
+#define FASTINIT_WORD_NEXT      (4u)
+#define FASTINIT_WORD_CHECK     (5u)
+
+_Static_assert((FASTINIT_WORD_CHECK + 1u) == EEPROM_FASTINIT_HINT_WORDS,
+               "Fast initialization hint layout does not match its size");
+_Static_assert((EEPROM_FASTINIT_BREG_INDEX + EEPROM_FASTINIT_HINT_WORDS) <= SRSS_BACKUP_NUM_BREG,
+               "Fast initialization hint does not fit in the backup registers");
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static bool fastinit_locate_rows(const cy_stc_eeprom_config_t *config, uint32_t head_index,
+                                 uint32_t *head_row, uint32_t *next_row);
+static void fastinit_build_context(const cy_stc_eeprom_config_t *config, uint32_t head_row,
+                                   cy_stc_eeprom_context_t *context);
+static uint32_t fastinit_row_crc(uint32_t row_addr);
+
+
+/*******************************************************************************
+* Function Name: eeprom_fastinit_init
+********************************************************************************
+*
+* Summary:
+* Initializes the Em_EEPROM context. If the hint in the backup registers
+* matches the configuration and the CRCs of the head row and the next row, the
+* context is built from the configuration and the head row of the hint.
+* Otherwise Cy_Em_EEPROM_Init() scans the whole area and a new hint is stored.
+*
+* Parameters:
+* const cy_stc_eeprom_config_t *config: Em_EEPROM configuration.
+* cy_stc_eeprom_context_t *context: context to initialize.
+* bool *fast_path: set to true if the hint was used, can be NULL.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_fastinit_init(const cy_stc_eeprom_config_t *config,
+                                              cy_stc_eeprom_context_t *context,
+                                              bool *fast_path)
+{
+    uint32_t hint[EEPROM_FASTINIT_HINT_WORDS];
+    cy_en_em_eeprom_status_t status;
+    uint32_t head_row;
+    uint32_t next_row;
+    bool valid = false;
+
+    if(NULL != fast_path)
+    {
+        *fast_path = false;
+    }
+
+    if((NULL == config) || (NULL == context))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    for(uint32_t i = 0u; i < EEPROM_FASTINIT_HINT_WORDS; i++)
+    {
+        hint[i] = BACKUP_BREG[EEPROM_FASTINIT_BREG_INDEX + i];
+    }
+
+    valid = (FASTINIT_MAGIC == hint[FASTINIT_WORD_MAGIC]) &&
+            (hint[FASTINIT_WORD_CHECK] ==
+             eeprom_crc32_update(0u, hint, FASTINIT_WORD_CHECK * sizeof(uint32_t))) &&
+            (hint[FASTINIT_WORD_CONFIG] == eeprom_crc32_update(0u, config, sizeof(*config))) &&
+            fastinit_locate_rows(config, hint[FASTINIT_WORD_INDEX], &head_row, &next_row) &&
+            (hint[FASTINIT_WORD_HEAD] == fastinit_row_crc(head_row)) &&
+            (hint[FASTINIT_WORD_NEXT] == fastinit_row_crc(next_row));
+
+    if(valid)
+    {
+        fastinit_build_context(config, head_row, context);
+        if(NULL != fast_path)
+        {
+            *fast_path = true;
+        }
+        return CY_EM_EEPROM_SUCCESS;
+    }
+
+    status = Cy_Em_EEPROM_Init(config, context);
+
+    if((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status))
+    {
+        eeprom_fastinit_update(config, context);
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_fastinit_update
+********************************************************************************
+*
+* Summary:
+* Stores a new hint. Call it after every successful Em_EEPROM write.
+*
+* Parameters:
+* const cy_stc_eeprom_config_t *config: Em_EEPROM configuration.
+* const cy_stc_eeprom_context_t *context: initialized context.
+*
+*******************************************************************************/
+void eeprom_fastinit_update(const cy_stc_eeprom_config_t *config,
+                            const cy_stc_eeprom_context_t *context)
+{
+    uint32_t hint[EEPROM_FASTINIT_HINT_WORDS];
+    uint32_t head_index;
+    uint32_t head_row;
+    uint32_t next_row;
+
+    if((NULL == config) || (NULL == context))
+    {
+        return;
+    }
+
+    /* An address below the area wraps to an index that is out of range. */
+    head_index = ((uint32_t) context->ptrLastWrittenRow - config->userFlashStartAddr) /
+                 CY_EM_EEPROM_FLASH_SIZEOF_ROW;
+
+    if((0u != (((uint32_t) context->ptrLastWrittenRow - config->userFlashStartAddr) %
+               CY_EM_EEPROM_FLASH_SIZEOF_ROW)) ||
+       !fastinit_locate_rows(config, head_index, &head_row, &next_row))
+    {
+        eeprom_fastinit_invalidate();
+        return;
+    }
+
+    memset(hint, 0, sizeof(hint));
+    hint[FASTINIT_WORD_MAGIC] = FASTINIT_MAGIC;
+    hint[FASTINIT_WORD_CONFIG] = eeprom_crc32_update(0u, config, sizeof(*config));
+    hint[FASTINIT_WORD_INDEX] = head_index;
+    hint[FASTINIT_WORD_HEAD] = fastinit_row_crc(head_row);
+    hint[FASTINIT_WORD_NEXT] = fastinit_row_crc(next_row);
+    hint[FASTINIT_WORD_CHECK] = eeprom_crc32_update(0u, hint,
+                                                    FASTINIT_WORD_CHECK * sizeof(uint32_t));
+
+    /* Write the magic last so that a reset in the middle leaves no valid hint. */
+    for(uint32_t i = EEPROM_FASTINIT_HINT_WORDS; i > 0u; i--)
+    {
+        BACKUP_BREG[EEPROM_FASTINIT_BREG_INDEX + i - 1u] = hint[i - 1u];
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_fastinit_invalidate
+********************************************************************************
+*
+* Summary:
+* Removes the hint. Call it before every Em_EEPROM write so that a reset during
+* the write forces a full scan on the next start-up.
+*
+*******************************************************************************/
+void eeprom_fastinit_invalidate(void)
+{
+    BACKUP_BREG[EEPROM_FASTINIT_BREG_INDEX + FASTINIT_WORD_MAGIC] = 0u;
+}
+
+
+/*******************************************************************************
+* Function Name: fastinit_locate_rows
+********************************************************************************
+*
+* Summary:
+* Finds the head row with the given index from the start of the area and the
+* row that the next write programs. Writes rotate through the ring of rows of
+* the main copy, and the redundant copy, if any, follows the ring
+* (eeprom_area.h), so an index into the redundant copy maps to the same
+* position of the ring.
+*
+*******************************************************************************/
+static bool fastinit_locate_rows(const cy_stc_eeprom_config_t *config, uint32_t head_index,
+                                 uint32_t *head_row, uint32_t *next_row)
+{
+    uint32_t ring_rows = eeprom_area_ring_rows(config);
+
+    if((0u == ring_rows) ||
+       (head_index >= (eeprom_area_size(config) / CY_EM_EEPROM_FLASH_SIZEOF_ROW)))
+    {
+        return false;
+    }
+
+    *head_row = config->userFlashStartAddr + (head_index * CY_EM_EEPROM_FLASH_SIZEOF_ROW);
+    *next_row = config->userFlashStartAddr +
+                ((((head_index % ring_rows) + 1u) % ring_rows) * CY_EM_EEPROM_FLASH_SIZEOF_ROW);
+
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: fastinit_build_context
+********************************************************************************
+*
+* Summary:
+* Sets the fields of the context that Cy_Em_EEPROM_Init() derives from the
+* configuration and from the scan for the last written row.
+*
+*******************************************************************************/
+static void fastinit_build_context(const cy_stc_eeprom_config_t *config, uint32_t head_row,
+                                   cy_stc_eeprom_context_t *context)
+{
+    (void) memset(context, 0, sizeof(*context));
+    context->eepromSize = config->eepromSize;
+    context->numberOfRows = eeprom_area_data_rows(config);
+    context->wearLevelingFactor = config->wearLevelingFactor;
+    context->redundantCopy = config->redundantCopy;
+    context->blockingWrite = config->blockingWrite;
+    context->simpleMode = config->simpleMode;
+    context->userFlashStartAddr = config->userFlashStartAddr;
+    context->ptrLastWrittenRow = (uint32_t *) head_row;
+}
+
+
+/*******************************************************************************
+* Function Name: fastinit_row_crc
+********************************************************************************
+*
+* Summary:
+* Computes the CRC-32 of one flash row.
+*
+*******************************************************************************/
+static uint32_t fastinit_row_crc(uint32_t row_addr)
+{
+    return eeprom_crc32_update(0u, (const void *) row_addr, CY_EM_EEPROM_FLASH_SIZEOF_ROW);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,79 @@
+/******************************************************************************
+* File Name: eeprom_fastinit.h
+*
+* Description: This file contains the interface of the fast Emulated EEPROM
+*              initialization based on a head-row hint kept in the backup registers.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_FASTINIT_H
+#define EEPROM_FASTINIT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* First backup register used for the hint. The hint takes
+ * EEPROM_FASTINIT_HINT_WORDS consecutive registers.
+ */
+#ifndef EEPROM_FASTINIT_BREG_INDEX
+#define EEPROM_FASTINIT_BREG_INDEX      (0u)
+#endif
+
+/* Hint layout: magic, config CRC, head-row index, head-row CRC, next-row CRC,
+ * hint CRC.
+ */
+#define EEPROM_FASTINIT_HINT_WORDS      (6u)
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_fastinit_init(const cy_stc_eeprom_config_t *config,
+                                              cy_stc_eeprom_context_t *context,
+                                              bool *fast_path);
+void eeprom_fastinit_update(const cy_stc_eeprom_config_t *config,
+                            const cy_stc_eeprom_context_t *context);
+void eeprom_fastinit_invalidate(void);
+
+#endif /* EEPROM_FASTINIT_H */
+
+/* [] END OF FILE */
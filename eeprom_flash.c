@@ -0,0 +1,290 @@
+/******************************************************************************
+* File Name: eeprom_flash.c
+*
+* Description: This file implements the raw flash row helpers. All flash
+*              operations of the modules that manage flash rows themselves go
+*              through these functions.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "eeprom_flash.h"
+#include "eeprom_trace.h"
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Nesting depth of the flash operations in progress. */
+static volatile uint32_t flash_nesting;
+/* Work an interrupt handed over to the end of the operation it interrupted. */
+static volatile eeprom_flash_deferred_t flash_deferred;
+
+
+/*******************************************************************************
+* Function Name: eeprom_flash_erase_row
+********************************************************************************
+*
+* Summary:
+* Erases one row. Every byte reads EEPROM_FLASH_ERASED_VALUE afterwards.
+*
+* Parameters:
+* uint32_t row_addr: row-aligned flash address.
+*
+* Return: cy_en_flashdrv_status_t
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t eeprom_flash_erase_row(uint32_t row_addr)
+{
+    cy_en_flashdrv_status_t result;
+
+    EEPROM_TRACE_BEGIN_OP(EEPROM_TRACE_ERASE, row_addr, EEPROM_FLASH_ROW_SIZE);
+    eeprom_flash_enter();
+    result = Cy_Flash_EraseRow(row_addr);
+    eeprom_flash_exit();
+    EEPROM_TRACE_END_OP(EEPROM_TRACE_ERASE, result);
+
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_flash_erase_subsector
+********************************************************************************
+*
+* Summary:
+* Erases the EEPROM_FLASH_SUBSECTOR_ROWS rows of one subsector.
+*
+* Parameters:
+* uint32_t subsector_addr: flash address aligned to EEPROM_FLASH_SUBSECTOR_SIZE.
+*
+* Return: cy_en_flashdrv_status_t
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t eeprom_flash_erase_subsector(uint32_t subsector_addr)
+{
+    cy_en_flashdrv_status_t result;
+
+    EEPROM_TRACE_BEGIN_OP(EEPROM_TRACE_ERASE, subsector_addr, EEPROM_FLASH_SUBSECTOR_SIZE);
+    eeprom_flash_enter();
+    result = Cy_Flash_EraseSubsector(subsector_addr);
+    eeprom_flash_exit();
+    EEPROM_TRACE_END_OP(EEPROM_TRACE_ERASE, result);
+
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_flash_program_row
+********************************************************************************
+*
+* Summary:
+* Programs one row without erasing it first. The row must be erased, or every
+* bit that is already programmed must stay programmed in data; bits can only
+* move away from the erased value.
+*
+* Parameters:
+* uint32_t row_addr: row-aligned flash address.
+* const uint32_t *data: EEPROM_FLASH_ROW_WORDS words of row content.
+*
+* Return: cy_en_flashdrv_status_t
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t eeprom_flash_program_row(uint32_t row_addr, const uint32_t *data)
+{
+    cy_en_flashdrv_status_t result;
+
+    eeprom_flash_enter();
+    result = Cy_Flash_ProgramRow(row_addr, data);
+    eeprom_flash_exit();
+
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_flash_write_row
+********************************************************************************
+*
+* Summary:
+* Erases and programs one row.
+*
+* Parameters:
+* uint32_t row_addr: row-aligned flash address.
+* const uint32_t *data: EEPROM_FLASH_ROW_WORDS words of row content.
+*
+* Return: cy_en_flashdrv_status_t
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t eeprom_flash_write_row(uint32_t row_addr, const uint32_t *data)
+{
+    cy_en_flashdrv_status_t result;
+
+    eeprom_flash_enter();
+    result = Cy_Flash_WriteRow(row_addr, data);
+    eeprom_flash_exit();
+
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_flash_row_is_erased
+********************************************************************************
+*
+* Summary:
+* Checks whether every byte of a row holds the erased value.
+*
+* Parameters:
+* uint32_t row_addr: row-aligned flash address.
+*
+* Return: bool
+*
+*******************************************************************************/
+bool eeprom_flash_row_is_erased(uint32_t row_addr)
+{
+    const uint32_t *word = (const uint32_t *) row_addr;
+
+    for(uint32_t i = 0u; i < EEPROM_FLASH_ROW_WORDS; i++)
+    {
+        if(EEPROM_FLASH_ERASED_WORD != word[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_flash_enter
+********************************************************************************
+*
+* Summary:
+* Marks the start of an operation that must not be interrupted by another
+* access to the flash or to the Em_EEPROM middleware, which is not reentrant.
+* Calls nest; every call needs a matching eeprom_flash_exit().
+*
+*******************************************************************************/
+void eeprom_flash_enter(void)
+{
+    uint32_t interrupt_state;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    flash_nesting++;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_flash_exit
+********************************************************************************
+*
+* Summary:
+* Marks the end of an operation started with eeprom_flash_enter(). The
+* outermost call runs the work deferred by eeprom_flash_run_or_defer() in the
+* meantime, in the context of the caller.
+*
+*******************************************************************************/
+void eeprom_flash_exit(void)
+{
+    eeprom_flash_deferred_t work = NULL;
+    uint32_t interrupt_state;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    flash_nesting--;
+    if(0u == flash_nesting)
+    {
+        work = flash_deferred;
+        flash_deferred = NULL;
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    if(NULL != work)
+    {
+        work();
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_flash_is_busy
+********************************************************************************
+*
+* Summary:
+* Returns true between eeprom_flash_enter() and the matching
+* eeprom_flash_exit().
+*
+*******************************************************************************/
+bool eeprom_flash_is_busy(void)
+{
+    return (0u != flash_nesting);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_flash_run_or_defer
+********************************************************************************
+*
+* Summary:
+* Runs work at once if no flash operation is in progress. Otherwise the
+* interrupt caught one in the middle, and work is run by the eeprom_flash_exit()
+* that ends it. Only one work item is kept; a later one replaces it.
+*
+* Parameters:
+* eeprom_flash_deferred_t work: function to run.
+*
+* Note: Meant for interrupt handlers. Work that is deferred runs in the
+* interrupted context, so it must not depend on the interrupt priority.
+*
+*******************************************************************************/
+void eeprom_flash_run_or_defer(eeprom_flash_deferred_t work)
+{
+    if(0u != flash_nesting)
+    {
+        flash_deferred = work;
+    }
+    else
+    {
+        work();
+    }
+}
+
+
+/* [] END OF FILE */
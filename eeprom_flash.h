@@ -0,0 +1,104 @@
+/******************************************************************************
+* File Name: eeprom_flash.h
+*
+* Description: This file contains the interface of the raw flash row helpers
+*              used by the modules that manage flash rows outside the Em_EEPROM
+*              middleware.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_FLASH_H
+#define EEPROM_FLASH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Size of one flash row, the smallest unit that can be erased or programmed. */
+#define EEPROM_FLASH_ROW_SIZE           (CY_FLASH_SIZEOF_ROW)
+#define EEPROM_FLASH_ROW_WORDS          (EEPROM_FLASH_ROW_SIZE / sizeof(uint32_t))
+
+/* Rows of a subsector, the erase unit next up from a row. One subsector
+ * erase takes little longer than one row erase.
+ */
+#define EEPROM_FLASH_SUBSECTOR_ROWS     (8u)
+#define EEPROM_FLASH_SUBSECTOR_SIZE     (EEPROM_FLASH_SUBSECTOR_ROWS * EEPROM_FLASH_ROW_SIZE)
+
+/* Value of every byte of an erased row. Programming can only move bits away
+ * from this value; only an erase brings them back.
+ */
+#define EEPROM_FLASH_ERASED_VALUE       (0x00u)
+#define EEPROM_FLASH_ERASED_WORD        (0x00000000u)
+
+/* Programs of one row allowed between two erases, the erase-and-program of
+ * eeprom_flash_write_row() included. Every program stresses the cells that
+ * are already programmed again. The flash endurance of the device datasheet
+ * is given in erase/program cycles, so the default is kept low; raise it only
+ * if the flash specification of the device allows more.
+ */
+#ifndef EEPROM_FLASH_MAX_PROGRAMS
+#define EEPROM_FLASH_MAX_PROGRAMS       (64u)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Work that must not run inside a flash operation of another context. */
+typedef void (*eeprom_flash_deferred_t)(void);
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_flashdrv_status_t eeprom_flash_erase_row(uint32_t row_addr);
+cy_en_flashdrv_status_t eeprom_flash_erase_subsector(uint32_t subsector_addr);
+cy_en_flashdrv_status_t eeprom_flash_program_row(uint32_t row_addr, const uint32_t *data);
+cy_en_flashdrv_status_t eeprom_flash_write_row(uint32_t row_addr, const uint32_t *data);
+bool eeprom_flash_row_is_erased(uint32_t row_addr);
+void eeprom_flash_enter(void);
+void eeprom_flash_exit(void);
+bool eeprom_flash_is_busy(void);
+void eeprom_flash_run_or_defer(eeprom_flash_deferred_t work);
+
+#endif /* EEPROM_FLASH_H */
+
+/* [] END OF FILE */
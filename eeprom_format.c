@@ -0,0 +1,297 @@
+/******************************************************************************
+* File Name: eeprom_format.c
+*
+* Description: This file implements the factory format of an Em_EEPROM
+*              instance. The Em_EEPROM area is erased a subsector at a time
+*              where it is aligned, rows that are erased already are skipped,
+*              and the default content is written in a single pass.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "eeprom_cycles.h"
+#include "eeprom_fastinit.h"
+#include "eeprom_flash.h"
+#include "eeprom_format.h"
+#include "eeprom_io.h"
+#include "eeprom_journal.h"
+#include "eeprom_relocate.h"
+#include "eeprom_shadow.h"
+#include "eeprom_trace.h"
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static bool format_is_erased(uint32_t addr, uint32_t rows);
+static cy_en_em_eeprom_status_t format_erase(uint32_t addr, uint32_t size,
+                                             eeprom_format_report_t *report);
+static cy_en_em_eeprom_status_t format_program(uint32_t addr, const uint8_t *image,
+                                               uint32_t size);
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Row programmed by the simple mode format. */
+static uint32_t format_row[EEPROM_FLASH_ROW_WORDS];
+
+
+/*******************************************************************************
+* Function Name: eeprom_format
+********************************************************************************
+*
+* Summary:
+* Erases the Em_EEPROM area of an instance, initializes the instance and
+* writes image to the logical addresses 0 to size - 1. The rest of the
+* logical EEPROM reads 0. In simple mode the image is programmed into the
+* erased rows directly; otherwise it is written with one Cy_Em_EEPROM_Write().
+*
+* The instance does not need a valid content or a successful initialization
+* before; a pending deferred initialization is dropped, the emergency journal
+* is discarded, and the RAM shadow and the fast initialization hint are
+* brought in line with the new content.
+*
+* Parameters:
+* const cy_stc_eeprom_config_t *config: configuration of the instance.
+* cy_stc_eeprom_context_t *context: context of the instance.
+* const void *image: default content, or NULL to only erase the instance.
+* uint32_t size: bytes of image, at most config->eepromSize.
+* eeprom_format_report_t *report: filled with the row counts and the timing,
+*  or NULL.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_BAD_PARAM for an instance with hot block relocation, whose
+* moved blocks live in the hot instance.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_format(const cy_stc_eeprom_config_t *config,
+                                       cy_stc_eeprom_context_t *context,
+                                       const void *image, uint32_t size,
+                                       eeprom_format_report_t *report)
+{
+    eeprom_format_report_t local;
+    eeprom_shadow_t *shadow;
+    eeprom_journal_t *journal;
+    cy_en_em_eeprom_status_t status;
+    uint32_t area_size;
+    uint32_t start;
+
+    if((NULL == config) || (NULL == context) || (size > config->eepromSize) ||
+       ((NULL == image) && (0u != size)) || (NULL != eeprom_relocate_find(context)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+    if(NULL == report)
+    {
+        report = &local;
+    }
+    (void) memset(report, 0, sizeof(*report));
+
+    area_size = CY_EM_EEPROM_GET_PHYSICAL_SIZE(config->eepromSize, config->simpleMode,
+                                               config->wearLevelingFactor,
+                                               config->redundantCopy);
+
+    /* The hint describes the old content. */
+    eeprom_fastinit_invalidate();
+    eeprom_cycles_init();
+
+    start = eeprom_cycles_now();
+    status = format_erase(config->userFlashStartAddr, area_size, report);
+    report->erase_us = eeprom_cycles_to_us(eeprom_cycles_now() - start);
+    if(CY_EM_EEPROM_SUCCESS != status)
+    {
+        return status;
+    }
+
+    start = eeprom_cycles_now();
+    if((0u != config->simpleMode) && (0u != size))
+    {
+        /* The logical bytes are the flash bytes, and the rows are erased. */
+        status = format_program(config->userFlashStartAddr, (const uint8_t *) image, size);
+        if(CY_EM_EEPROM_SUCCESS != status)
+        {
+            return status;
+        }
+    }
+    eeprom_flash_enter();
+    EEPROM_TRACE_BEGIN_OP(EEPROM_TRACE_INIT, config->userFlashStartAddr, config->eepromSize);
+    status = Cy_Em_EEPROM_Init(config, context);
+    EEPROM_TRACE_END_OP(EEPROM_TRACE_INIT, status);
+    if(((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status)) &&
+       (0u == config->simpleMode) && (0u != size))
+    {
+        EEPROM_TRACE_BEGIN_OP(EEPROM_TRACE_WRITE, 0u, size);
+        status = Cy_Em_EEPROM_Write(0u, image, size, context);
+        EEPROM_TRACE_END_OP(EEPROM_TRACE_WRITE, status);
+    }
+    eeprom_flash_exit();
+    report->write_us = eeprom_cycles_to_us(eeprom_cycles_now() - start);
+    if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+    {
+        return status;
+    }
+
+    eeprom_io_set_ready(context);
+    eeprom_fastinit_update(config, context);
+
+    shadow = eeprom_shadow_find(context);
+    if(NULL != shadow)
+    {
+        /* Reads go to the flash again if the mirror cannot be reloaded. */
+        status = Cy_Em_EEPROM_Read(0u, shadow->image, shadow->size, context);
+        shadow->valid = ((CY_EM_EEPROM_SUCCESS == status) ||
+                         (CY_EM_EEPROM_REDUNDANT_COPY_USED == status));
+    }
+
+    /* Its records belong to the old content. */
+    journal = eeprom_journal_find(context);
+    if(NULL != journal)
+    {
+        return eeprom_journal_discard(journal);
+    }
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: format_is_erased
+********************************************************************************
+*
+* Summary:
+* Checks whether consecutive rows are all erased.
+*
+*******************************************************************************/
+static bool format_is_erased(uint32_t addr, uint32_t rows)
+{
+    for(uint32_t i = 0u; i < rows; i++)
+    {
+        if(!eeprom_flash_row_is_erased(addr + (i * EEPROM_FLASH_ROW_SIZE)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: format_erase
+********************************************************************************
+*
+* Summary:
+* Erases a row-aligned flash area with one subsector erase for every aligned
+* subsector it covers and row erases for the rest. Erased rows and
+* subsectors are skipped, so the rows of a new device or of an aborted
+* format cost only the check.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t format_erase(uint32_t addr, uint32_t size,
+                                             eeprom_format_report_t *report)
+{
+    uint32_t end = addr + size;
+    uint32_t rows;
+    cy_en_flashdrv_status_t result;
+
+    while(addr < end)
+    {
+        rows = 1u;
+        if((0u == (addr % EEPROM_FLASH_SUBSECTOR_SIZE)) &&
+           ((end - addr) >= EEPROM_FLASH_SUBSECTOR_SIZE))
+        {
+            rows = EEPROM_FLASH_SUBSECTOR_ROWS;
+        }
+
+        if(format_is_erased(addr, rows))
+        {
+            report->rows_skipped += rows;
+        }
+        else
+        {
+            result = (1u == rows) ? eeprom_flash_erase_row(addr) :
+                                    eeprom_flash_erase_subsector(addr);
+            if(CY_FLASH_DRV_SUCCESS != result)
+            {
+                return CY_EM_EEPROM_WRITE_FAIL;
+            }
+            report->rows_erased += rows;
+            report->erase_operations++;
+        }
+        addr += rows * EEPROM_FLASH_ROW_SIZE;
+    }
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: format_program
+********************************************************************************
+*
+* Summary:
+* Programs an image into erased rows without erasing them again. The last
+* row is padded with the erased value.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t format_program(uint32_t addr, const uint8_t *image,
+                                               uint32_t size)
+{
+    uint32_t chunk;
+
+    while(0u != size)
+    {
+        chunk = (size < EEPROM_FLASH_ROW_SIZE) ? size : EEPROM_FLASH_ROW_SIZE;
+        (void) memset(format_row, EEPROM_FLASH_ERASED_VALUE, EEPROM_FLASH_ROW_SIZE);
+        (void) memcpy(format_row, image, chunk);
+
+        if(CY_FLASH_DRV_SUCCESS != eeprom_flash_program_row(addr, format_row))
+        {
+            return CY_EM_EEPROM_WRITE_FAIL;
+        }
+        addr += EEPROM_FLASH_ROW_SIZE;
+        image = &image[chunk];
+        size -= chunk;
+    }
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/* [] END OF FILE */
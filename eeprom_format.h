@@ -0,0 +1,78 @@
+/******************************************************************************
+* File Name: eeprom_format.h
+*
+* Description: This file contains the structure and function prototypes of
+*              the factory format, which erases the Em_EEPROM area of an
+*              instance and writes its default content in one pass.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_FORMAT_H
+#define EEPROM_FORMAT_H
+
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* What a format did and how long it took. */
+typedef struct
+{
+    /* Rows erased, and rows left alone because they were erased already. */
+    uint32_t rows_erased;
+    uint32_t rows_skipped;
+    /* Flash erase operations issued; a subsector erase counts once. */
+    uint32_t erase_operations;
+    uint32_t erase_us;
+    /* Initialization and write of the default content. */
+    uint32_t write_us;
+} eeprom_format_report_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_format(const cy_stc_eeprom_config_t *config,
+                                       cy_stc_eeprom_context_t *context,
+                                       const void *image, uint32_t size,
+                                       eeprom_format_report_t *report);
+
+#endif /* EEPROM_FORMAT_H */
+
+/* [] END OF FILE */
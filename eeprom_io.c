@@ -0,0 +1,766 @@
+/******************************************************************************
+* File Name: eeprom_io.c
+*
+* Description: This file contains the Em_EEPROM access layer. Every read and
+*              write of the EEPROM modules in this example goes through it, and
+*              the accesses to instances tracked by eeprom_stats.c are counted.
+*              An instance registered with eeprom_io_lazy_init() is
+*              initialized by its first access, or earlier by
+*              eeprom_io_init_pending() from a background context.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_cycles.h"
+#include "eeprom_fastinit.h"
+#include "eeprom_flash.h"
+#include "eeprom_io.h"
+#include "eeprom_journal.h"
+#include "eeprom_relocate.h"
+#include "eeprom_shadow.h"
+#include "eeprom_stats.h"
+#include "eeprom_status.h"
+#include "eeprom_trace.h"
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef enum
+{
+    IO_LAZY_FREE,
+    IO_LAZY_PENDING,
+    IO_LAZY_RUNNING,
+    IO_LAZY_DONE,
+} io_lazy_state_t;
+
+/* Instance whose initialization is deferred. After a successful
+ * initialization the slot is freed again, also if the redundant copy was
+ * used; a failed one keeps its status.
+ */
+typedef struct
+{
+    const cy_stc_eeprom_config_t *config;
+    cy_stc_eeprom_context_t *context;
+    volatile io_lazy_state_t state;
+    cy_en_em_eeprom_status_t status;
+} io_lazy_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static io_lazy_t *io_lazy_find(const cy_stc_eeprom_context_t *context);
+static cy_en_em_eeprom_status_t io_lazy_run(io_lazy_t *lazy);
+static cy_en_em_eeprom_status_t io_read_relocated(uint32_t addr, void *data, uint32_t size,
+                                                  cy_stc_eeprom_context_t *context);
+static cy_en_em_eeprom_status_t io_write_relocated(uint32_t addr, const void *data,
+                                                   uint32_t size,
+                                                   cy_stc_eeprom_context_t *context);
+static cy_en_em_eeprom_status_t io_read(uint32_t addr, void *data, uint32_t size,
+                                        cy_stc_eeprom_context_t *context);
+static cy_en_em_eeprom_status_t io_write_in_place(uint32_t addr, const uint8_t *data,
+                                                  uint32_t size,
+                                                  cy_stc_eeprom_context_t *context,
+                                                  eeprom_shadow_t *shadow);
+static cy_en_em_eeprom_status_t io_write(uint32_t addr, const uint8_t *data, uint32_t size,
+                                         cy_stc_eeprom_context_t *context,
+                                         const eeprom_shadow_t *shadow, eeprom_stats_t *stats);
+static cy_en_em_eeprom_status_t io_program(uint32_t addr, const uint8_t *data, uint32_t size,
+                                           cy_stc_eeprom_context_t *context,
+                                           eeprom_stats_t *stats);
+#if EEPROM_IO_COMPARE
+static bool io_is_stored(uint32_t addr, const uint8_t *data, uint32_t size,
+                         cy_stc_eeprom_context_t *context, const eeprom_shadow_t *shadow);
+#endif
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+static io_lazy_t io_lazy[EEPROM_IO_MAX_LAZY];
+/* Instances whose initialization is still deferred. Once all of them are
+ * initialized, eeprom_io_ready() returns without searching io_lazy.
+ */
+static volatile uint32_t io_lazy_count;
+
+
+/*******************************************************************************
+* Function Name: eeprom_io_read
+********************************************************************************
+*
+* Summary:
+* Reads from the EEPROM with Cy_Em_EEPROM_Read(), or from the RAM shadow of
+* the instance if it has one covering the range. Initializes a lazily
+* initialized instance first. Blocks moved by eeprom_relocate.c are read from
+* the hot instance. An interrupt handler that uses eeprom_flash_run_or_defer()
+* does not enter the middleware during the read.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_io_read(uint32_t addr, void *data, uint32_t size,
+                                        cy_stc_eeprom_context_t *context)
+{
+    cy_en_em_eeprom_status_t status;
+
+    eeprom_flash_enter();
+    status = io_read_relocated(addr, data, size, context);
+    eeprom_flash_exit();
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_io_write
+********************************************************************************
+*
+* Summary:
+* Writes to the EEPROM with Cy_Em_EEPROM_Write() and updates the RAM shadow
+* of the instance if it has one. Initializes a lazily initialized instance
+* first. With EEPROM_IO_COMPARE, rows already holding the data are skipped.
+* Blocks moved by eeprom_relocate.c are written to the hot instance. An
+* interrupt handler that uses eeprom_flash_run_or_defer() does not enter the
+* middleware during the write.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_io_write(uint32_t addr, const void *data, uint32_t size,
+                                         cy_stc_eeprom_context_t *context)
+{
+    cy_en_em_eeprom_status_t status;
+
+    eeprom_flash_enter();
+    status = io_write_relocated(addr, data, size, context);
+    eeprom_flash_exit();
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: io_read_relocated
+********************************************************************************
+*
+* Summary:
+* Read of eeprom_io_read(), split at the blocks moved to the hot instance.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t io_read_relocated(uint32_t addr, void *data, uint32_t size,
+                                                  cy_stc_eeprom_context_t *context)
+{
+    cy_en_em_eeprom_status_t status = eeprom_io_ready(context);
+    eeprom_relocate_t *relocate;
+    uint8_t *bytes = (uint8_t *) data;
+    uint32_t hot_addr;
+    uint32_t run;
+
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+
+    relocate = eeprom_relocate_find(context);
+    if((NULL == relocate) || (NULL == data))
+    {
+        return eeprom_status_combine(status, io_read(addr, data, size, context));
+    }
+
+    /* Moved blocks are read from the hot instance. */
+    while(0u != size)
+    {
+        run = eeprom_relocate_run(relocate, addr, size, &hot_addr);
+        status = eeprom_status_combine(status, (EEPROM_RELOCATE_IN_PLACE == hot_addr) ?
+                                       io_read(addr, bytes, run, context) :
+                                       eeprom_io_read(hot_addr, bytes, run, relocate->hot));
+        if(eeprom_status_failed(status))
+        {
+            break;
+        }
+        addr += run;
+        bytes = &bytes[run];
+        size -= run;
+    }
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: io_write_relocated
+********************************************************************************
+*
+* Summary:
+* Write of eeprom_io_write(), split at the blocks moved to the hot instance.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t io_write_relocated(uint32_t addr, const void *data,
+                                                   uint32_t size,
+                                                   cy_stc_eeprom_context_t *context)
+{
+    cy_en_em_eeprom_status_t status = eeprom_io_ready(context);
+    const uint8_t *bytes = (const uint8_t *) data;
+    eeprom_relocate_t *relocate;
+    eeprom_shadow_t *shadow;
+    uint32_t start = addr;
+    uint32_t left = size;
+    uint32_t hot_addr;
+    uint32_t run;
+
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+
+    shadow = eeprom_shadow_find(context);
+    relocate = eeprom_relocate_find(context);
+    if((NULL == relocate) || (NULL == data))
+    {
+        return eeprom_status_combine(status, io_write_in_place(addr, bytes, size, context, shadow));
+    }
+
+    while(0u != left)
+    {
+        run = eeprom_relocate_run(relocate, start, left, &hot_addr);
+        if(EEPROM_RELOCATE_IN_PLACE == hot_addr)
+        {
+            status = eeprom_status_combine(status, io_write_in_place(start, bytes, run,
+                                                                     context, shadow));
+        }
+        else
+        {
+            status = eeprom_status_combine(status, eeprom_io_write(hot_addr, bytes, run,
+                                                                   relocate->hot));
+            /* Keeps zero-copy reads of the source shadow current. */
+            if((NULL != shadow) && !eeprom_status_failed(status))
+            {
+                eeprom_shadow_update(shadow, start, bytes, run, CY_EM_EEPROM_SUCCESS);
+            }
+        }
+        if(eeprom_status_failed(status))
+        {
+            return status;
+        }
+        start += run;
+        bytes = &bytes[run];
+        left -= run;
+    }
+
+    eeprom_relocate_record(relocate, addr, size);
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_io_lazy_init
+********************************************************************************
+*
+* Summary:
+* Defers the initialization of an Em_EEPROM instance to its first access
+* through this layer or to eeprom_io_init_pending(), whichever comes first.
+* The instance is initialized with eeprom_fastinit_init(). config has to stay
+* valid until then. Calling it again for an instance that is still waiting,
+* or whose initialization a reset that kept the RAM cut short, defers the
+* initialization anew.
+*
+* Parameters:
+* const cy_stc_eeprom_config_t *config: configuration of the instance.
+* cy_stc_eeprom_context_t *context: context to initialize.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_BAD_PARAM if EEPROM_IO_MAX_LAZY instances are waiting already.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_io_lazy_init(const cy_stc_eeprom_config_t *config,
+                                             cy_stc_eeprom_context_t *context)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_BAD_PARAM;
+    uint32_t interrupt_state;
+    io_lazy_t *lazy;
+
+    if((NULL == config) || (NULL == context))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    lazy = io_lazy_find(context);
+    if(NULL != lazy)
+    {
+        /* Still counted in io_lazy_count. */
+        lazy->config = config;
+        lazy->status = CY_EM_EEPROM_SUCCESS;
+        lazy->state = IO_LAZY_PENDING;
+        status = CY_EM_EEPROM_SUCCESS;
+    }
+    else
+    {
+        for(uint32_t i = 0u; i < EEPROM_IO_MAX_LAZY; i++)
+        {
+            if(IO_LAZY_FREE == io_lazy[i].state)
+            {
+                io_lazy[i].config = config;
+                io_lazy[i].context = context;
+                io_lazy[i].status = CY_EM_EEPROM_SUCCESS;
+                io_lazy[i].state = IO_LAZY_PENDING;
+                io_lazy_count++;
+                status = CY_EM_EEPROM_SUCCESS;
+                break;
+            }
+        }
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_io_ready
+********************************************************************************
+*
+* Summary:
+* Makes sure an instance is initialized. Runs a deferred initialization, or
+* waits for one started by another context. Do not call it from an interrupt
+* that can preempt that context.
+*
+* Parameters:
+* cy_stc_eeprom_context_t *context: Em_EEPROM instance.
+*
+* Return: cy_en_em_eeprom_status_t
+*  The status of the deferred initialization, CY_EM_EEPROM_SUCCESS for an
+*  instance that was not deferred or is initialized already.
+*  CY_EM_EEPROM_REDUNDANT_COPY_USED is a warning: it is returned once, to the
+*  access that ran the initialization, and the instance is usable.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_io_ready(cy_stc_eeprom_context_t *context)
+{
+    io_lazy_t *lazy;
+
+    if(0u == io_lazy_count)
+    {
+        return CY_EM_EEPROM_SUCCESS;
+    }
+
+    lazy = io_lazy_find(context);
+    if(NULL == lazy)
+    {
+        return CY_EM_EEPROM_SUCCESS;
+    }
+    return io_lazy_run(lazy);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_io_is_ready
+********************************************************************************
+*
+* Summary:
+* Returns true if an access to the instance does not have to wait for its
+* initialization.
+*
+*******************************************************************************/
+bool eeprom_io_is_ready(const cy_stc_eeprom_context_t *context)
+{
+    io_lazy_t *lazy = io_lazy_find(context);
+
+    return ((NULL == lazy) || (IO_LAZY_DONE == lazy->state));
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_io_init_pending
+********************************************************************************
+*
+* Summary:
+* Runs the deferred initializations that no access has triggered yet. Call
+* it from a low-priority task or the idle loop once the time-critical start-up
+* work is done.
+*
+*******************************************************************************/
+void eeprom_io_init_pending(void)
+{
+    for(uint32_t i = 0u; i < EEPROM_IO_MAX_LAZY; i++)
+    {
+        if(IO_LAZY_PENDING == io_lazy[i].state)
+        {
+            (void) io_lazy_run(&io_lazy[i]);
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_io_set_ready
+********************************************************************************
+*
+* Summary:
+* Drops the deferred initialization of an instance that was initialized
+* without it, such as by eeprom_format(). A failed deferred initialization is
+* dropped too, so that accesses no longer return its status.
+*
+* Parameters:
+* const cy_stc_eeprom_context_t *context: Em_EEPROM instance, initialized.
+*
+*******************************************************************************/
+void eeprom_io_set_ready(const cy_stc_eeprom_context_t *context)
+{
+    io_lazy_t *lazy;
+    uint32_t interrupt_state;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    lazy = io_lazy_find(context);
+    if((NULL != lazy) && (IO_LAZY_RUNNING != lazy->state))
+    {
+        lazy->state = IO_LAZY_FREE;
+        io_lazy_count--;
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+
+/*******************************************************************************
+* Function Name: io_lazy_find
+********************************************************************************
+*
+* Summary:
+* Returns the deferred initialization slot of an instance, or NULL.
+*
+*******************************************************************************/
+static io_lazy_t *io_lazy_find(const cy_stc_eeprom_context_t *context)
+{
+    for(uint32_t i = 0u; i < EEPROM_IO_MAX_LAZY; i++)
+    {
+        if((IO_LAZY_FREE != io_lazy[i].state) && (io_lazy[i].context == context))
+        {
+            return &io_lazy[i];
+        }
+    }
+    return NULL;
+}
+
+
+/*******************************************************************************
+* Function Name: io_lazy_run
+********************************************************************************
+*
+* Summary:
+* Initializes the instance of a slot unless another context already does,
+* in which case it waits for that one to finish. A successful initialization
+* frees the slot; the middleware falling back to the redundant copy does not
+* make it fail.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t io_lazy_run(io_lazy_t *lazy)
+{
+    cy_en_em_eeprom_status_t status;
+    uint32_t interrupt_state;
+    bool owner = false;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    if(IO_LAZY_PENDING == lazy->state)
+    {
+        lazy->state = IO_LAZY_RUNNING;
+        owner = true;
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    if(owner)
+    {
+        eeprom_flash_enter();
+        EEPROM_TRACE_BEGIN_OP(EEPROM_TRACE_INIT, lazy->config->userFlashStartAddr,
+                              lazy->config->eepromSize);
+        status = eeprom_fastinit_init(lazy->config, lazy->context, NULL);
+        if(!eeprom_status_failed(status))
+        {
+            /* Merge what the last brown-out saved before the first access. */
+            status = eeprom_status_combine(status, eeprom_journal_replay(lazy->context));
+        }
+        EEPROM_TRACE_END_OP(EEPROM_TRACE_INIT, status);
+
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+        lazy->status = status;
+        if(!eeprom_status_failed(status))
+        {
+            lazy->state = IO_LAZY_FREE;
+            io_lazy_count--;
+        }
+        else
+        {
+            lazy->state = IO_LAZY_DONE;
+        }
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+        /* Deferred work may access the instance, so it runs only now. */
+        eeprom_flash_exit();
+
+        return status;
+    }
+
+    while(IO_LAZY_RUNNING == lazy->state)
+    {
+        /* Initialized by another context. */
+    }
+
+    /* The slot is free again after a successful initialization. */
+    return (IO_LAZY_DONE == lazy->state) ? lazy->status : CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: io_read
+********************************************************************************
+*
+* Summary:
+* Read of eeprom_io_read() from the instance itself, from its RAM shadow if
+* the shadow covers the range.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t io_read(uint32_t addr, void *data, uint32_t size,
+                                        cy_stc_eeprom_context_t *context)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    eeprom_shadow_t *shadow = eeprom_shadow_find(context);
+    eeprom_stats_t *stats;
+
+    if((NULL == shadow) || !eeprom_shadow_read(shadow, addr, data, size))
+    {
+        EEPROM_TRACE_BEGIN_OP(EEPROM_TRACE_READ, addr, size);
+        status = Cy_Em_EEPROM_Read(addr, data, size, context);
+        EEPROM_TRACE_END_OP(EEPROM_TRACE_READ, status);
+        if(CY_EM_EEPROM_REDUNDANT_COPY_USED == status)
+        {
+            EEPROM_TRACE_EVENT(EEPROM_TRACE_REDUNDANT_COPY, addr);
+        }
+    }
+    stats = eeprom_stats_find(context);
+    if(NULL != stats)
+    {
+        eeprom_stats_record_read(stats, status, size);
+    }
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: io_write_in_place
+********************************************************************************
+*
+* Summary:
+* Write of eeprom_io_write() to the instance itself, followed by the update
+* of its RAM shadow.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t io_write_in_place(uint32_t addr, const uint8_t *data,
+                                                  uint32_t size,
+                                                  cy_stc_eeprom_context_t *context,
+                                                  eeprom_shadow_t *shadow)
+{
+    cy_en_em_eeprom_status_t status = io_write(addr, data, size, context, shadow,
+                                               eeprom_stats_find(context));
+
+    if((NULL != shadow) && (NULL != data))
+    {
+        eeprom_shadow_update(shadow, addr, data, size, status);
+    }
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: io_write
+********************************************************************************
+*
+* Summary:
+* Write of eeprom_io_write(). With EEPROM_IO_COMPARE, the Em_EEPROM rows of
+* the range that already hold the data are skipped: a write of stored data
+* programs nothing, and each run of changed rows takes one
+* Cy_Em_EEPROM_Write() call.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t io_write(uint32_t addr, const uint8_t *data, uint32_t size,
+                                         cy_stc_eeprom_context_t *context,
+                                         const eeprom_shadow_t *shadow, eeprom_stats_t *stats)
+{
+#if EEPROM_IO_COMPARE
+    if((NULL != data) && (0u != size) && (size <= context->eepromSize) &&
+       (addr <= (context->eepromSize - size)))
+    {
+        cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+        const uint8_t *bytes = data;
+        uint32_t row_size = CY_EM_EEPROM_EEPROM_DATA_LEN(context->simpleMode);
+        uint32_t run_start = 0u;
+        uint32_t run_size = 0u;
+        uint32_t skipped = 0u;
+        uint32_t offset = 0u;
+        cy_en_em_eeprom_status_t run_status;
+
+        while(offset < size)
+        {
+            uint32_t chunk = row_size - ((addr + offset) % row_size);
+
+            if(chunk > (size - offset))
+            {
+                chunk = size - offset;
+            }
+
+            if(!io_is_stored(addr + offset, &bytes[offset], chunk, context, shadow))
+            {
+                run_start = (0u == run_size) ? offset : run_start;
+                run_size += chunk;
+            }
+            else
+            {
+                skipped += chunk;
+                if(0u != run_size)
+                {
+                    run_status = io_program(addr + run_start, &bytes[run_start], run_size,
+                                            context, stats);
+                    run_size = 0u;
+                    status = (CY_EM_EEPROM_SUCCESS == status) ? run_status : status;
+                    if(eeprom_status_failed(run_status))
+                    {
+                        return run_status;
+                    }
+                }
+            }
+            offset += chunk;
+        }
+
+        if(0u != run_size)
+        {
+            run_status = io_program(addr + run_start, &bytes[run_start], run_size,
+                                    context, stats);
+            status = (CY_EM_EEPROM_SUCCESS == status) ? run_status : status;
+        }
+
+        if((NULL != stats) && (0u != skipped))
+        {
+            eeprom_stats_record_suppressed(stats, skipped, (skipped == size));
+        }
+        return status;
+    }
+#else
+    (void) shadow;
+#endif
+
+    return io_program(addr, data, size, context, stats);
+}
+
+
+/*******************************************************************************
+* Function Name: io_program
+********************************************************************************
+*
+* Summary:
+* One Cy_Em_EEPROM_Write() call, timed and counted by the telemetry of the
+* instance if it has one.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t io_program(uint32_t addr, const uint8_t *data, uint32_t size,
+                                           cy_stc_eeprom_context_t *context,
+                                           eeprom_stats_t *stats)
+{
+    cy_en_em_eeprom_status_t status;
+    const uint32_t *last_row = NULL;
+    uint32_t start = 0u;
+
+    if(NULL != stats)
+    {
+        last_row = context->ptrLastWrittenRow;
+        start = eeprom_cycles_now();
+    }
+
+    EEPROM_TRACE_BEGIN_OP(EEPROM_TRACE_WRITE, addr, size);
+    status = Cy_Em_EEPROM_Write(addr, data, size, context);
+    EEPROM_TRACE_END_OP(EEPROM_TRACE_WRITE, status);
+    if(CY_EM_EEPROM_REDUNDANT_COPY_USED == status)
+    {
+        EEPROM_TRACE_EVENT(EEPROM_TRACE_REDUNDANT_COPY, addr);
+    }
+
+    if(NULL != stats)
+    {
+        eeprom_stats_record_write(stats, status, addr, size,
+                                  eeprom_cycles_to_us(eeprom_cycles_now() - start),
+                                  last_row);
+    }
+    return status;
+}
+
+
+#if EEPROM_IO_COMPARE
+/*******************************************************************************
+* Function Name: io_is_stored
+********************************************************************************
+*
+* Summary:
+* Checks whether the EEPROM holds the data already, using the shadow if it
+* covers the range. A range that reads back from the flash with any status
+* but success counts as changed, so that the write repairs the copy found
+* bad.
+*
+*******************************************************************************/
+static bool io_is_stored(uint32_t addr, const uint8_t *data, uint32_t size,
+                         cy_stc_eeprom_context_t *context, const eeprom_shadow_t *shadow)
+{
+    uint8_t stored[EEPROM_IO_COMPARE_CHUNK];
+    const void *mirror = (NULL != shadow) ? eeprom_shadow_data(context, addr, size) : NULL;
+
+    if(NULL != mirror)
+    {
+        return (0 == memcmp(mirror, data, size));
+    }
+
+    while(0u != size)
+    {
+        uint32_t chunk = (size < EEPROM_IO_COMPARE_CHUNK) ? size : EEPROM_IO_COMPARE_CHUNK;
+
+        if((CY_EM_EEPROM_SUCCESS != Cy_Em_EEPROM_Read(addr, stored, chunk, context)) ||
+           (0 != memcmp(stored, data, chunk)))
+        {
+            return false;
+        }
+        addr += chunk;
+        data += chunk;
+        size -= chunk;
+    }
+    return true;
+}
+#endif
+
+
+/* [] END OF FILE */
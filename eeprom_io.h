@@ -0,0 +1,96 @@
+/******************************************************************************
+* File Name: eeprom_io.h
+*
+* Description: This file contains the interface of the Em_EEPROM access layer.
+*              The EEPROM modules of this example read and write through it
+*              instead of calling Cy_Em_EEPROM_Read() and Cy_Em_EEPROM_Write()
+*              directly, so that the telemetry of eeprom_stats.c sees all
+*              accesses and an instance can be initialized on first access.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_IO_H
+#define EEPROM_IO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of instances that can wait for their initialization at the same
+ * time.
+ */
+#ifndef EEPROM_IO_MAX_LAZY
+#define EEPROM_IO_MAX_LAZY              (4u)
+#endif
+
+/* Compare each write with the stored data first and program only the
+ * Em_EEPROM rows holding changed bytes. EEPROM_IO_COMPARE_CHUNK is the stack
+ * buffer the stored data is read into for the comparison.
+ */
+#ifndef EEPROM_IO_COMPARE
+#define EEPROM_IO_COMPARE               (1u)
+#endif
+#ifndef EEPROM_IO_COMPARE_CHUNK
+#define EEPROM_IO_COMPARE_CHUNK         (64u)
+#endif
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+/* Same parameters and return values as Cy_Em_EEPROM_Read() and
+ * Cy_Em_EEPROM_Write().
+ */
+cy_en_em_eeprom_status_t eeprom_io_read(uint32_t addr, void *data, uint32_t size,
+                                        cy_stc_eeprom_context_t *context);
+cy_en_em_eeprom_status_t eeprom_io_write(uint32_t addr, const void *data, uint32_t size,
+                                         cy_stc_eeprom_context_t *context);
+
+cy_en_em_eeprom_status_t eeprom_io_lazy_init(const cy_stc_eeprom_config_t *config,
+                                             cy_stc_eeprom_context_t *context);
+cy_en_em_eeprom_status_t eeprom_io_ready(cy_stc_eeprom_context_t *context);
+bool eeprom_io_is_ready(const cy_stc_eeprom_context_t *context);
+void eeprom_io_init_pending(void);
+void eeprom_io_set_ready(const cy_stc_eeprom_context_t *context);
+
+#endif /* EEPROM_IO_H */
+
+/* [] END OF FILE */
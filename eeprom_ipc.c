@@ -0,0 +1,497 @@
+/******************************************************************************
+* File Name: eeprom_ipc.c
+*
+* Description: This file contains the dual-core access layer. The owner core
+*              serves writes queued by either core in shared memory in batches:
+*              all queued writes go into a write-back cache whose image is the
+*              shared image, and the cache is flushed once per batch, so each
+*              touched row is programmed once. Both cores read the shared image
+*              under a sequence counter and never wait for the owner. Build
+*              this file into the projects of both cores.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "eeprom_cache.h"
+#include "eeprom_ipc.h"
+#include "eeprom_status.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Value of ready once the owner has filled the shared image. */
+#define IPC_READY_MAGIC                 (0x45455043uL)
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static eeprom_ipc_shared_t *ipc_get_shared(void);
+static void ipc_lock(void);
+static void ipc_unlock(bool notify);
+#if defined(EEPROM_IPC_IRQN)
+static void ipc_isr(void);
+#endif
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Shared memory in the SRAM of the owner core. Both cores address all of the
+ * SRAM, but each core's build has its own copy of this variable, so the other
+ * core finds the owner's copy through the data register of EEPROM_IPC_CHANNEL.
+ */
+static eeprom_ipc_shared_t ipc_shared_storage;
+/* The owner's shared memory once it is ready, NULL before. */
+static eeprom_ipc_shared_t *volatile ipc_shared = NULL;
+
+/* Write-back cache of the owner core over the shared image. */
+static eeprom_cache_t ipc_cache;
+static bool ipc_owner = false;
+/* Set while the owner serves the queue, from the main loop or the interrupt. */
+static volatile bool ipc_processing = false;
+
+
+/*******************************************************************************
+* Function Name: eeprom_ipc_owner_init
+********************************************************************************
+*
+* Summary:
+* Makes this core the owner of an initialized Em_EEPROM instance, fills the
+* shared image and opens the queue. The address of the shared memory is
+* published in the data register of EEPROM_IPC_CHANNEL. Call it on one core
+* only, before the other core accesses the EEPROM.
+*
+* Parameters:
+* cy_stc_eeprom_context_t *context: initialized Em_EEPROM instance.
+* uint32_t base: logical address of the first byte of the shared image.
+* uint32_t size: size of the shared image, at most EEPROM_IPC_IMAGE_SIZE.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_ipc_owner_init(cy_stc_eeprom_context_t *context,
+                                               uint32_t base, uint32_t size)
+{
+    eeprom_ipc_shared_t *shared = &ipc_shared_storage;
+    cy_en_em_eeprom_status_t status;
+
+    if((NULL == context) || (0u == size) || (size > EEPROM_IPC_IMAGE_SIZE))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    ipc_shared = NULL;
+    /* A batch cut by a reset is not served any more. */
+    ipc_processing = false;
+    shared->ready = 0u;
+    shared->head = 0u;
+    shared->tail = 0u;
+    shared->done = 0u;
+    shared->sequence = 0u;
+    shared->base = base;
+    shared->size = size;
+
+    status = eeprom_cache_init(&ipc_cache, context, base, shared->image, size);
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+    ipc_owner = true;
+
+#if defined(EEPROM_IPC_IRQN)
+    const cy_stc_sysint_t ipc_intr_config =
+    {
+        .intrSrc = EEPROM_IPC_IRQN,
+        .intrPriority = EEPROM_IPC_INTR_PRIORITY
+    };
+
+    Cy_IPC_Drv_SetInterruptMask(Cy_IPC_Drv_GetIntrBaseAddr(EEPROM_IPC_INTR),
+                                1uL << EEPROM_IPC_CHANNEL, CY_IPC_NO_NOTIFICATION);
+    (void) Cy_SysInt_Init(&ipc_intr_config, ipc_isr);
+    NVIC_ClearPendingIRQ(EEPROM_IPC_IRQN);
+    NVIC_EnableIRQ(EEPROM_IPC_IRQN);
+#endif
+
+    /* Publish the image before the other core may use it. */
+    __DMB();
+    shared->ready = IPC_READY_MAGIC;
+    ipc_lock();
+    Cy_IPC_Drv_WriteDataValue(Cy_IPC_Drv_GetIpcBaseAddress(EEPROM_IPC_CHANNEL),
+                              (uint32_t) (uintptr_t) shared);
+    ipc_unlock(false);
+    ipc_shared = shared;
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_ipc_process
+********************************************************************************
+*
+* Summary:
+* Serves the queued writes on the owner core. All writes queued when it is
+* called form one batch: they are merged into the cache, then the cache is
+* flushed with one Em_EEPROM write per touched row, and each write gets its
+* own status. Writes queued meanwhile are served in the next batch before it
+* returns. Only one context serves the queue at a time; a call that finds the
+* queue served returns at once. Does nothing on the other core.
+*
+*******************************************************************************/
+void eeprom_ipc_process(void)
+{
+    eeprom_ipc_shared_t *shared = ipc_shared;
+    uint32_t interrupt_state;
+    bool owner = false;
+
+    if((!ipc_owner) || (NULL == shared))
+    {
+        return;
+    }
+
+    /* The owner's interrupt can call it too. */
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    if(!ipc_processing)
+    {
+        ipc_processing = true;
+        owner = true;
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+    if(!owner)
+    {
+        return;
+    }
+
+    for(;;)
+    {
+        cy_en_em_eeprom_status_t status;
+        uint32_t first = shared->tail;
+        uint32_t head = shared->head;
+
+        __DMB();
+        if(head == first)
+        {
+            break;
+        }
+
+        while(shared->tail != head)
+        {
+            eeprom_ipc_request_t *request =
+                &shared->requests[shared->tail % EEPROM_IPC_QUEUE_DEPTH];
+
+            shared->sequence++;
+            __DMB();
+            request->status = (uint32_t) eeprom_cache_write(&ipc_cache, request->addr,
+                                                            request->data, request->size);
+            __DMB();
+            shared->sequence++;
+
+            __DMB();
+            shared->tail++;
+        }
+
+        status = eeprom_cache_flush(&ipc_cache);
+
+        for(uint32_t ticket = first; ticket != head; ticket++)
+        {
+            eeprom_ipc_request_t *request = &shared->requests[ticket % EEPROM_IPC_QUEUE_DEPTH];
+
+            if(CY_EM_EEPROM_SUCCESS == (cy_en_em_eeprom_status_t) request->status)
+            {
+                request->status = (uint32_t) status;
+            }
+        }
+        __DMB();
+        shared->done = head;
+    }
+
+    ipc_processing = false;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_ipc_is_ready
+********************************************************************************
+*
+* Summary:
+* Returns true once the owner core has opened the queue.
+*
+*******************************************************************************/
+bool eeprom_ipc_is_ready(void)
+{
+    return (NULL != ipc_get_shared());
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_ipc_read
+********************************************************************************
+*
+* Summary:
+* Copies data out of the shared image on either core. The image holds the
+* writes of all batches served so far. If the owner updates the copied range
+* meanwhile, the copy is repeated.
+*
+* Parameters:
+* uint32_t addr: logical address.
+* void *data: destination buffer.
+* uint32_t size: size in bytes.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_BAD_PARAM if the owner is not ready or the range is outside
+*  the shared image.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_ipc_read(uint32_t addr, void *data, uint32_t size)
+{
+    eeprom_ipc_shared_t *shared = ipc_get_shared();
+    uint32_t sequence;
+
+    if((NULL == shared) || (NULL == data) || (addr < shared->base) ||
+       ((addr - shared->base) > shared->size) || (size > (shared->size - (addr - shared->base))))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    do
+    {
+        sequence = shared->sequence;
+        __DMB();
+        memcpy(data, &shared->image[addr - shared->base], size);
+        __DMB();
+    } while((0u != (sequence & 1u)) || (sequence != shared->sequence));
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_ipc_write
+********************************************************************************
+*
+* Summary:
+* Queues a write on either core and signals the owner. Several writes can be
+* queued before eeprom_ipc_sync() waits for the last of them, so that the
+* owner commits them as one batch. Waits while the queue is full; on the
+* owner core it serves the queue itself meanwhile.
+*
+* Parameters:
+* uint32_t addr: logical address.
+* const void *data: data, copied into the queue.
+* uint32_t size: size in bytes, at most EEPROM_IPC_MAX_DATA.
+* uint32_t *ticket: receives the ticket for eeprom_ipc_sync(), can be NULL.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_BAD_PARAM if the owner is not ready or the range is outside
+*  the shared image.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_ipc_write(uint32_t addr, const void *data, uint32_t size,
+                                          uint32_t *ticket)
+{
+    eeprom_ipc_shared_t *shared = ipc_get_shared();
+    eeprom_ipc_request_t *request;
+
+    if((NULL == shared) || (NULL == data) || (0u == size) ||
+       (size > EEPROM_IPC_MAX_DATA) || (addr < shared->base) ||
+       ((addr - shared->base) > shared->size) || (size > (shared->size - (addr - shared->base))))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    for(;;)
+    {
+        ipc_lock();
+        /* The slot is free once the status of its last write is published. */
+        if((shared->head - shared->done) < EEPROM_IPC_QUEUE_DEPTH)
+        {
+            break;
+        }
+        ipc_unlock(true);
+
+        /* Queue full. */
+        eeprom_ipc_process();
+    }
+
+    request = &shared->requests[shared->head % EEPROM_IPC_QUEUE_DEPTH];
+    request->addr = addr;
+    request->size = size;
+    request->ticket = shared->head + 1u;
+    memcpy(request->data, data, size);
+    __DMB();
+    shared->head++;
+    if(NULL != ticket)
+    {
+        *ticket = shared->head;
+    }
+    ipc_unlock(true);
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_ipc_sync
+********************************************************************************
+*
+* Summary:
+* Waits until the write of a ticket, and every write queued before it, is
+* committed to the flash. On the owner core it serves the queue itself.
+*
+* Parameters:
+* uint32_t ticket: ticket returned by eeprom_ipc_write().
+*
+* Return: cy_en_em_eeprom_status_t
+*  Status of the write of the ticket. CY_EM_EEPROM_BAD_PARAM if the status is
+*  no longer known because EEPROM_IPC_QUEUE_DEPTH or more writes were queued
+*  after it.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_ipc_sync(uint32_t ticket)
+{
+    eeprom_ipc_shared_t *shared = ipc_get_shared();
+    const eeprom_ipc_request_t *request;
+    uint32_t status;
+
+    if(NULL == shared)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    while((int32_t) (shared->done - ticket) < 0)
+    {
+        eeprom_ipc_process();
+    }
+    __DMB();
+
+    /* The slot can be reused while it is read. */
+    request = &shared->requests[(ticket - 1u) % EEPROM_IPC_QUEUE_DEPTH];
+    status = request->status;
+    __DMB();
+    if(ticket != request->ticket)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    return (cy_en_em_eeprom_status_t) status;
+}
+
+
+/*******************************************************************************
+* Function Name: ipc_get_shared
+********************************************************************************
+*
+* Summary:
+* Returns the shared memory of the owner core, or NULL while the owner has not
+* opened the queue. The other core reads its address from the data register
+* of EEPROM_IPC_CHANNEL, which is zero after a reset.
+*
+*******************************************************************************/
+static eeprom_ipc_shared_t *ipc_get_shared(void)
+{
+    eeprom_ipc_shared_t *shared = ipc_shared;
+
+    if(NULL == shared)
+    {
+        shared = (eeprom_ipc_shared_t *) (uintptr_t)
+                 Cy_IPC_Drv_ReadDataValue(Cy_IPC_Drv_GetIpcBaseAddress(EEPROM_IPC_CHANNEL));
+        if((NULL == shared) || (IPC_READY_MAGIC != shared->ready))
+        {
+            return NULL;
+        }
+        __DMB();
+        ipc_shared = shared;
+    }
+    return shared;
+}
+
+
+/*******************************************************************************
+* Function Name: ipc_lock
+********************************************************************************
+*
+* Summary:
+* Takes the hardware lock of EEPROM_IPC_CHANNEL, which both cores see.
+*
+*******************************************************************************/
+static void ipc_lock(void)
+{
+    IPC_STRUCT_Type *channel = Cy_IPC_Drv_GetIpcBaseAddress(EEPROM_IPC_CHANNEL);
+
+    while(CY_IPC_DRV_SUCCESS != Cy_IPC_Drv_LockAcquire(channel))
+    {
+        /* Held by the other core. */
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: ipc_unlock
+********************************************************************************
+*
+* Summary:
+* Releases the lock. With notify set, the release raises the interrupt of
+* EEPROM_IPC_INTR, which the owner core serves if EEPROM_IPC_IRQN is defined.
+*
+*******************************************************************************/
+static void ipc_unlock(bool notify)
+{
+    (void) Cy_IPC_Drv_LockRelease(Cy_IPC_Drv_GetIpcBaseAddress(EEPROM_IPC_CHANNEL),
+                                  notify ? (1uL << EEPROM_IPC_INTR) : CY_IPC_NO_NOTIFICATION);
+}
+
+
+#if defined(EEPROM_IPC_IRQN)
+/*******************************************************************************
+* Function Name: ipc_isr
+********************************************************************************
+*
+* Summary:
+* Release interrupt of EEPROM_IPC_CHANNEL on the owner core.
+*
+*******************************************************************************/
+static void ipc_isr(void)
+{
+    Cy_IPC_Drv_ClearInterrupt(Cy_IPC_Drv_GetIntrBaseAddr(EEPROM_IPC_INTR),
+                              1uL << EEPROM_IPC_CHANNEL, CY_IPC_NO_NOTIFICATION);
+    eeprom_ipc_process();
+}
+#endif
+
+
+/* [] END OF FILE */
@@ -0,0 +1,143 @@
+/******************************************************************************
+* File Name: eeprom_ipc.h
+*
+* Description: This file contains the interface of the dual-core access layer.
+*              One core owns the Em_EEPROM instance; both cores queue writes to
+*              it through shared memory and read a shared image of the content
+*              without a round trip to the owner.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_IPC_H
+#define EEPROM_IPC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of writes that can be queued by both cores together. */
+#ifndef EEPROM_IPC_QUEUE_DEPTH
+#define EEPROM_IPC_QUEUE_DEPTH          (8u)
+#endif
+
+/* Largest payload of one queued write. */
+#ifndef EEPROM_IPC_MAX_DATA
+#define EEPROM_IPC_MAX_DATA             (32u)
+#endif
+
+/* Size of the shared image, the largest logical range both cores can
+ * access.
+ */
+#ifndef EEPROM_IPC_IMAGE_SIZE
+#define EEPROM_IPC_IMAGE_SIZE           (256u)
+#endif
+
+/* IPC channel whose hardware lock guards the write queue, and the IPC
+ * interrupt structure its release event is signaled to.
+ */
+#ifndef EEPROM_IPC_CHANNEL
+#define EEPROM_IPC_CHANNEL              (CY_IPC_CHAN_USER)
+#endif
+#ifndef EEPROM_IPC_INTR
+#define EEPROM_IPC_INTR                 (CY_IPC_INTR_USER)
+#endif
+
+/* Interrupt line of EEPROM_IPC_INTR on the owner core. When EEPROM_IPC_IRQN
+ * is defined, the owner serves the queue in that interrupt at
+ * EEPROM_IPC_INTR_PRIORITY; otherwise call eeprom_ipc_process() from the main
+ * loop of the owner core.
+ */
+#ifndef EEPROM_IPC_INTR_PRIORITY
+#define EEPROM_IPC_INTR_PRIORITY        (7u)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* A queued write. ticket and status stay valid after the write is
+ * committed, until the slot is reused EEPROM_IPC_QUEUE_DEPTH writes later.
+ */
+typedef struct
+{
+    uint32_t addr;
+    uint32_t size;
+    volatile uint32_t ticket;
+    volatile uint32_t status;
+    uint8_t data[EEPROM_IPC_MAX_DATA];
+} eeprom_ipc_request_t;
+
+/* Shared memory of both cores. head is advanced by the writers under the IPC
+ * lock, tail by the owner when it takes a request, done once the batch the
+ * request was part of is committed. A slot is reused only after done has
+ * passed it.
+ */
+typedef struct
+{
+    volatile uint32_t ready;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t done;
+    /* Odd while the owner updates the image. */
+    volatile uint32_t sequence;
+    uint32_t base;
+    uint32_t size;
+    eeprom_ipc_request_t requests[EEPROM_IPC_QUEUE_DEPTH];
+    uint8_t image[EEPROM_IPC_IMAGE_SIZE];
+} eeprom_ipc_shared_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_ipc_owner_init(cy_stc_eeprom_context_t *context,
+                                               uint32_t base, uint32_t size);
+void eeprom_ipc_process(void);
+bool eeprom_ipc_is_ready(void);
+cy_en_em_eeprom_status_t eeprom_ipc_read(uint32_t addr, void *data, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_ipc_write(uint32_t addr, const void *data, uint32_t size,
+                                          uint32_t *ticket);
+cy_en_em_eeprom_status_t eeprom_ipc_sync(uint32_t ticket);
+
+#endif /* EEPROM_IPC_H */
+
+/* [] END OF FILE */
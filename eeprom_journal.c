@@ -0,0 +1,478 @@
+/******************************************************************************
+* File Name: eeprom_journal.c
+*
+* Description: This file implements the emergency journal. Records are
+*              appended to a RAM image of a pre-erased flash row and
+*              programmed with one row program, without an erase and
+*              without the redundant copy, so that the brown-out interrupt
+*              saves the dirty data of a cache within the hold-up time of
+*              the supply. The access layer replays the records into the
+*              Em_EEPROM before the first access of the next boot and
+*              erases the row again.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_crc.h"
+#include "eeprom_fastinit.h"
+#include "eeprom_io.h"
+#include "eeprom_journal.h"
+#include "eeprom_registry.h"
+#include "eeprom_shadow.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define JOURNAL_WORD_CRC        (0u)
+#define JOURNAL_WORD_HEADER     (1u)
+
+#define JOURNAL_PADDED(size)    (((size) + 3u) & ~3u)
+#define JOURNAL_RECORD_SIZE(size) (EEPROM_JOURNAL_RECORD_HEADER_SIZE + JOURNAL_PADDED(size))
+
+/* Every commit programs the row and adds at least one record of one word. */
+_Static_assert((EEPROM_FLASH_ROW_SIZE / JOURNAL_RECORD_SIZE(1u)) <= EEPROM_FLASH_MAX_PROGRAMS,
+               "Journal rows need more programs between erases than the flash allows");
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static bool journal_record(const eeprom_journal_t *journal, uint32_t offset,
+                           uint32_t *addr, uint32_t *size);
+static uint32_t journal_record_crc(const eeprom_journal_t *journal, uint32_t offset,
+                                   uint32_t size);
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Journals by instance, looked up when an instance is initialized. */
+EEPROM_REGISTRY_DEFINE(journal_registry, EEPROM_JOURNAL_MAX_INSTANCES);
+
+
+/*******************************************************************************
+* Function Name: eeprom_journal_init
+********************************************************************************
+*
+* Summary:
+* Loads the journal row and attaches it to an Em_EEPROM instance. The records
+* left by the last brown-out are replayed into the instance right away if it
+* is initialized, or by the access layer as part of its lazy initialization
+* otherwise, so in both cases before the first access returns. Attach the
+* journal before the instance is first accessed.
+*
+* Parameters:
+* eeprom_journal_t *journal: journal instance.
+* const cy_stc_eeprom_config_t *config: configuration of the instance, used to
+*  refresh the fast-init hint after a replay. Can be NULL.
+* cy_stc_eeprom_context_t *context: Em_EEPROM instance.
+* uint32_t area: row-aligned flash address of EEPROM_JOURNAL_AREA_SIZE bytes.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_journal_init(eeprom_journal_t *journal,
+                                             const cy_stc_eeprom_config_t *config,
+                                             cy_stc_eeprom_context_t *context,
+                                             uint32_t area)
+{
+    uint32_t free_slot;
+    uint32_t offset = 0u;
+    uint32_t addr;
+    uint32_t size;
+
+    if((NULL == journal) || (NULL == context) ||
+       (0u != (area % EEPROM_FLASH_ROW_SIZE)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    free_slot = eeprom_registry_slot(&journal_registry, journal, context);
+    if(EEPROM_JOURNAL_MAX_INSTANCES == free_slot)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    journal->config = config;
+    journal->context = context;
+    journal->area = area;
+    (void) memcpy(journal->row, (const void *) area, EEPROM_FLASH_ROW_SIZE);
+
+    while(journal_record(journal, offset, &addr, &size))
+    {
+        offset += JOURNAL_RECORD_SIZE(size);
+    }
+
+    /* New records go behind the valid ones. A torn record leaves bits in its
+     * place, so the row takes no records until it is erased again.
+     */
+    journal->used = offset;
+    for(uint32_t i = offset / sizeof(uint32_t); i < EEPROM_FLASH_ROW_WORDS; i++)
+    {
+        if(EEPROM_FLASH_ERASED_WORD != journal->row[i])
+        {
+            journal->used = EEPROM_FLASH_ROW_SIZE;
+            break;
+        }
+    }
+    journal->committed = journal->used;
+
+    eeprom_registry_set(&journal_registry, free_slot, journal, context);
+
+    return eeprom_io_is_ready(context) ? eeprom_journal_replay(context) : CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_journal_stage
+********************************************************************************
+*
+* Summary:
+* Appends the data of a logical range to the RAM image of the row, as one
+* record per EEPROM_JOURNAL_RECORD_DATA_SIZE bytes. Nothing is staged if the
+* row cannot take all of it. Can be called from an interrupt that does not
+* preempt another call on the same journal.
+*
+* Parameters:
+* eeprom_journal_t *journal: journal instance.
+* uint32_t addr: logical address of the data.
+* const void *data: data to save.
+* uint32_t size: number of bytes.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_WRITE_FAIL if the row is full.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_journal_stage(eeprom_journal_t *journal, uint32_t addr,
+                                              const void *data, uint32_t size)
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint32_t full = size / EEPROM_JOURNAL_RECORD_DATA_SIZE;
+    uint32_t rest = size % EEPROM_JOURNAL_RECORD_DATA_SIZE;
+    uint32_t needed;
+    uint32_t chunk;
+    uint32_t word;
+
+    if((NULL == journal) || (NULL == data) || (0u == size) ||
+       (addr > (uint32_t) UINT16_MAX) || (size > ((uint32_t) UINT16_MAX + 1u - addr)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    needed = (full * JOURNAL_RECORD_SIZE(EEPROM_JOURNAL_RECORD_DATA_SIZE)) +
+             ((0u != rest) ? JOURNAL_RECORD_SIZE(rest) : 0u);
+    if(needed > (EEPROM_FLASH_ROW_SIZE - journal->used))
+    {
+        return CY_EM_EEPROM_WRITE_FAIL;
+    }
+
+    while(0u != size)
+    {
+        chunk = (size < EEPROM_JOURNAL_RECORD_DATA_SIZE) ? size : EEPROM_JOURNAL_RECORD_DATA_SIZE;
+        word = journal->used / sizeof(uint32_t);
+
+        journal->row[word + JOURNAL_WORD_HEADER] = addr | (chunk << 16u);
+        (void) memcpy(&journal->row[word + 2u], bytes, chunk);
+        journal->row[word + JOURNAL_WORD_CRC] = journal_record_crc(journal, journal->used, chunk);
+        journal->used += JOURNAL_RECORD_SIZE(chunk);
+
+        addr += chunk;
+        bytes += chunk;
+        size -= chunk;
+    }
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_journal_commit
+********************************************************************************
+*
+* Summary:
+* Programs the staged records with a single row program. The records already
+* in the flash keep their bits, so no erase is needed.
+*
+* Parameters:
+* eeprom_journal_t *journal: journal instance.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_journal_commit(eeprom_journal_t *journal)
+{
+    if(NULL == journal)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    if(journal->committed != journal->used)
+    {
+        if(CY_FLASH_DRV_SUCCESS != eeprom_flash_program_row(journal->area, journal->row))
+        {
+            return CY_EM_EEPROM_WRITE_FAIL;
+        }
+        journal->committed = journal->used;
+    }
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_journal_append
+********************************************************************************
+*
+* Summary:
+* Stages the data of one logical range and programs it.
+*
+* Parameters:
+* eeprom_journal_t *journal: journal instance.
+* uint32_t addr: logical address of the data.
+* const void *data: data to save.
+* uint32_t size: number of bytes.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_journal_append(eeprom_journal_t *journal, uint32_t addr,
+                                               const void *data, uint32_t size)
+{
+    cy_en_em_eeprom_status_t status = eeprom_journal_stage(journal, addr, data, size);
+
+    if(CY_EM_EEPROM_SUCCESS == status)
+    {
+        status = eeprom_journal_commit(journal);
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_journal_is_empty
+********************************************************************************
+*
+* Summary:
+* Checks whether the row is erased and nothing is staged.
+*
+* Parameters:
+* const eeprom_journal_t *journal: journal instance.
+*
+* Return: bool
+*
+*******************************************************************************/
+bool eeprom_journal_is_empty(const eeprom_journal_t *journal)
+{
+    return ((NULL == journal) || (0u == journal->used));
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_journal_discard
+********************************************************************************
+*
+* Summary:
+* Erases the row so that it is ready for the next brown-out. Call it once the
+* Em_EEPROM holds the data of the records, such as after the cache they were
+* taken from is flushed.
+*
+* Parameters:
+* eeprom_journal_t *journal: journal instance.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_journal_discard(eeprom_journal_t *journal)
+{
+    if(NULL == journal)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    if(!eeprom_flash_row_is_erased(journal->area) &&
+       (CY_FLASH_DRV_SUCCESS != eeprom_flash_erase_row(journal->area)))
+    {
+        return CY_EM_EEPROM_WRITE_FAIL;
+    }
+
+    (void) memset(journal->row, EEPROM_FLASH_ERASED_VALUE, EEPROM_FLASH_ROW_SIZE);
+    journal->used = 0u;
+    journal->committed = 0u;
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_journal_replay
+********************************************************************************
+*
+* Summary:
+* Writes the records of the journal attached to an Em_EEPROM instance into
+* the instance, oldest first, and erases the row. The writes bypass the
+* access layer, which calls it while it initializes the instance. A replay
+* interrupted by a power loss is repeated on the next boot.
+*
+* Parameters:
+* cy_stc_eeprom_context_t *context: Em_EEPROM instance, initialized.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_SUCCESS if no journal is attached.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_journal_replay(cy_stc_eeprom_context_t *context)
+{
+    cy_en_em_eeprom_status_t status;
+    eeprom_journal_t *journal;
+    eeprom_shadow_t *shadow;
+    uint32_t offset = 0u;
+    uint32_t addr;
+    uint32_t size;
+
+    journal = eeprom_journal_find(context);
+    if((NULL == journal) || (0u == journal->used))
+    {
+        return CY_EM_EEPROM_SUCCESS;
+    }
+
+    shadow = eeprom_shadow_find(context);
+    if(journal_record(journal, 0u, &addr, &size))
+    {
+        /* The hint describes the flash before the replay. */
+        eeprom_fastinit_invalidate();
+    }
+
+    while(journal_record(journal, offset, &addr, &size))
+    {
+        /* Records outside the instance were left by a larger configuration. */
+        if((size <= context->eepromSize) && (addr <= (context->eepromSize - size)))
+        {
+            const uint32_t *data = &journal->row[(offset / sizeof(uint32_t)) + 2u];
+
+            status = Cy_Em_EEPROM_Write(addr, data, size, context);
+            if(NULL != shadow)
+            {
+                eeprom_shadow_update(shadow, addr, data, size, status);
+            }
+            if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+            {
+                return status;
+            }
+        }
+        offset += JOURNAL_RECORD_SIZE(size);
+    }
+
+    if(CY_EM_EEPROM_WRITE_FAIL == eeprom_journal_discard(journal))
+    {
+        return CY_EM_EEPROM_WRITE_FAIL;
+    }
+
+    if((0u != offset) && (NULL != journal->config))
+    {
+        eeprom_fastinit_update(journal->config, context);
+    }
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_journal_find
+********************************************************************************
+*
+* Summary:
+* Returns the journal attached to an Em_EEPROM instance, or NULL.
+*
+*******************************************************************************/
+eeprom_journal_t *eeprom_journal_find(const cy_stc_eeprom_context_t *context)
+{
+    return (eeprom_journal_t *) eeprom_registry_find(&journal_registry, context);
+}
+
+
+/*******************************************************************************
+* Function Name: journal_record
+********************************************************************************
+*
+* Summary:
+* Decodes the record at a byte offset of the RAM image. Returns false at the
+* erased end of the records and for a torn or corrupt record.
+*
+*******************************************************************************/
+static bool journal_record(const eeprom_journal_t *journal, uint32_t offset,
+                           uint32_t *addr, uint32_t *size)
+{
+    uint32_t word = offset / sizeof(uint32_t);
+    uint32_t header;
+
+    if(offset > (EEPROM_FLASH_ROW_SIZE - EEPROM_JOURNAL_RECORD_HEADER_SIZE))
+    {
+        return false;
+    }
+
+    header = journal->row[word + JOURNAL_WORD_HEADER];
+    *addr = header & 0xFFFFu;
+    *size = header >> 16u;
+
+    return ((0u != *size) && (*size <= EEPROM_JOURNAL_RECORD_DATA_SIZE) &&
+            (JOURNAL_RECORD_SIZE(*size) <= (EEPROM_FLASH_ROW_SIZE - offset)) &&
+            (journal->row[word + JOURNAL_WORD_CRC] == journal_record_crc(journal, offset, *size)));
+}
+
+
+/*******************************************************************************
+* Function Name: journal_record_crc
+********************************************************************************
+*
+* Summary:
+* Returns the CRC of the header word and the data of the record at a byte
+* offset of the RAM image.
+*
+*******************************************************************************/
+static uint32_t journal_record_crc(const eeprom_journal_t *journal, uint32_t offset,
+                                   uint32_t size)
+{
+    return eeprom_crc32_update(0u, &journal->row[(offset / sizeof(uint32_t)) + JOURNAL_WORD_HEADER],
+                               sizeof(uint32_t) + size);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,114 @@
+/******************************************************************************
+* File Name: eeprom_journal.h
+*
+* Description: This file contains the structure and function prototypes of the
+*              emergency journal, a pre-erased flash row that takes small
+*              records from the brown-out interrupt without an erase.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_JOURNAL_H
+#define EEPROM_JOURNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+#include "eeprom_flash.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Flash taken by one journal: a single row, placed on a row boundary and
+ * outside the Em_EEPROM storage.
+ */
+#define EEPROM_JOURNAL_AREA_SIZE        (EEPROM_FLASH_ROW_SIZE)
+
+/* Record: CRC, logical address, size, data padded to a word. */
+#define EEPROM_JOURNAL_RECORD_HEADER_SIZE (8u)
+
+/* Largest data of one record. Longer stages are split into several. */
+#ifndef EEPROM_JOURNAL_RECORD_DATA_SIZE
+#define EEPROM_JOURNAL_RECORD_DATA_SIZE (64u)
+#endif
+
+/* Journals that can be attached to the access layer. */
+#ifndef EEPROM_JOURNAL_MAX_INSTANCES
+#define EEPROM_JOURNAL_MAX_INSTANCES    (2u)
+#endif
+
+#if (EEPROM_JOURNAL_RECORD_DATA_SIZE % 4u) != 0u
+#error "EEPROM_JOURNAL_RECORD_DATA_SIZE must be a multiple of 4"
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    const cy_stc_eeprom_config_t *config;
+    cy_stc_eeprom_context_t *context;
+    uint32_t area;
+    /* Bytes of the row that hold records, and those of them in the flash. */
+    uint32_t used;
+    uint32_t committed;
+    /* Content of the row. */
+    uint32_t row[EEPROM_FLASH_ROW_WORDS];
+} eeprom_journal_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_journal_init(eeprom_journal_t *journal,
+                                             const cy_stc_eeprom_config_t *config,
+                                             cy_stc_eeprom_context_t *context,
+                                             uint32_t area);
+cy_en_em_eeprom_status_t eeprom_journal_stage(eeprom_journal_t *journal, uint32_t addr,
+                                              const void *data, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_journal_commit(eeprom_journal_t *journal);
+cy_en_em_eeprom_status_t eeprom_journal_append(eeprom_journal_t *journal, uint32_t addr,
+                                               const void *data, uint32_t size);
+bool eeprom_journal_is_empty(const eeprom_journal_t *journal);
+cy_en_em_eeprom_status_t eeprom_journal_discard(eeprom_journal_t *journal);
+cy_en_em_eeprom_status_t eeprom_journal_replay(cy_stc_eeprom_context_t *context);
+eeprom_journal_t *eeprom_journal_find(const cy_stc_eeprom_context_t *context);
+
+#endif /* EEPROM_JOURNAL_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,582 @@
+/******************************************************************************
+* File Name: eeprom_kv.c
+*
+* Description: This file implements a key-value record store on top of the
+*              Emulated EEPROM. The store is split into two banks; records are
+*              appended to the active bank as an 8-byte header (key, version,
+*              length, CRC) followed by the data. The records are scanned once
+*              at initialization to build a RAM index, so get and set access
+*              only the bytes of one record.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "eeprom_crc.h"
+#include "eeprom_io.h"
+#include "eeprom_kv.h"
+#include "eeprom_status.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define KV_HEADER_KEY       (0u)
+#define KV_HEADER_VERSION   (1u)
+#define KV_HEADER_LENGTH    (2u)
+#define KV_HEADER_CRC       (4u)
+
+/* Words of the bank header. */
+#define KV_BANK_SEQUENCE    (0u)
+#define KV_BANK_STATE       (1u)
+#define KV_BANK_CRC         (2u)
+#define KV_BANK_WORDS       (EEPROM_KV_BANK_HEADER_SIZE / sizeof(uint32_t))
+
+/* States of a bank. A rebuild claims its sequence number with a building
+ * header before it writes the first record, so no two rebuilds use the same
+ * number, and commits the bank by rewriting the header.
+ */
+#define KV_BANK_BUILDING    (0x4B564231uL)
+#define KV_BANK_COMMITTED   (0x4B564243uL)
+
+/* Largest record assembled in RAM when a record is written. */
+#define KV_MAX_RECORD_SIZE  (EEPROM_KV_HEADER_SIZE + UINT8_MAX)
+
+/* Size of each of the two banks of a store. */
+#define KV_BANK_SIZE(kv)    ((kv)->size / 2u)
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t kv_record_crc(uint32_t sequence, const uint8_t *header,
+                              const void *data, uint32_t length);
+static cy_en_em_eeprom_status_t kv_write_bank(eeprom_kv_t *kv, uint32_t state);
+static cy_en_em_eeprom_status_t kv_select_bank(eeprom_kv_t *kv, bool *found);
+static cy_en_em_eeprom_status_t kv_scan(eeprom_kv_t *kv,
+                                        const eeprom_kv_record_t *schema,
+                                        uint32_t schema_count);
+static cy_en_em_eeprom_status_t kv_append(eeprom_kv_t *kv, uint8_t key, uint8_t version,
+                                          uint8_t length, const void *data);
+static cy_en_em_eeprom_status_t kv_write(eeprom_kv_t *kv, uint8_t key, uint8_t version,
+                                         uint8_t length, const void *data);
+static cy_en_em_eeprom_status_t kv_rebuild(eeprom_kv_t *kv);
+static const eeprom_kv_record_t *kv_find_schema(const eeprom_kv_record_t *schema,
+                                                uint32_t schema_count, uint8_t key);
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Staging buffer of one record. */
+static uint8_t kv_record_buffer[KV_MAX_RECORD_SIZE];
+
+
+/*******************************************************************************
+* Function Name: eeprom_kv_init
+********************************************************************************
+*
+* Summary:
+* Scans the records of the active bank of the logical window [base, base + size)
+* and builds the RAM index. Records that are missing, or stored with another
+* version or length than in the schema, are (re)created with their defaults. If
+* the bank runs out of space, the valid records are compacted into the other
+* bank first.
+*
+* Parameters:
+* eeprom_kv_t *kv: store instance to initialize.
+* cy_stc_eeprom_context_t *context: initialized Em_EEPROM context.
+* uint32_t base: first logical address of the store.
+* uint32_t size: number of bytes of the store, both banks included.
+* const eeprom_kv_record_t *schema: records expected by the firmware.
+* uint32_t schema_count: number of entries in schema.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_kv_init(eeprom_kv_t *kv, cy_stc_eeprom_context_t *context,
+                                        uint32_t base, uint32_t size,
+                                        const eeprom_kv_record_t *schema,
+                                        uint32_t schema_count)
+{
+    cy_en_em_eeprom_status_t status;
+    bool found;
+
+    if((NULL == kv) || (NULL == context) || (NULL == schema) ||
+       (size >= EEPROM_KV_NO_RECORD) ||
+       ((size / 2u) < (EEPROM_KV_BANK_HEADER_SIZE + EEPROM_KV_HEADER_SIZE)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    for(uint32_t i = 0u; i < schema_count; i++)
+    {
+        if((schema[i].key >= EEPROM_KV_MAX_KEYS) || (NULL == schema[i].defaults))
+        {
+            return CY_EM_EEPROM_BAD_PARAM;
+        }
+    }
+
+    kv->context = context;
+    kv->base = base;
+    kv->size = size;
+    memset(kv->index, 0xFF, sizeof(kv->index));
+    memset(kv->length, 0, sizeof(kv->length));
+    memset(kv->version, 0, sizeof(kv->version));
+
+    status = kv_select_bank(kv, &found);
+    if(found)
+    {
+        status = eeprom_status_combine(status, kv_scan(kv, schema, schema_count));
+    }
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+
+    for(uint32_t i = 0u; i < schema_count; i++)
+    {
+        if(EEPROM_KV_NO_RECORD == kv->index[schema[i].key])
+        {
+            status = eeprom_status_combine(status,
+                                           kv_write(kv, schema[i].key, schema[i].version,
+                                                    schema[i].length, schema[i].defaults));
+            if(eeprom_status_failed(status))
+            {
+                return status;
+            }
+        }
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_kv_get
+********************************************************************************
+*
+* Summary:
+* Reads the data of one record.
+*
+* Parameters:
+* eeprom_kv_t *kv: store instance.
+* uint8_t key: record key.
+* void *data: destination buffer.
+* uint32_t size: size of the destination, must equal the record length.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_kv_get(eeprom_kv_t *kv, uint8_t key,
+                                       void *data, uint32_t size)
+{
+    if((NULL == kv) || (NULL == data) || (key >= EEPROM_KV_MAX_KEYS) ||
+       (EEPROM_KV_NO_RECORD == kv->index[key]) || (size != kv->length[key]))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    return eeprom_io_read(kv->base + kv->index[key] + EEPROM_KV_HEADER_SIZE,
+                          data, size, kv->context);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_kv_set
+********************************************************************************
+*
+* Summary:
+* Writes the data of one record. The record is appended; the previous one is
+* only superseded once the new one passes its CRC, so a reset during the write
+* leaves either the old or the new data.
+*
+* Parameters:
+* eeprom_kv_t *kv: store instance.
+* uint8_t key: record key.
+* const void *data: source buffer.
+* uint32_t size: size of the source, must equal the record length.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_kv_set(eeprom_kv_t *kv, uint8_t key,
+                                       const void *data, uint32_t size)
+{
+    if((NULL == kv) || (NULL == data) || (key >= EEPROM_KV_MAX_KEYS) ||
+       (EEPROM_KV_NO_RECORD == kv->index[key]) || (size != kv->length[key]))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    return kv_write(kv, key, kv->version[key], kv->length[key], data);
+}
+
+
+/*******************************************************************************
+* Function Name: kv_record_crc
+********************************************************************************
+*
+* Summary:
+* Computes the CRC of a record over the sequence number of its bank, the first
+* bytes of its header and its data. Records left over from an earlier use of
+* the bank carry another sequence number and fail the check, as does the
+* all-zero content of an erased Em_EEPROM.
+*
+*******************************************************************************/
+static uint32_t kv_record_crc(uint32_t sequence, const uint8_t *header,
+                              const void *data, uint32_t length)
+{
+    uint32_t crc;
+
+    crc = eeprom_crc32_update(0u, &sequence, sizeof(sequence));
+    crc = eeprom_crc32_update(crc, header, KV_HEADER_CRC);
+    return eeprom_crc32_update(crc, data, length);
+}
+
+
+/*******************************************************************************
+* Function Name: kv_write_bank
+********************************************************************************
+*
+* Summary:
+* Writes the header of the active bank with its sequence number and a state.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t kv_write_bank(eeprom_kv_t *kv, uint32_t state)
+{
+    uint32_t header[KV_BANK_WORDS];
+
+    header[KV_BANK_SEQUENCE] = kv->sequence;
+    header[KV_BANK_STATE] = state;
+    header[KV_BANK_CRC] = eeprom_crc32_update(0u, header, KV_BANK_CRC * sizeof(uint32_t));
+
+    return eeprom_io_write(kv->base + kv->bank, header, sizeof(header), kv->context);
+}
+
+
+/*******************************************************************************
+* Function Name: kv_select_bank
+********************************************************************************
+*
+* Summary:
+* Reads the headers of both banks and makes the committed one with the newer
+* sequence number the active bank. If neither is committed, the second bank is
+* marked full, so that the first write builds the first bank.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t kv_select_bank(eeprom_kv_t *kv, bool *found)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    uint32_t header[KV_BANK_WORDS];
+    bool claimed = false;
+
+    *found = false;
+    kv->bank = KV_BANK_SIZE(kv);
+    kv->sequence = 0u;
+    kv->last_sequence = 0u;
+    kv->end = kv->bank + KV_BANK_SIZE(kv);
+
+    for(uint32_t bank = 0u; bank < kv->size; bank += KV_BANK_SIZE(kv))
+    {
+        status = eeprom_status_combine(status,
+                                       eeprom_io_read(kv->base + bank, header,
+                                                      sizeof(header), kv->context));
+        if(eeprom_status_failed(status))
+        {
+            return status;
+        }
+        if(header[KV_BANK_CRC] != eeprom_crc32_update(0u, header,
+                                                      KV_BANK_CRC * sizeof(uint32_t)))
+        {
+            continue;
+        }
+
+        /* The serial comparisons stay correct across a sequence wrap-around. */
+        if((!claimed) || ((int32_t) (header[KV_BANK_SEQUENCE] - kv->last_sequence) > 0))
+        {
+            claimed = true;
+            kv->last_sequence = header[KV_BANK_SEQUENCE];
+        }
+        if((KV_BANK_COMMITTED == header[KV_BANK_STATE]) &&
+           ((!*found) || ((int32_t) (header[KV_BANK_SEQUENCE] - kv->sequence) > 0)))
+        {
+            *found = true;
+            kv->bank = bank;
+            kv->sequence = header[KV_BANK_SEQUENCE];
+            kv->end = bank + EEPROM_KV_BANK_HEADER_SIZE;
+        }
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: kv_scan
+********************************************************************************
+*
+* Summary:
+* Walks the records of the active bank until the first one that fails its CRC
+* and indexes every record that matches the schema. A later record with the
+* same key replaces an earlier one.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t kv_scan(eeprom_kv_t *kv,
+                                        const eeprom_kv_record_t *schema,
+                                        uint32_t schema_count)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    const eeprom_kv_record_t *record;
+    uint8_t *header = kv_record_buffer;
+    uint8_t *data = &kv_record_buffer[EEPROM_KV_HEADER_SIZE];
+    uint32_t limit = kv->bank + KV_BANK_SIZE(kv);
+    uint32_t offset = kv->end;
+    uint32_t crc;
+
+    while((offset + EEPROM_KV_HEADER_SIZE) <= limit)
+    {
+        status = eeprom_status_combine(status,
+                                       eeprom_io_read(kv->base + offset, header,
+                                                      EEPROM_KV_HEADER_SIZE, kv->context));
+        if(eeprom_status_failed(status))
+        {
+            return status;
+        }
+
+        if((offset + EEPROM_KV_HEADER_SIZE + header[KV_HEADER_LENGTH]) > limit)
+        {
+            break;
+        }
+
+        status = eeprom_status_combine(status,
+                                       eeprom_io_read(kv->base + offset + EEPROM_KV_HEADER_SIZE,
+                                                      data, header[KV_HEADER_LENGTH],
+                                                      kv->context));
+        if(eeprom_status_failed(status))
+        {
+            return status;
+        }
+
+        memcpy(&crc, &header[KV_HEADER_CRC], sizeof(crc));
+        if(crc != kv_record_crc(kv->sequence, header, data, header[KV_HEADER_LENGTH]))
+        {
+            break;
+        }
+
+        record = kv_find_schema(schema, schema_count, header[KV_HEADER_KEY]);
+        if((NULL != record) && (record->version == header[KV_HEADER_VERSION]) &&
+           (record->length == header[KV_HEADER_LENGTH]))
+        {
+            kv->index[record->key] = (uint16_t) offset;
+            kv->length[record->key] = record->length;
+            kv->version[record->key] = record->version;
+        }
+        else if((NULL != record) && (EEPROM_KV_NO_RECORD != kv->index[record->key]))
+        {
+            /* A newer record of another version supersedes the older one. */
+            kv->index[record->key] = EEPROM_KV_NO_RECORD;
+            kv->length[record->key] = 0u;
+        }
+
+        offset += EEPROM_KV_HEADER_SIZE + header[KV_HEADER_LENGTH];
+    }
+
+    kv->end = offset;
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: kv_append
+********************************************************************************
+*
+* Summary:
+* Appends a record to the active bank with one Em_EEPROM write of header and
+* data. Returns CY_EM_EEPROM_BAD_PARAM if the bank has no room left.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t kv_append(eeprom_kv_t *kv, uint8_t key, uint8_t version,
+                                          uint8_t length, const void *data)
+{
+    cy_en_em_eeprom_status_t status;
+    uint32_t record_size = EEPROM_KV_HEADER_SIZE + length;
+    uint32_t crc;
+
+    if((kv->end + record_size) > (kv->bank + KV_BANK_SIZE(kv)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    memset(kv_record_buffer, 0, EEPROM_KV_HEADER_SIZE);
+    kv_record_buffer[KV_HEADER_KEY] = key;
+    kv_record_buffer[KV_HEADER_VERSION] = version;
+    kv_record_buffer[KV_HEADER_LENGTH] = length;
+    memcpy(&kv_record_buffer[EEPROM_KV_HEADER_SIZE], data, length);
+    crc = kv_record_crc(kv->sequence, kv_record_buffer,
+                        &kv_record_buffer[EEPROM_KV_HEADER_SIZE], length);
+    memcpy(&kv_record_buffer[KV_HEADER_CRC], &crc, sizeof(crc));
+
+    status = eeprom_io_write(kv->base + kv->end, kv_record_buffer, record_size,
+                             kv->context);
+
+    if(!eeprom_status_failed(status))
+    {
+        kv->index[key] = (uint16_t) kv->end;
+        kv->length[key] = length;
+        kv->version[key] = version;
+        kv->end += record_size;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: kv_write
+********************************************************************************
+*
+* Summary:
+* Appends a record and compacts the store into the other bank first if the
+* active bank is full.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t kv_write(eeprom_kv_t *kv, uint8_t key, uint8_t version,
+                                         uint8_t length, const void *data)
+{
+    cy_en_em_eeprom_status_t status;
+
+    if((kv->end + EEPROM_KV_HEADER_SIZE + length) > (kv->bank + KV_BANK_SIZE(kv)))
+    {
+        status = kv_rebuild(kv);
+        if(eeprom_status_failed(status))
+        {
+            return status;
+        }
+        return eeprom_status_combine(status, kv_append(kv, key, version, length, data));
+    }
+
+    return kv_append(kv, key, version, length, data);
+}
+
+
+/*******************************************************************************
+* Function Name: kv_rebuild
+********************************************************************************
+*
+* Summary:
+* Copies the indexed records into the other bank under a new sequence number
+* and then commits that bank. The active bank is not written, so after a reset
+* during the rebuild the scan still selects it with all its records. Records
+* left in the other bank by an interrupted rebuild carry an older sequence
+* number and fail their CRC.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t kv_rebuild(eeprom_kv_t *kv)
+{
+    cy_en_em_eeprom_status_t status;
+    uint8_t data[UINT8_MAX];
+    eeprom_kv_t active = *kv;
+
+    kv->bank = (0u == active.bank) ? KV_BANK_SIZE(kv) : 0u;
+    kv->sequence = active.last_sequence + 1u;
+    kv->last_sequence = kv->sequence;
+    kv->end = kv->bank + EEPROM_KV_BANK_HEADER_SIZE;
+
+    status = kv_write_bank(kv, KV_BANK_BUILDING);
+
+    for(uint32_t key = 0u; (key < EEPROM_KV_MAX_KEYS) && !eeprom_status_failed(status); key++)
+    {
+        if(EEPROM_KV_NO_RECORD != active.index[key])
+        {
+            status = eeprom_status_combine(status,
+                                           eeprom_io_read(kv->base + active.index[key] +
+                                                          EEPROM_KV_HEADER_SIZE,
+                                                          data, active.length[key],
+                                                          kv->context));
+            if(!eeprom_status_failed(status))
+            {
+                status = eeprom_status_combine(status,
+                                               kv_append(kv, (uint8_t) key, active.version[key],
+                                                         active.length[key], data));
+            }
+        }
+    }
+
+    if(!eeprom_status_failed(status))
+    {
+        status = eeprom_status_combine(status, kv_write_bank(kv, KV_BANK_COMMITTED));
+    }
+
+    if(eeprom_status_failed(status))
+    {
+        /* Not committed: the active bank stays the one selected at start-up,
+         * but the claimed sequence number is not used again.
+         */
+        active.last_sequence = kv->last_sequence;
+        *kv = active;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: kv_find_schema
+********************************************************************************
+*
+* Summary:
+* Looks up the schema entry of a key.
+*
+*******************************************************************************/
+static const eeprom_kv_record_t *kv_find_schema(const eeprom_kv_record_t *schema,
+                                                uint32_t schema_count, uint8_t key)
+{
+    for(uint32_t i = 0u; i < schema_count; i++)
+    {
+        if(schema[i].key == key)
+        {
+            return &schema[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,113 @@
+/******************************************************************************
+* File Name: eeprom_kv.h
+*
+* Description: This file contains the interface of the key-value record store
+*              built on the Emulated EEPROM logical address space.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_KV_H
+#define EEPROM_KV_H
+
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of keys, keys are 0 to EEPROM_KV_MAX_KEYS - 1. Costs 4 bytes of RAM
+ * per key for the index.
+ */
+#ifndef EEPROM_KV_MAX_KEYS
+#define EEPROM_KV_MAX_KEYS              (16u)
+#endif
+
+/* Size of the header stored in front of every record. */
+#define EEPROM_KV_HEADER_SIZE           (8u)
+
+/* Size of the header at the start of each of the two banks of a store. */
+#define EEPROM_KV_BANK_HEADER_SIZE      (12u)
+
+/* Index value of a key without a record. */
+#define EEPROM_KV_NO_RECORD             (0xFFFFu)
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Schema entry of one record. A stored record is only used if its version and
+ * length match; otherwise it is replaced by a record holding the defaults.
+ */
+typedef struct
+{
+    uint8_t key;
+    uint8_t version;
+    uint8_t length;
+    const void *defaults;
+} eeprom_kv_record_t;
+
+typedef struct
+{
+    cy_stc_eeprom_context_t *context;
+    uint32_t base;
+    uint32_t size;
+    uint32_t bank;
+    uint32_t sequence;
+    uint32_t last_sequence;
+    uint32_t end;
+    uint16_t index[EEPROM_KV_MAX_KEYS];
+    uint8_t length[EEPROM_KV_MAX_KEYS];
+    uint8_t version[EEPROM_KV_MAX_KEYS];
+} eeprom_kv_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_kv_init(eeprom_kv_t *kv, cy_stc_eeprom_context_t *context,
+                                        uint32_t base, uint32_t size,
+                                        const eeprom_kv_record_t *schema,
+                                        uint32_t schema_count);
+cy_en_em_eeprom_status_t eeprom_kv_get(eeprom_kv_t *kv, uint8_t key,
+                                       void *data, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_kv_set(eeprom_kv_t *kv, uint8_t key,
+                                       const void *data, uint32_t size);
+
+#endif /* EEPROM_KV_H */
+
+/* [] END OF FILE */
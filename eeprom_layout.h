@@ -0,0 +1,106 @@
+/******************************************************************************
+* File Name: eeprom_layout.h
+*
+* Description: This file describes the layout of the demo data in the Emulated
+*              EEPROM. The field offsets are generated from a field list and are
+*              checked at compile time.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_LAYOUT_H
+#define EEPROM_LAYOUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Field list of the logical EEPROM content, in storage order. Each entry is
+ *
+ *     X(name, size, ...)
+ *
+ * with the size in bytes; any further arguments are passed through to X.
+ * Offsets follow from the order of the list.
+ */
+#define EEPROM_LAYOUT_FIELDS(X, ...) \
+    X(banner,      13u, __VA_ARGS__) \
+    X(reset_count,  2u, __VA_ARGS__)
+
+/* Offset and size of a field of eeprom_layout_t. */
+#define EEPROM_FIELD_OFFSET(field)      ((uint32_t) offsetof(eeprom_layout_t, field))
+#define EEPROM_FIELD_SIZE(field)        ((uint32_t) sizeof(((eeprom_layout_t *) 0)->field))
+
+/* Non-zero if a field crosses a boundary of row_data_size logical bytes. Such a
+ * field is stored in two Em_EEPROM rows and costs two row programs per write.
+ */
+#define EEPROM_FIELD_STRADDLES(field, start, row_data_size) \
+    ((((start) + EEPROM_FIELD_OFFSET(field)) / (row_data_size)) != \
+     (((start) + EEPROM_FIELD_OFFSET(field) + EEPROM_FIELD_SIZE(field) - 1u) / (row_data_size)))
+
+/* Checks the layout, placed at logical address start, against an Em_EEPROM of
+ * eeprom_size logical bytes that stores row_data_size logical bytes per row.
+ * Expand it once at file scope.
+ */
+#define EEPROM_LAYOUT_FIELD_CHECK(name, size, start, row_data_size) \
+    _Static_assert(!EEPROM_FIELD_STRADDLES(name, start, row_data_size), \
+                   "EEPROM field " #name " straddles an Em_EEPROM row");
+#define EEPROM_LAYOUT_CHECK(start, eeprom_size, row_data_size) \
+    _Static_assert(((start) + sizeof(eeprom_layout_t)) <= (eeprom_size), \
+                   "EEPROM layout does not fit in EEPROM_SIZE"); \
+    _Static_assert((0u != (row_data_size)) && \
+                   (0u == (CY_EM_EEPROM_FLASH_SIZEOF_ROW % (row_data_size))), \
+                   "Em_EEPROM row data size does not divide the flash row"); \
+    EEPROM_LAYOUT_FIELDS(EEPROM_LAYOUT_FIELD_CHECK, (start), (row_data_size))
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+#define EEPROM_LAYOUT_MEMBER(name, size, ...) uint8_t name[size];
+typedef __PACKED_STRUCT
+{
+    EEPROM_LAYOUT_FIELDS(EEPROM_LAYOUT_MEMBER, 0)
+} eeprom_layout_t;
+#undef EEPROM_LAYOUT_MEMBER
+
+#endif /* EEPROM_LAYOUT_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,814 @@
+/******************************************************************************
+* File Name: eeprom_log.c
+*
+* Description: This file implements the log-structured EEPROM. Each flash row
+*              holds a header with a sequence number and fixed-size record slots.
+*              A record carries one logical page; the newest valid record of a
+*              page wins. The head row is programmed without an erase as records
+*              are appended to it. When the last free row is opened, the used row
+*              with the fewest live records is copied into it and erased.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "eeprom_crc.h"
+#include "eeprom_cycles.h"
+#include "eeprom_log.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* "ELOG" */
+#define LOG_ROW_MAGIC           (0x474F4C45uL)
+
+#define LOG_HEADER_MAGIC        (0u)
+#define LOG_HEADER_SEQUENCE     (1u)
+#define LOG_HEADER_SEQUENCE_INV (2u)
+
+#define LOG_NO_SLOT             (0xFFFFu)
+
+#define LOG_ROW_ADDR(log, row)  ((log)->area + ((row) * EEPROM_FLASH_ROW_SIZE))
+#define LOG_SLOT_OFFSET(slot)   (EEPROM_LOG_ROW_HEADER_SIZE + ((slot) * EEPROM_LOG_RECORD_SIZE))
+#define LOG_GC_NONE             (0u)
+#define LOG_GC_ERASE            (1u)
+#define LOG_GC_COPY             (2u)
+#define LOG_GC_OPEN             (3u)
+
+#define LOG_PAGES(log)          (((log)->size + EEPROM_LOG_PAGE_SIZE - 1u) / EEPROM_LOG_PAGE_SIZE)
+
+/* An open row is programmed once for its header and at most once per slot. */
+_Static_assert((EEPROM_LOG_SLOTS_PER_ROW + 1u) <= EEPROM_FLASH_MAX_PROGRAMS,
+               "Log rows need more programs between erases than the flash allows");
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t crc;
+    uint16_t page;
+    uint16_t page_inv;
+    uint8_t data[EEPROM_LOG_PAGE_SIZE];
+} log_record_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static bool log_row_header(uint32_t row_addr, uint32_t *sequence);
+static bool log_record_valid(const eeprom_log_t *log, const log_record_t *record);
+static bool log_slot_is_erased(const log_record_t *record);
+static const log_record_t *log_record(const eeprom_log_t *log, uint32_t slot_id);
+static void log_set_index(eeprom_log_t *log, uint32_t page, uint32_t slot_id);
+static cy_en_em_eeprom_status_t log_append(eeprom_log_t *log, uint32_t page,
+                                           const uint8_t *data);
+static cy_en_em_eeprom_status_t log_program_head(eeprom_log_t *log);
+static cy_en_em_eeprom_status_t log_open_row(eeprom_log_t *log);
+static uint32_t log_gc_next(const eeprom_log_t *log, uint32_t *row);
+static cy_en_em_eeprom_status_t log_gc_copy(eeprom_log_t *log, uint32_t victim);
+
+
+/*******************************************************************************
+* Function Name: eeprom_log_init
+********************************************************************************
+*
+* Summary:
+* Rebuilds the index from the rows of the area, oldest row first. Records
+* that fail their CRC, such as the one being appended when the power failed,
+* are skipped. Used rows whose records are all superseded are counted as
+* free, and an interrupted compaction is rolled back. An area without any
+* valid row reads as zeros.
+*
+* Parameters:
+* eeprom_log_t *log: instance to initialize.
+* uint32_t area: row-aligned flash address of the area.
+* uint32_t rows: rows of the area, at least EEPROM_LOG_MIN_ROWS(size).
+* uint32_t size: logical size in bytes, at most EEPROM_LOG_MAX_SIZE.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_log_init(eeprom_log_t *log, uint32_t area, uint32_t rows,
+                                         uint32_t size)
+{
+    uint32_t previous = 0u;
+    uint32_t head = rows;
+
+    if((NULL == log) || (0u != (area % EEPROM_FLASH_ROW_SIZE)) || (0u == size) ||
+       (size > EEPROM_LOG_MAX_SIZE) || (rows > EEPROM_LOG_MAX_ROWS) ||
+       (rows < EEPROM_LOG_MIN_ROWS(size)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    log->area = area;
+    log->rows = rows;
+    log->size = size;
+    log->head = rows;
+    log->head_used = EEPROM_LOG_SLOTS_PER_ROW;
+    log->sequence = 0u;
+    log->free_rows = 0u;
+    log->dirty = false;
+    memset(log->row_live, 0, sizeof(log->row_live));
+    memset(log->index, 0xFF, sizeof(log->index));
+
+    for(uint32_t row = 0u; row < rows; row++)
+    {
+        if(!log_row_header(LOG_ROW_ADDR(log, row), &log->row_sequence[row]))
+        {
+            log->row_sequence[row] = 0u;
+        }
+    }
+
+    /* Replay the rows in the order they were opened. */
+    for(;;)
+    {
+        uint32_t next = rows;
+
+        for(uint32_t row = 0u; row < rows; row++)
+        {
+            if((log->row_sequence[row] > previous) &&
+               ((rows == next) || (log->row_sequence[row] < log->row_sequence[next])))
+            {
+                next = row;
+            }
+        }
+        if(rows == next)
+        {
+            break;
+        }
+
+        for(uint32_t slot = 0u; slot < EEPROM_LOG_SLOTS_PER_ROW; slot++)
+        {
+            const log_record_t *record = log_record(log, (next * EEPROM_LOG_SLOTS_PER_ROW) + slot);
+
+            if(log_record_valid(log, record))
+            {
+                log_set_index(log, record->page, (next * EEPROM_LOG_SLOTS_PER_ROW) + slot);
+            }
+        }
+
+        previous = log->row_sequence[next];
+        head = next;
+    }
+
+    /* Until now, log_record() read every row from the flash. */
+    log->head = head;
+    log->sequence = previous;
+    if(rows != head)
+    {
+        const log_record_t *record;
+
+        memcpy(log->row, (const void *) LOG_ROW_ADDR(log, log->head), EEPROM_FLASH_ROW_SIZE);
+        log->head_used = 0u;
+        for(uint32_t slot = 0u; slot < EEPROM_LOG_SLOTS_PER_ROW; slot++)
+        {
+            record = log_record(log, (log->head * EEPROM_LOG_SLOTS_PER_ROW) + slot);
+            if(!log_slot_is_erased(record))
+            {
+                log->head_used = slot + 1u;
+            }
+        }
+    }
+
+    for(uint32_t row = 0u; row < rows; row++)
+    {
+        /* A row left behind by an interrupted compaction is dead. */
+        if((row != log->head) && (0u == log->row_live[row]))
+        {
+            log->row_sequence[row] = 0u;
+        }
+        if(0u == log->row_sequence[row])
+        {
+            log->free_rows++;
+        }
+    }
+
+    /* Without a free row, the copy of a compaction into the last free row was
+     * interrupted. The row that was compacted still holds all its records, so
+     * drop the partial copy and start over.
+     */
+    if((0u == log->free_rows) && (rows != head))
+    {
+        if(CY_FLASH_DRV_SUCCESS != eeprom_flash_erase_row(LOG_ROW_ADDR(log, head)))
+        {
+            return CY_EM_EEPROM_WRITE_FAIL;
+        }
+        return eeprom_log_init(log, area, rows, size);
+    }
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_log_read
+********************************************************************************
+*
+* Summary:
+* Copies logical data out of the newest records. Pages never written read as
+* zeros.
+*
+* Parameters:
+* const eeprom_log_t *log: instance.
+* uint32_t addr: logical address.
+* void *data: destination buffer.
+* uint32_t size: size in bytes.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_log_read(const eeprom_log_t *log, uint32_t addr,
+                                         void *data, uint32_t size)
+{
+    uint8_t *bytes = (uint8_t *) data;
+
+    if((NULL == log) || (NULL == data) || (addr > log->size) || (size > (log->size - addr)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    while(0u != size)
+    {
+        uint32_t page = addr / EEPROM_LOG_PAGE_SIZE;
+        uint32_t offset = addr % EEPROM_LOG_PAGE_SIZE;
+        uint32_t chunk = EEPROM_LOG_PAGE_SIZE - offset;
+
+        if(chunk > size)
+        {
+            chunk = size;
+        }
+
+        if(LOG_NO_SLOT == log->index[page])
+        {
+            memset(bytes, 0, chunk);
+        }
+        else
+        {
+            memcpy(bytes, &log_record(log, log->index[page])->data[offset], chunk);
+        }
+
+        bytes += chunk;
+        addr += chunk;
+        size -= chunk;
+    }
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_log_write
+********************************************************************************
+*
+* Summary:
+* Appends one record for every page of the range whose content changes and
+* programs the head row once. A write of unchanged data programs nothing.
+* After a failure, call eeprom_log_init() again before the next access.
+*
+* Parameters:
+* eeprom_log_t *log: instance.
+* uint32_t addr: logical address.
+* const void *data: data to write.
+* uint32_t size: size in bytes.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_WRITE_FAIL if a flash operation failed.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_log_write(eeprom_log_t *log, uint32_t addr,
+                                          const void *data, uint32_t size)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint8_t page_data[EEPROM_LOG_PAGE_SIZE];
+
+    if((NULL == log) || (NULL == data) || (addr > log->size) || (size > (log->size - addr)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    while((0u != size) && (CY_EM_EEPROM_SUCCESS == status))
+    {
+        uint32_t page = addr / EEPROM_LOG_PAGE_SIZE;
+        uint32_t offset = addr % EEPROM_LOG_PAGE_SIZE;
+        uint32_t chunk = EEPROM_LOG_PAGE_SIZE - offset;
+
+        if(chunk > size)
+        {
+            chunk = size;
+        }
+
+        (void) eeprom_log_read(log, page * EEPROM_LOG_PAGE_SIZE, page_data,
+                               (((page + 1u) * EEPROM_LOG_PAGE_SIZE) <= log->size) ?
+                               EEPROM_LOG_PAGE_SIZE : (log->size - (page * EEPROM_LOG_PAGE_SIZE)));
+        if(0 != memcmp(&page_data[offset], bytes, chunk))
+        {
+            memcpy(&page_data[offset], bytes, chunk);
+            status = log_append(log, page, page_data);
+        }
+
+        bytes += chunk;
+        addr += chunk;
+        size -= chunk;
+    }
+
+    if((CY_EM_EEPROM_SUCCESS == status) && log->dirty)
+    {
+        status = log_program_head(log);
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_log_gc_step
+********************************************************************************
+*
+* Summary:
+* Runs background compaction for up to budget_ms. Free rows are erased ahead
+* of need, and while fewer than EEPROM_LOG_GC_FREE_ROWS rows are free, the
+* live records of the used row with the fewest of them are moved to the head
+* row and the emptied row is erased. A write issued between two steps then
+* finds an erased row and costs a row program. Each flash operation is
+* started only if its worst-case duration fits in the rest of the budget, so
+* a budget shorter than EEPROM_LOG_GC_ERASE_US does not erase. Call it from
+* the idle loop or an RTOS idle hook, not concurrently with a write.
+*
+* Parameters:
+* eeprom_log_t *log: instance.
+* uint32_t budget_ms: longest time to spend.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_WRITE_FAIL if a flash operation failed.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_log_gc_step(eeprom_log_t *log, uint32_t budget_ms)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    uint32_t budget_us = budget_ms * 1000u;
+    uint32_t planned_us = 0u;
+    uint32_t start = eeprom_cycles_now();
+
+    if(NULL == log)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    while(CY_EM_EEPROM_SUCCESS == status)
+    {
+        uint32_t row = log->rows;
+        uint32_t work = log_gc_next(log, &row);
+        uint32_t cost_us = EEPROM_LOG_GC_PROGRAM_US;
+        uint32_t spent_us = eeprom_cycles_to_us(eeprom_cycles_now() - start);
+
+        if(LOG_GC_ERASE == work)
+        {
+            cost_us = EEPROM_LOG_GC_ERASE_US;
+        }
+        else if((LOG_GC_OPEN == work) && (1u == log->free_rows))
+        {
+            /* Opening the last free row compacts into it. */
+            cost_us = EEPROM_LOG_GC_PROGRAM_US + EEPROM_LOG_GC_ERASE_US;
+        }
+        else
+        {
+            /* One program. */
+        }
+
+        /* The cycle counter may not run, rely on the plan as well. */
+        spent_us = (spent_us > planned_us) ? spent_us : planned_us;
+        if((LOG_GC_NONE == work) || (spent_us > budget_us) || (cost_us > (budget_us - spent_us)))
+        {
+            break;
+        }
+        planned_us += cost_us;
+
+        if(LOG_GC_ERASE == work)
+        {
+            if(CY_FLASH_DRV_SUCCESS != eeprom_flash_erase_row(LOG_ROW_ADDR(log, row)))
+            {
+                status = CY_EM_EEPROM_WRITE_FAIL;
+            }
+            else if(0u != log->row_sequence[row])
+            {
+                /* An emptied row. */
+                log->row_sequence[row] = 0u;
+                log->free_rows++;
+            }
+            else
+            {
+                /* A free row erased ahead of need. */
+            }
+        }
+        else if(LOG_GC_OPEN == work)
+        {
+            status = log_open_row(log);
+        }
+        else
+        {
+            status = log_gc_copy(log, row);
+        }
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_log_gc_pending
+********************************************************************************
+*
+* Summary:
+* Returns true if eeprom_log_gc_step() has work left.
+*
+*******************************************************************************/
+bool eeprom_log_gc_pending(const eeprom_log_t *log)
+{
+    uint32_t row;
+
+    return ((NULL != log) && (LOG_GC_NONE != log_gc_next(log, &row)));
+}
+
+
+/*******************************************************************************
+* Function Name: log_row_header
+********************************************************************************
+*
+* Summary:
+* Checks the header of a row and returns its sequence number.
+*
+*******************************************************************************/
+static bool log_row_header(uint32_t row_addr, uint32_t *sequence)
+{
+    const uint32_t *header = (const uint32_t *) row_addr;
+
+    *sequence = header[LOG_HEADER_SEQUENCE];
+    return ((LOG_ROW_MAGIC == header[LOG_HEADER_MAGIC]) && (0u != *sequence) &&
+            (header[LOG_HEADER_SEQUENCE_INV] == ~(*sequence)));
+}
+
+
+/*******************************************************************************
+* Function Name: log_record_valid
+********************************************************************************
+*
+* Summary:
+* Checks the page number and CRC of a record.
+*
+*******************************************************************************/
+static bool log_record_valid(const eeprom_log_t *log, const log_record_t *record)
+{
+    return ((record->page < LOG_PAGES(log)) &&
+            (0xFFFFu == (uint32_t) (record->page ^ record->page_inv)) &&
+            (record->crc == eeprom_crc32_update(0u, &record->page,
+                                                EEPROM_LOG_RECORD_SIZE - sizeof(record->crc))));
+}
+
+
+/*******************************************************************************
+* Function Name: log_slot_is_erased
+********************************************************************************
+*
+* Summary:
+* Checks whether a slot was never programmed.
+*
+*******************************************************************************/
+static bool log_slot_is_erased(const log_record_t *record)
+{
+    const uint32_t *word = (const uint32_t *) record;
+
+    for(uint32_t i = 0u; i < (EEPROM_LOG_RECORD_SIZE / sizeof(uint32_t)); i++)
+    {
+        if(EEPROM_FLASH_ERASED_WORD != word[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: log_record
+********************************************************************************
+*
+* Summary:
+* Returns the record of a slot. Slots of the head row are taken from its RAM
+* image, which also holds the records not programmed yet.
+*
+*******************************************************************************/
+static const log_record_t *log_record(const eeprom_log_t *log, uint32_t slot_id)
+{
+    uint32_t row = slot_id / EEPROM_LOG_SLOTS_PER_ROW;
+    uint32_t offset = LOG_SLOT_OFFSET(slot_id % EEPROM_LOG_SLOTS_PER_ROW);
+
+    if(row == log->head)
+    {
+        return (const log_record_t *) &((const uint8_t *) log->row)[offset];
+    }
+    return (const log_record_t *) (LOG_ROW_ADDR(log, row) + offset);
+}
+
+
+/*******************************************************************************
+* Function Name: log_set_index
+********************************************************************************
+*
+* Summary:
+* Points a page to a new record and moves its live count along.
+*
+*******************************************************************************/
+static void log_set_index(eeprom_log_t *log, uint32_t page, uint32_t slot_id)
+{
+    if(LOG_NO_SLOT != log->index[page])
+    {
+        log->row_live[log->index[page] / EEPROM_LOG_SLOTS_PER_ROW]--;
+    }
+    log->index[page] = (uint16_t) slot_id;
+    log->row_live[slot_id / EEPROM_LOG_SLOTS_PER_ROW]++;
+}
+
+
+/*******************************************************************************
+* Function Name: log_append
+********************************************************************************
+*
+* Summary:
+* Adds a record to the RAM image of the head row. A full head row is
+* programmed and the next row opened first.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t log_append(eeprom_log_t *log, uint32_t page,
+                                           const uint8_t *data)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    log_record_t *record;
+
+    while((EEPROM_LOG_SLOTS_PER_ROW == log->head_used) && (CY_EM_EEPROM_SUCCESS == status))
+    {
+        if(log->dirty)
+        {
+            status = log_program_head(log);
+        }
+        if(CY_EM_EEPROM_SUCCESS == status)
+        {
+            status = log_open_row(log);
+        }
+    }
+
+    if(CY_EM_EEPROM_SUCCESS != status)
+    {
+        return status;
+    }
+
+    record = (log_record_t *) &((uint8_t *) log->row)[LOG_SLOT_OFFSET(log->head_used)];
+    record->page = (uint16_t) page;
+    record->page_inv = (uint16_t) ~page;
+    memcpy(record->data, data, EEPROM_LOG_PAGE_SIZE);
+    record->crc = eeprom_crc32_update(0u, &record->page,
+                                      EEPROM_LOG_RECORD_SIZE - sizeof(record->crc));
+
+    log_set_index(log, page, (log->head * EEPROM_LOG_SLOTS_PER_ROW) + log->head_used);
+    log->head_used++;
+    log->dirty = true;
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: log_program_head
+********************************************************************************
+*
+* Summary:
+* Programs the RAM image of the head row. The row was erased when it was
+* opened, and the records programmed before keep their bits.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t log_program_head(eeprom_log_t *log)
+{
+    if(CY_FLASH_DRV_SUCCESS != eeprom_flash_program_row(LOG_ROW_ADDR(log, log->head), log->row))
+    {
+        return CY_EM_EEPROM_WRITE_FAIL;
+    }
+    log->dirty = false;
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: log_open_row
+********************************************************************************
+*
+* Summary:
+* Makes the next free row the head row. If it is the last free row, the used
+* row with the fewest live records is compacted into it: its live records are
+* copied, the new head is programmed and only then is the old row erased, so
+* a reset in between leaves a dead row that eeprom_log_init() frees.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t log_open_row(eeprom_log_t *log)
+{
+    uint32_t victim = log->rows;
+    uint32_t row = log->rows;
+    uint32_t start = (log->head < log->rows) ? (log->head + 1u) : 0u;
+
+    /* Take the free rows in turn to spread the erases. */
+    for(uint32_t i = 0u; i < log->rows; i++)
+    {
+        uint32_t candidate = (start + i) % log->rows;
+
+        if(0u == log->row_sequence[candidate])
+        {
+            row = candidate;
+            break;
+        }
+    }
+    if(log->rows == row)
+    {
+        return CY_EM_EEPROM_WRITE_FAIL;
+    }
+
+    if(1u == log->free_rows)
+    {
+        for(uint32_t candidate = 0u; candidate < log->rows; candidate++)
+        {
+            if((0u != log->row_sequence[candidate]) &&
+               ((log->rows == victim) || (log->row_live[candidate] < log->row_live[victim])))
+            {
+                victim = candidate;
+            }
+        }
+    }
+
+    if(!eeprom_flash_row_is_erased(LOG_ROW_ADDR(log, row)) &&
+       (CY_FLASH_DRV_SUCCESS != eeprom_flash_erase_row(LOG_ROW_ADDR(log, row))))
+    {
+        return CY_EM_EEPROM_WRITE_FAIL;
+    }
+
+    log->sequence++;
+    memset(log->row, 0, sizeof(log->row));
+    log->row[LOG_HEADER_MAGIC] = LOG_ROW_MAGIC;
+    log->row[LOG_HEADER_SEQUENCE] = log->sequence;
+    log->row[LOG_HEADER_SEQUENCE_INV] = ~log->sequence;
+    log->row_sequence[row] = log->sequence;
+    log->free_rows--;
+    log->head = row;
+    log->head_used = 0u;
+    log->dirty = true;
+
+    if(log->rows == victim)
+    {
+        return CY_EM_EEPROM_SUCCESS;
+    }
+
+    for(uint32_t slot = 0u; slot < EEPROM_LOG_SLOTS_PER_ROW; slot++)
+    {
+        uint32_t slot_id = (victim * EEPROM_LOG_SLOTS_PER_ROW) + slot;
+        const log_record_t *record = log_record(log, slot_id);
+
+        if(log_record_valid(log, record) && (log->index[record->page] == slot_id))
+        {
+            (void) log_append(log, record->page, record->data);
+        }
+    }
+
+    if(CY_EM_EEPROM_SUCCESS != log_program_head(log))
+    {
+        return CY_EM_EEPROM_WRITE_FAIL;
+    }
+
+    if(CY_FLASH_DRV_SUCCESS != eeprom_flash_erase_row(LOG_ROW_ADDR(log, victim)))
+    {
+        return CY_EM_EEPROM_WRITE_FAIL;
+    }
+    log->row_sequence[victim] = 0u;
+    log->row_live[victim] = 0u;
+    log->free_rows++;
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: log_gc_next
+********************************************************************************
+*
+* Summary:
+* Picks the next piece of background work: erase a free row that is not
+* erased yet, replace a full head row, erase a used row without live records,
+* or move the live records of the used row with the fewest of them. Moving a
+* row that is full of live records would not free anything.
+*
+*******************************************************************************/
+static uint32_t log_gc_next(const eeprom_log_t *log, uint32_t *row)
+{
+    uint32_t victim = log->rows;
+
+    for(uint32_t candidate = 0u; candidate < log->rows; candidate++)
+    {
+        if((0u == log->row_sequence[candidate]) &&
+           !eeprom_flash_row_is_erased(LOG_ROW_ADDR(log, candidate)))
+        {
+            *row = candidate;
+            return LOG_GC_ERASE;
+        }
+    }
+
+    if((log->free_rows >= EEPROM_LOG_GC_FREE_ROWS) || (log->rows <= log->head))
+    {
+        return LOG_GC_NONE;
+    }
+
+    if(EEPROM_LOG_SLOTS_PER_ROW == log->head_used)
+    {
+        return LOG_GC_OPEN;
+    }
+
+    for(uint32_t candidate = 0u; candidate < log->rows; candidate++)
+    {
+        if((0u != log->row_sequence[candidate]) && (candidate != log->head) &&
+           ((log->rows == victim) || (log->row_live[candidate] < log->row_live[victim])))
+        {
+            victim = candidate;
+        }
+    }
+
+    if((log->rows == victim) || (log->row_live[victim] >= EEPROM_LOG_SLOTS_PER_ROW))
+    {
+        return LOG_GC_NONE;
+    }
+
+    *row = victim;
+    return (0u == log->row_live[victim]) ? LOG_GC_ERASE : LOG_GC_COPY;
+}
+
+
+/*******************************************************************************
+* Function Name: log_gc_copy
+********************************************************************************
+*
+* Summary:
+* Moves as many live records of a row as fit into the head row and programs
+* it. The emptied row is erased by a later step.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t log_gc_copy(eeprom_log_t *log, uint32_t victim)
+{
+    for(uint32_t slot = 0u; (slot < EEPROM_LOG_SLOTS_PER_ROW) &&
+        (log->head_used < EEPROM_LOG_SLOTS_PER_ROW); slot++)
+    {
+        uint32_t slot_id = (victim * EEPROM_LOG_SLOTS_PER_ROW) + slot;
+        const log_record_t *record = log_record(log, slot_id);
+
+        if(log_record_valid(log, record) && (log->index[record->page] == slot_id))
+        {
+            (void) log_append(log, record->page, record->data);
+        }
+    }
+
+    return log_program_head(log);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,159 @@
+/******************************************************************************
+* File Name: eeprom_log.h
+*
+* Description: This file contains the interface of the log-structured EEPROM.
+*              A write appends only the changed pages of the logical range to
+*              the newest flash row, and a RAM index maps each logical page to
+*              its newest record, so write cost scales with the change rather
+*              than with the logical size.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_LOG_H
+#define EEPROM_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "cy_em_eeprom.h"
+#include "eeprom_flash.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Logical bytes carried by one record. A write appends one record per page
+ * it changes.
+ */
+#ifndef EEPROM_LOG_PAGE_SIZE
+#define EEPROM_LOG_PAGE_SIZE            (32u)
+#endif
+
+/* Largest logical size and number of flash rows of one instance. They size
+ * the RAM index.
+ */
+#ifndef EEPROM_LOG_MAX_SIZE
+#define EEPROM_LOG_MAX_SIZE             (4096u)
+#endif
+#ifndef EEPROM_LOG_MAX_ROWS
+#define EEPROM_LOG_MAX_ROWS             (64u)
+#endif
+
+/* Row header: magic, sequence number and its complement, reserved word. */
+#define EEPROM_LOG_ROW_HEADER_SIZE      (16u)
+/* Record: CRC, page number and its complement, page data. */
+#define EEPROM_LOG_RECORD_HEADER_SIZE   (8u)
+#define EEPROM_LOG_RECORD_SIZE          (EEPROM_LOG_RECORD_HEADER_SIZE + EEPROM_LOG_PAGE_SIZE)
+#define EEPROM_LOG_SLOTS_PER_ROW        ((EEPROM_FLASH_ROW_SIZE - EEPROM_LOG_ROW_HEADER_SIZE) / \
+                                         EEPROM_LOG_RECORD_SIZE)
+
+#define EEPROM_LOG_MAX_PAGES            ((EEPROM_LOG_MAX_SIZE + EEPROM_LOG_PAGE_SIZE - 1u) / \
+                                         EEPROM_LOG_PAGE_SIZE)
+
+/* Fewest rows for a logical size: every page fits with two rows to spare,
+ * the head row and the row compaction copies into. More rows make the
+ * compaction cheaper and spread the wear. Place the area on a row boundary.
+ */
+#define EEPROM_LOG_MIN_ROWS(size)       (((((size) + EEPROM_LOG_PAGE_SIZE - 1u) / \
+                                           EEPROM_LOG_PAGE_SIZE) + \
+                                          EEPROM_LOG_SLOTS_PER_ROW - 1u) / \
+                                         EEPROM_LOG_SLOTS_PER_ROW + 2u)
+
+/* Free rows the background compaction keeps erased ahead of the writes. With
+ * at least two, a write only programs rows; with one, the write that fills
+ * the head row pays for a compaction.
+ */
+#ifndef EEPROM_LOG_GC_FREE_ROWS
+#define EEPROM_LOG_GC_FREE_ROWS         (2u)
+#endif
+
+/* Worst-case duration of a row erase and a row program, used to plan the
+ * work of eeprom_log_gc_step() within its budget.
+ */
+#ifndef EEPROM_LOG_GC_ERASE_US
+#define EEPROM_LOG_GC_ERASE_US          (12000u)
+#endif
+#ifndef EEPROM_LOG_GC_PROGRAM_US
+#define EEPROM_LOG_GC_PROGRAM_US        (6000u)
+#endif
+
+#if (EEPROM_LOG_RECORD_SIZE % 4u) != 0u
+#error "EEPROM_LOG_PAGE_SIZE must be a multiple of 4"
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t area;
+    uint32_t rows;
+    uint32_t size;
+    /* Row records are appended to and its used slots. */
+    uint32_t head;
+    uint32_t head_used;
+    uint32_t sequence;
+    uint32_t free_rows;
+    /* The head row holds records that are not programmed yet. */
+    bool dirty;
+    /* Sequence number of each row, 0 for a free row. */
+    uint32_t row_sequence[EEPROM_LOG_MAX_ROWS];
+    /* Records of each row that the index refers to. */
+    uint16_t row_live[EEPROM_LOG_MAX_ROWS];
+    /* Slot of the newest record of each page, 0xFFFF if none. */
+    uint16_t index[EEPROM_LOG_MAX_PAGES];
+    /* Content of the head row. */
+    uint32_t row[EEPROM_FLASH_ROW_WORDS];
+} eeprom_log_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_log_init(eeprom_log_t *log, uint32_t area, uint32_t rows,
+                                         uint32_t size);
+cy_en_em_eeprom_status_t eeprom_log_read(const eeprom_log_t *log, uint32_t addr,
+                                         void *data, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_log_write(eeprom_log_t *log, uint32_t addr,
+                                          const void *data, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_log_gc_step(eeprom_log_t *log, uint32_t budget_ms);
+bool eeprom_log_gc_pending(const eeprom_log_t *log);
+
+#endif /* EEPROM_LOG_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,192 @@
+/******************************************************************************
+* File Name: eeprom_partition.c
+*
+* Description: This file defines the flash areas, configurations and contexts
+*              of the Emulated EEPROM partitions listed in EEPROM_PARTITION_TABLE.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "eeprom_partition.h"
+#include "eeprom_status.h"
+
+/* Everything below, the flash areas in particular, is linked only if the
+ * application opts in with EEPROM_PARTITIONS, so that a build that does not
+ * use the partitions keeps the whole Em_EEPROM region.
+ */
+#if defined(EEPROM_PARTITIONS)
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#if (defined(CY_DEVICE_SECURE) && !CY_EM_EEPROM_SIZE)
+/* Secure targets sign the user flash image, so the partitions cannot be part
+ * of it. See "Placing the EEPROM array in user flash" in README.md.
+ */
+#error "Partitions need the emulated EEPROM flash region on secure targets"
+#endif
+
+#if CY_EM_EEPROM_SIZE
+#define PARTITION_SECTION       CY_SECTION(".cy_em_eeprom")
+#else
+#define PARTITION_SECTION
+#endif
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* The partitions alone must fit; main.c checks them together with the other
+ * arrays of the region.
+ */
+#if CY_EM_EEPROM_SIZE
+_Static_assert(EEPROM_PARTITION_TOTAL_SIZE <= CY_EM_EEPROM_SIZE,
+               "Em_EEPROM partitions exceed the emulated EEPROM flash region");
+#endif
+
+/* One row-aligned flash area per partition. */
+#define PARTITION_STORAGE(name, size, wear, redundant, simple, shadow) \
+    PARTITION_SECTION CY_ALIGN(CY_EM_EEPROM_FLASH_SIZEOF_ROW) \
+    static const uint8_t partition_storage_##name \
+        [EEPROM_PARTITION_PHYSICAL_SIZE(name, size, wear, redundant, simple, shadow)] = {0u};
+EEPROM_PARTITION_TABLE(PARTITION_STORAGE)
+#undef PARTITION_STORAGE
+
+/* RAM mirror per partition; a partition without a shadow keeps one byte. */
+#define PARTITION_SHADOW(name, size, wear, redundant, simple, shadow) \
+    static uint8_t partition_shadow_##name[((shadow) > 0u) ? (shadow) : 1u];
+EEPROM_PARTITION_TABLE(PARTITION_SHADOW)
+#undef PARTITION_SHADOW
+
+#define PARTITION_ENTRY(name, size, wear, redundant, simple, shadow) \
+    { \
+        .config = \
+        { \
+            .eepromSize = (size), \
+            .blockingWrite = EEPROM_PARTITION_BLOCKING_WRITE, \
+            .redundantCopy = (redundant), \
+            .wearLevelingFactor = (wear), \
+            .simpleMode = (simple), \
+        }, \
+        .shadow_image = partition_shadow_##name, \
+        .shadow_size = (shadow), \
+    },
+eeprom_partition_t eeprom_partitions[EEPROM_PARTITION_COUNT] =
+{
+    EEPROM_PARTITION_TABLE(PARTITION_ENTRY)
+};
+#undef PARTITION_ENTRY
+
+
+/*******************************************************************************
+* Function Name: eeprom_partition_init_all
+********************************************************************************
+*
+* Summary:
+* Initializes the Em_EEPROM context of every partition and fills the RAM
+* shadows.
+*
+* Return: cy_en_em_eeprom_status_t
+* First failing status. CY_EM_EEPROM_REDUNDANT_COPY_USED is reported if any
+* partition reported it and none failed.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_partition_init_all(void)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    cy_en_em_eeprom_status_t init_status;
+
+    /* Flash addresses are not constant expressions, so set them at run time. */
+#define PARTITION_ADDRESS(name, size, wear, redundant, simple, shadow) \
+    eeprom_partitions[EEPROM_PARTITION_##name].config.userFlashStartAddr = \
+        (uint32_t) partition_storage_##name;
+    EEPROM_PARTITION_TABLE(PARTITION_ADDRESS)
+#undef PARTITION_ADDRESS
+
+    for(uint32_t i = 0u; i < (uint32_t) EEPROM_PARTITION_COUNT; i++)
+    {
+        init_status = Cy_Em_EEPROM_Init(&eeprom_partitions[i].config,
+                                        &eeprom_partitions[i].context);
+
+        /* The data is valid if only the redundant copy was, so the shadow is
+         * filled in that case too.
+         */
+        if(!eeprom_status_failed(init_status) && (0u != eeprom_partitions[i].shadow_size))
+        {
+            init_status = eeprom_status_combine(init_status,
+                                                eeprom_shadow_init(&eeprom_partitions[i].shadow,
+                                                                   &eeprom_partitions[i].context,
+                                                                   eeprom_partitions[i].shadow_image,
+                                                                   eeprom_partitions[i].shadow_size));
+        }
+
+        if(eeprom_status_failed(init_status))
+        {
+            return init_status;
+        }
+        status = eeprom_status_combine(status, init_status);
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_partition_context
+********************************************************************************
+*
+* Summary:
+* Returns the Em_EEPROM context of a partition, to be passed to
+* eeprom_io_read() and eeprom_io_write(), which serve reads of a partition
+* with a shadow from RAM.
+*
+* Parameters:
+* eeprom_partition_id_t id: partition identifier.
+*
+* Return: cy_stc_eeprom_context_t *
+*
+*******************************************************************************/
+cy_stc_eeprom_context_t *eeprom_partition_context(eeprom_partition_id_t id)
+{
+    return &eeprom_partitions[id].context;
+}
+
+#endif /* EEPROM_PARTITIONS */
+
+/* [] END OF FILE */
@@ -0,0 +1,131 @@
+/******************************************************************************
+* File Name: eeprom_partition.h
+*
+* Description: This file contains the partition table of the Emulated EEPROM
+*              and the interface to the partitions. Every partition is an
+*              independent Em_EEPROM instance with its own flash area, configuration
+*              and context.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_PARTITION_H
+#define EEPROM_PARTITION_H
+
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+#include "eeprom_shadow.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Partition table. Each entry is
+ *
+ *     X(name, size, wear_levelling_factor, redundant_copy, simple_mode, shadow)
+ *
+ * where size is the logical size in bytes and shadow the number of bytes,
+ * from address 0, mirrored in RAM by eeprom_shadow.c; 0 for none. The flash area of each partition is
+ * sized with CY_EM_EEPROM_GET_PHYSICAL_SIZE at compile time, so data that is
+ * written often can use a high wear leveling factor without a redundant copy
+ * while data that rarely changes keeps the redundant copy without paying for
+ * the full wear leveling. COLD still uses a factor of 2: with 1, a write
+ * rewrites the only row in place, and a power loss during the redundant copy
+ * followed by one during the next main write leaves no valid copy. JOURNAL
+ * holds the journal record of eeprom_txn.c, which is written twice by every
+ * transaction that spans rows.
+ */
+#ifndef EEPROM_PARTITION_TABLE
+#define EEPROM_PARTITION_TABLE(X) \
+    X(HOT,      64u, 8u, 0u, 0u,  64u) \
+    X(COLD,    256u, 2u, 1u, 0u, 256u) \
+    X(JOURNAL, 256u, 4u, 0u, 0u,   0u)
+#endif
+
+/* Write mode of all partitions. Non-blocking writes are only allowed in the
+ * emulated EEPROM flash region.
+ */
+#ifndef EEPROM_PARTITION_BLOCKING_WRITE
+#define EEPROM_PARTITION_BLOCKING_WRITE (1u)
+#endif
+
+/* Flash area of one partition table entry. */
+#define EEPROM_PARTITION_PHYSICAL_SIZE(name, size, wear, redundant, simple, shadow) \
+    CY_EM_EEPROM_GET_PHYSICAL_SIZE((size), (simple), (wear), (redundant))
+
+/* Flash used by all partitions together. */
+#define EEPROM_PARTITION_SIZE_TERM(name, size, wear, redundant, simple, shadow) \
+    + EEPROM_PARTITION_PHYSICAL_SIZE(name, size, wear, redundant, simple, shadow)
+#define EEPROM_PARTITION_TOTAL_SIZE     (0u EEPROM_PARTITION_TABLE(EEPROM_PARTITION_SIZE_TERM))
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Partition identifiers, EEPROM_PARTITION_<name>. */
+#define EEPROM_PARTITION_ENUM_ENTRY(name, size, wear, redundant, simple, shadow) EEPROM_PARTITION_##name,
+typedef enum
+{
+    EEPROM_PARTITION_TABLE(EEPROM_PARTITION_ENUM_ENTRY)
+    EEPROM_PARTITION_COUNT
+} eeprom_partition_id_t;
+#undef EEPROM_PARTITION_ENUM_ENTRY
+
+typedef struct
+{
+    cy_stc_eeprom_config_t config;
+    cy_stc_eeprom_context_t context;
+    eeprom_shadow_t shadow;
+    uint8_t *shadow_image;
+    uint32_t shadow_size;
+} eeprom_partition_t;
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+extern eeprom_partition_t eeprom_partitions[EEPROM_PARTITION_COUNT];
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_partition_init_all(void);
+cy_stc_eeprom_context_t *eeprom_partition_context(eeprom_partition_id_t id);
+
+#endif /* EEPROM_PARTITION_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,168 @@
+/******************************************************************************
+* File Name: eeprom_registry.h
+*
+* Description: This file contains the table that the optional modules use to
+*              attach an object, such as a shadow or a journal, to an Em_EEPROM
+*              instance, and to look it up on every access.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_REGISTRY_H
+#define EEPROM_REGISTRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Defines a registry with room for capacity objects. */
+#define EEPROM_REGISTRY_DEFINE(name, capacity) \
+    static eeprom_registry_entry_t name##_entries[(capacity)]; \
+    static eeprom_registry_t name = { name##_entries, (capacity), 0u }
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    const cy_stc_eeprom_context_t *context;
+    void *object;
+} eeprom_registry_entry_t;
+
+typedef struct
+{
+    eeprom_registry_entry_t *entries;
+    uint32_t capacity;
+    /* Objects registered, so that a lookup in an empty registry, the usual
+     * case on every access, returns at once.
+     */
+    uint32_t count;
+} eeprom_registry_t;
+
+
+/*******************************************************************************
+* Function Name: eeprom_registry_slot
+********************************************************************************
+*
+* Summary:
+* Returns the slot an object is registered in, the slot of the object already
+* attached to the same instance, or the first free slot. The slot is taken by
+* eeprom_registry_set(), so that a failed initialization leaves the registry
+* unchanged.
+*
+* Return:
+* The slot, or the capacity of the registry if it is full.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t eeprom_registry_slot(const eeprom_registry_t *registry,
+                                              const void *object,
+                                              const cy_stc_eeprom_context_t *context)
+{
+    uint32_t free_slot = registry->capacity;
+
+    for(uint32_t i = 0u; i < registry->capacity; i++)
+    {
+        const eeprom_registry_entry_t *entry = &registry->entries[i];
+
+        if((entry->object == object) || ((NULL != entry->object) && (entry->context == context)))
+        {
+            return i;
+        }
+        if((NULL == entry->object) && (registry->capacity == free_slot))
+        {
+            free_slot = i;
+        }
+    }
+    return free_slot;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_registry_set
+********************************************************************************
+*
+* Summary:
+* Attaches an object to an instance in a slot returned by
+* eeprom_registry_slot(), replacing the object that was there.
+*
+*******************************************************************************/
+__STATIC_INLINE void eeprom_registry_set(eeprom_registry_t *registry, uint32_t slot,
+                                         void *object, const cy_stc_eeprom_context_t *context)
+{
+    eeprom_registry_entry_t *entry = &registry->entries[slot];
+
+    if(NULL == entry->object)
+    {
+        registry->count++;
+    }
+    entry->context = context;
+    entry->object = object;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_registry_find
+********************************************************************************
+*
+* Summary:
+* Returns the object attached to an instance, or NULL.
+*
+*******************************************************************************/
+__STATIC_INLINE void *eeprom_registry_find(const eeprom_registry_t *registry,
+                                           const cy_stc_eeprom_context_t *context)
+{
+    if(0u != registry->count)
+    {
+        for(uint32_t i = 0u; i < registry->capacity; i++)
+        {
+            if((NULL != registry->entries[i].object) && (registry->entries[i].context == context))
+            {
+                return registry->entries[i].object;
+            }
+        }
+    }
+    return NULL;
+}
+
+#endif /* EEPROM_REGISTRY_H */
+
+/* [] END OF FILE */
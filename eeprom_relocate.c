@@ -0,0 +1,415 @@
+/******************************************************************************
+* File Name: eeprom_relocate.c
+*
+* Description: This file implements the hot block relocation. The access
+*              layer counts the writes of each block of a source instance;
+*              a block written often enough is copied to a slot of the hot
+*              instance, and a slot map stored in the hot instance makes the
+*              access layer serve the block from there. Cold blocks stay in
+*              place.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "eeprom_crc.h"
+#include "eeprom_io.h"
+#include "eeprom_registry.h"
+#include "eeprom_relocate.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* "HOTB" */
+#define RELOCATE_MAGIC          (0x42544F48uL)
+
+#define RELOCATE_WORD_MAGIC     (0u)
+#define RELOCATE_WORD_CRC       (1u)
+#define RELOCATE_MAP_WORDS      (EEPROM_RELOCATE_MAP_SIZE / sizeof(uint32_t))
+#define RELOCATE_MAP_SLOTS(map) ((uint8_t *) &(map)[2u])
+
+#define RELOCATE_SLOT_ADDR(slot) (EEPROM_RELOCATE_MAP_SIZE + ((slot) * EEPROM_RELOCATE_BLOCK_SIZE))
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t relocate_map_crc(const uint32_t *map);
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Relocations by source instance. Every access of the access layer looks its
+ * instance up here.
+ */
+EEPROM_REGISTRY_DEFINE(relocate_registry, EEPROM_RELOCATE_MAX_INSTANCES);
+
+
+/*******************************************************************************
+* Function Name: eeprom_relocate_init
+********************************************************************************
+*
+* Summary:
+* Loads the slot map from the hot instance and attaches the relocation to the
+* access layer of the source instance. Blocks moved in an earlier run are
+* served from the hot instance again. Lazily initialized instances are
+* initialized first.
+*
+* Parameters:
+* eeprom_relocate_t *relocate: relocation instance.
+* cy_stc_eeprom_context_t *context: source Em_EEPROM instance.
+* cy_stc_eeprom_context_t *hot: Em_EEPROM instance the blocks are moved to,
+*  at least EEPROM_RELOCATE_HOT_SIZE(1) bytes, used for nothing else.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_relocate_init(eeprom_relocate_t *relocate,
+                                              cy_stc_eeprom_context_t *context,
+                                              cy_stc_eeprom_context_t *hot)
+{
+    uint32_t map[RELOCATE_MAP_WORDS];
+    uint32_t free_slot;
+    cy_en_em_eeprom_status_t status;
+
+    if((NULL == relocate) || (NULL == context) || (NULL == hot) || (context == hot))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    free_slot = eeprom_registry_slot(&relocate_registry, relocate, context);
+    if(EEPROM_RELOCATE_MAX_INSTANCES == free_slot)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    status = eeprom_io_ready(context);
+    if((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status))
+    {
+        status = eeprom_io_ready(hot);
+    }
+    if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+    {
+        return status;
+    }
+    if(hot->eepromSize < EEPROM_RELOCATE_HOT_SIZE(1u))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    status = eeprom_io_read(0u, map, sizeof(map), hot);
+    if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+    {
+        return status;
+    }
+
+    relocate->context = context;
+    relocate->hot = hot;
+    relocate->slots = (hot->eepromSize - EEPROM_RELOCATE_MAP_SIZE) / EEPROM_RELOCATE_BLOCK_SIZE;
+    if(relocate->slots > EEPROM_RELOCATE_MAX_SLOTS)
+    {
+        relocate->slots = EEPROM_RELOCATE_MAX_SLOTS;
+    }
+    relocate->writes = 0u;
+    (void) memset(relocate->slot_block, 0, sizeof(relocate->slot_block));
+    (void) memset(relocate->block_slot, 0, sizeof(relocate->block_slot));
+    (void) memset(relocate->heat, 0, sizeof(relocate->heat));
+
+    /* A hot instance without a valid map has no block moved yet. */
+    if((RELOCATE_MAGIC == map[RELOCATE_WORD_MAGIC]) &&
+       (relocate_map_crc(map) == map[RELOCATE_WORD_CRC]))
+    {
+        for(uint32_t slot = 0u; slot < relocate->slots; slot++)
+        {
+            uint32_t block = RELOCATE_MAP_SLOTS(map)[slot];
+
+            if((0u != block) && (block <= EEPROM_RELOCATE_MAX_BLOCKS) &&
+               (0u == relocate->block_slot[block - 1u]))
+            {
+                relocate->slot_block[slot] = (uint8_t) block;
+                relocate->block_slot[block - 1u] = (uint8_t) (slot + 1u);
+            }
+        }
+    }
+
+    eeprom_registry_set(&relocate_registry, free_slot, relocate, context);
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_relocate_find
+********************************************************************************
+*
+* Summary:
+* Returns the relocation attached to a source instance, or NULL.
+*
+* Parameters:
+* const cy_stc_eeprom_context_t *context: Em_EEPROM instance.
+*
+* Return: eeprom_relocate_t *
+*
+*******************************************************************************/
+eeprom_relocate_t *eeprom_relocate_find(const cy_stc_eeprom_context_t *context)
+{
+    return (eeprom_relocate_t *) eeprom_registry_find(&relocate_registry, context);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_relocate_run
+********************************************************************************
+*
+* Summary:
+* Returns the length of the leading part of a range that is stored in one
+* place: either a run of blocks in place in the source instance, or a part
+* of one moved block.
+*
+* Parameters:
+* const eeprom_relocate_t *relocate: relocation instance.
+* uint32_t addr: logical address in the source instance.
+* uint32_t size: number of bytes, not 0.
+* uint32_t *hot_addr: returned logical address of the part in the hot
+*  instance, or EEPROM_RELOCATE_IN_PLACE.
+*
+* Return: uint32_t
+* Bytes of the part, at most size.
+*
+*******************************************************************************/
+uint32_t eeprom_relocate_run(const eeprom_relocate_t *relocate, uint32_t addr, uint32_t size,
+                             uint32_t *hot_addr)
+{
+    uint32_t block = addr / EEPROM_RELOCATE_BLOCK_SIZE;
+    uint32_t run = EEPROM_RELOCATE_BLOCK_SIZE - (addr % EEPROM_RELOCATE_BLOCK_SIZE);
+
+    if((block < EEPROM_RELOCATE_MAX_BLOCKS) && (0u != relocate->block_slot[block]))
+    {
+        *hot_addr = RELOCATE_SLOT_ADDR(relocate->block_slot[block] - 1u) +
+                    (addr % EEPROM_RELOCATE_BLOCK_SIZE);
+        return (run < size) ? run : size;
+    }
+
+    *hot_addr = EEPROM_RELOCATE_IN_PLACE;
+    for(block++; (run < size) && (block < EEPROM_RELOCATE_MAX_BLOCKS) &&
+                 (0u == relocate->block_slot[block]); block++)
+    {
+        run += EEPROM_RELOCATE_BLOCK_SIZE;
+    }
+
+    /* Nothing is moved beyond the counted blocks. */
+    return ((run < size) && (block < EEPROM_RELOCATE_MAX_BLOCKS)) ? run : size;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_relocate_record
+********************************************************************************
+*
+* Summary:
+* Counts a successful write to the source instance and moves the blocks that
+* reached EEPROM_RELOCATE_THRESHOLD while slots are free.
+*
+* Parameters:
+* eeprom_relocate_t *relocate: relocation instance.
+* uint32_t addr: logical address of the write.
+* uint32_t size: number of bytes written.
+*
+*******************************************************************************/
+void eeprom_relocate_record(eeprom_relocate_t *relocate, uint32_t addr, uint32_t size)
+{
+    uint32_t last;
+
+    if((NULL == relocate) || (0u == size))
+    {
+        return;
+    }
+
+    last = (addr + size - 1u) / EEPROM_RELOCATE_BLOCK_SIZE;
+    for(uint32_t block = addr / EEPROM_RELOCATE_BLOCK_SIZE;
+        (block <= last) && (block < EEPROM_RELOCATE_MAX_BLOCKS); block++)
+    {
+        if((0u == relocate->block_slot[block]) && (UINT16_MAX != relocate->heat[block]))
+        {
+            relocate->heat[block]++;
+            if((relocate->heat[block] >= EEPROM_RELOCATE_THRESHOLD) &&
+               (CY_EM_EEPROM_SUCCESS == eeprom_relocate_promote(relocate,
+                                                                block * EEPROM_RELOCATE_BLOCK_SIZE)))
+            {
+                relocate->heat[block] = 0u;
+            }
+        }
+    }
+
+    relocate->writes++;
+    if(relocate->writes >= EEPROM_RELOCATE_WINDOW)
+    {
+        relocate->writes = 0u;
+        for(uint32_t block = 0u; block < EEPROM_RELOCATE_MAX_BLOCKS; block++)
+        {
+            relocate->heat[block] /= 2u;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_relocate_promote
+********************************************************************************
+*
+* Summary:
+* Moves the block holding a logical address to a free slot of the hot
+* instance: the block is copied first, then the slot map is written with one
+* write, so a power loss in between leaves the block in place. Call it
+* directly for data known to be hot, such as a counter.
+*
+* Parameters:
+* eeprom_relocate_t *relocate: relocation instance.
+* uint32_t addr: logical address in the block to move.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_WRITE_FAIL if no slot is free.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_relocate_promote(eeprom_relocate_t *relocate, uint32_t addr)
+{
+    uint32_t map[RELOCATE_MAP_WORDS] = {0u};
+    uint8_t data[EEPROM_RELOCATE_BLOCK_SIZE];
+    cy_en_em_eeprom_status_t status;
+    uint32_t block;
+    uint32_t slot;
+
+    if(NULL == relocate)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    block = addr / EEPROM_RELOCATE_BLOCK_SIZE;
+    if((block >= EEPROM_RELOCATE_MAX_BLOCKS) ||
+       (((block + 1u) * EEPROM_RELOCATE_BLOCK_SIZE) > relocate->context->eepromSize))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+    if(0u != relocate->block_slot[block])
+    {
+        return CY_EM_EEPROM_SUCCESS;
+    }
+
+    slot = 0u;
+    while((slot < relocate->slots) && (0u != relocate->slot_block[slot]))
+    {
+        slot++;
+    }
+    if(slot == relocate->slots)
+    {
+        return CY_EM_EEPROM_WRITE_FAIL;
+    }
+
+    status = eeprom_io_read(block * EEPROM_RELOCATE_BLOCK_SIZE, data, sizeof(data),
+                            relocate->context);
+    if((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status))
+    {
+        status = eeprom_io_write(RELOCATE_SLOT_ADDR(slot), data, sizeof(data), relocate->hot);
+    }
+    if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+    {
+        return status;
+    }
+
+    map[RELOCATE_WORD_MAGIC] = RELOCATE_MAGIC;
+    (void) memcpy(RELOCATE_MAP_SLOTS(map), relocate->slot_block, relocate->slots);
+    RELOCATE_MAP_SLOTS(map)[slot] = (uint8_t) (block + 1u);
+    map[RELOCATE_WORD_CRC] = relocate_map_crc(map);
+
+    status = eeprom_io_write(0u, map, sizeof(map), relocate->hot);
+    if((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status))
+    {
+        relocate->slot_block[slot] = (uint8_t) (block + 1u);
+        relocate->block_slot[block] = (uint8_t) (slot + 1u);
+        status = CY_EM_EEPROM_SUCCESS;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_relocate_count
+********************************************************************************
+*
+* Summary:
+* Returns the number of blocks moved to the hot instance.
+*
+* Parameters:
+* const eeprom_relocate_t *relocate: relocation instance.
+*
+* Return: uint32_t
+*
+*******************************************************************************/
+uint32_t eeprom_relocate_count(const eeprom_relocate_t *relocate)
+{
+    uint32_t count = 0u;
+
+    if(NULL != relocate)
+    {
+        for(uint32_t slot = 0u; slot < relocate->slots; slot++)
+        {
+            count += (0u != relocate->slot_block[slot]) ? 1u : 0u;
+        }
+    }
+
+    return count;
+}
+
+
+/*******************************************************************************
+* Function Name: relocate_map_crc
+********************************************************************************
+*
+* Summary:
+* Returns the CRC of the slot entries of a map.
+*
+*******************************************************************************/
+static uint32_t relocate_map_crc(const uint32_t *map)
+{
+    return eeprom_crc32_update(0u, &map[2u], EEPROM_RELOCATE_MAP_SIZE - 8u);
+}
+
+
+/* [] END OF FILE */
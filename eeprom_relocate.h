@@ -0,0 +1,137 @@
+/******************************************************************************
+* File Name: eeprom_relocate.h
+*
+* Description: This file contains the structure and function prototypes of
+*              the hot block relocation, which moves frequently written
+*              blocks of an Em_EEPROM instance to an instance with a high
+*              wear leveling factor.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_RELOCATE_H
+#define EEPROM_RELOCATE_H
+
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Logical bytes moved as one block. */
+#ifndef EEPROM_RELOCATE_BLOCK_SIZE
+#define EEPROM_RELOCATE_BLOCK_SIZE      (8u)
+#endif
+
+/* Blocks of the source instance whose writes are counted, from address 0.
+ * Blocks beyond stay in place.
+ */
+#ifndef EEPROM_RELOCATE_MAX_BLOCKS
+#define EEPROM_RELOCATE_MAX_BLOCKS      (64u)
+#endif
+
+/* Largest number of blocks moved to the hot instance. Moves are permanent. */
+#ifndef EEPROM_RELOCATE_MAX_SLOTS
+#define EEPROM_RELOCATE_MAX_SLOTS       (8u)
+#endif
+
+/* A block is moved once it was written EEPROM_RELOCATE_THRESHOLD times. The
+ * counts of all blocks are halved every EEPROM_RELOCATE_WINDOW writes to the
+ * instance, so a block has to stay busy relative to the others.
+ */
+#ifndef EEPROM_RELOCATE_THRESHOLD
+#define EEPROM_RELOCATE_THRESHOLD       (16u)
+#endif
+#ifndef EEPROM_RELOCATE_WINDOW
+#define EEPROM_RELOCATE_WINDOW          (256u)
+#endif
+
+/* Instances that can have hot blocks moved at the same time. */
+#ifndef EEPROM_RELOCATE_MAX_INSTANCES
+#define EEPROM_RELOCATE_MAX_INSTANCES   (2u)
+#endif
+
+/* Slot map at address 0 of the hot instance: magic, CRC, source block of
+ * each slot. The slots follow it.
+ */
+#define EEPROM_RELOCATE_MAP_SIZE        (8u + ((EEPROM_RELOCATE_MAX_SLOTS + 3u) & ~3u))
+
+/* Smallest hot instance for a number of slots. */
+#define EEPROM_RELOCATE_HOT_SIZE(slots) (EEPROM_RELOCATE_MAP_SIZE + \
+                                         ((slots) * EEPROM_RELOCATE_BLOCK_SIZE))
+
+/* Returned by eeprom_relocate_run() for a range that is stored in place. */
+#define EEPROM_RELOCATE_IN_PLACE        (0xFFFFFFFFuL)
+
+#if (EEPROM_RELOCATE_MAX_BLOCKS > 255u) || (EEPROM_RELOCATE_MAX_SLOTS > 255u)
+#error "EEPROM_RELOCATE_MAX_BLOCKS and EEPROM_RELOCATE_MAX_SLOTS must be below 256"
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    cy_stc_eeprom_context_t *context;
+    cy_stc_eeprom_context_t *hot;
+    uint32_t slots;
+    uint32_t writes;
+    /* Source block + 1 of each slot, 0 for a free slot. */
+    uint8_t slot_block[EEPROM_RELOCATE_MAX_SLOTS];
+    /* Slot + 1 of each block, 0 for a block in place. */
+    uint8_t block_slot[EEPROM_RELOCATE_MAX_BLOCKS];
+    uint16_t heat[EEPROM_RELOCATE_MAX_BLOCKS];
+} eeprom_relocate_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_relocate_init(eeprom_relocate_t *relocate,
+                                              cy_stc_eeprom_context_t *context,
+                                              cy_stc_eeprom_context_t *hot);
+eeprom_relocate_t *eeprom_relocate_find(const cy_stc_eeprom_context_t *context);
+uint32_t eeprom_relocate_run(const eeprom_relocate_t *relocate, uint32_t addr, uint32_t size,
+                             uint32_t *hot_addr);
+void eeprom_relocate_record(eeprom_relocate_t *relocate, uint32_t addr, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_relocate_promote(eeprom_relocate_t *relocate, uint32_t addr);
+uint32_t eeprom_relocate_count(const eeprom_relocate_t *relocate);
+
+#endif /* EEPROM_RELOCATE_H */
+
+/* [] END OF FILE */
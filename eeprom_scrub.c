@@ -0,0 +1,229 @@
+/******************************************************************************
+* File Name: eeprom_scrub.c
+*
+* Description: This file implements the background scrub of an Em_EEPROM
+*              instance. Each step reads one chunk through the row checksums,
+*              corrects the RAM shadow from a verified read, and writes the
+*              chunk again when only the redundant copy or only the shadow
+*              still holds it.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "eeprom_fastinit.h"
+#include "eeprom_flash.h"
+#include "eeprom_io.h"
+#include "eeprom_relocate.h"
+#include "eeprom_scrub.h"
+#include "eeprom_shadow.h"
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static cy_en_em_eeprom_status_t scrub_repair(eeprom_scrub_t *scrub, uint32_t addr,
+                                             const uint8_t *data, uint32_t size);
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Chunk read by the running step. */
+static uint8_t scrub_buffer[EEPROM_SCRUB_CHUNK];
+
+
+/*******************************************************************************
+* Function Name: eeprom_scrub_init
+********************************************************************************
+*
+* Summary:
+* Prepares the scrub of an Em_EEPROM instance, starting at address 0. A RAM
+* shadow attached to the instance is checked too and serves as the last
+* resort when both copies of a row are corrupted.
+*
+* Parameters:
+* eeprom_scrub_t *scrub: scrub instance.
+* const cy_stc_eeprom_config_t *config: configuration of the instance.
+* cy_stc_eeprom_context_t *context: Em_EEPROM instance.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_BAD_PARAM for an instance with hot block relocation, whose
+* moved blocks are not in its flash.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_scrub_init(eeprom_scrub_t *scrub,
+                                           const cy_stc_eeprom_config_t *config,
+                                           cy_stc_eeprom_context_t *context)
+{
+    if((NULL == scrub) || (NULL == config) || (NULL == context) ||
+       (NULL != eeprom_relocate_find(context)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    (void) memset(scrub, 0, sizeof(*scrub));
+    scrub->config = config;
+    scrub->context = context;
+
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_scrub_step
+********************************************************************************
+*
+* Summary:
+* Checks the next EEPROM_SCRUB_CHUNK logical bytes and wraps around at the
+* end of the instance. Call it from the idle loop or a low-priority task; it
+* is not reentrant, and it must not preempt a write to the instance.
+*
+* A read that passes the checksums is the reference: a differing mirror is
+* corrected from it, and a read served from the redundant copy is written
+* back so that both copies are good again. If neither copy passes, the chunk
+* is restored from the mirror when the mirror covers it.
+*
+* Parameters:
+* eeprom_scrub_t *scrub: scrub instance.
+*
+* Return: cy_en_em_eeprom_status_t
+* The status of the read, or of the repair if one was needed.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_scrub_step(eeprom_scrub_t *scrub)
+{
+    eeprom_shadow_t *shadow;
+    cy_en_em_eeprom_status_t status;
+    uint32_t mirrored = 0u;
+    uint32_t addr;
+    uint32_t size;
+
+    if((NULL == scrub) || (NULL == scrub->context))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    status = eeprom_io_ready(scrub->context);
+    if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+    {
+        return status;
+    }
+
+    addr = scrub->cursor;
+    size = scrub->context->eepromSize - addr;
+    if(size > EEPROM_SCRUB_CHUNK)
+    {
+        size = EEPROM_SCRUB_CHUNK;
+    }
+
+    shadow = eeprom_shadow_find(scrub->context);
+    if((NULL != shadow) && shadow->valid && (addr < shadow->size))
+    {
+        mirrored = shadow->size - addr;
+        mirrored = (mirrored < size) ? mirrored : size;
+    }
+
+    eeprom_flash_enter();
+    status = Cy_Em_EEPROM_Read(addr, scrub_buffer, size, scrub->context);
+    eeprom_flash_exit();
+    if((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status))
+    {
+        if((0u != mirrored) && (0 != memcmp(&shadow->image[addr], scrub_buffer, mirrored)))
+        {
+            eeprom_shadow_update(shadow, addr, scrub_buffer, mirrored, CY_EM_EEPROM_SUCCESS);
+            scrub->shadow_repairs++;
+        }
+        if(CY_EM_EEPROM_REDUNDANT_COPY_USED == status)
+        {
+            status = scrub_repair(scrub, addr, scrub_buffer, size);
+        }
+    }
+    else if(mirrored == size)
+    {
+        status = scrub_repair(scrub, addr, &shadow->image[addr], size);
+    }
+    else
+    {
+        scrub->failures++;
+    }
+
+    scrub->cursor = addr + size;
+    if(scrub->cursor >= scrub->context->eepromSize)
+    {
+        scrub->cursor = 0u;
+        scrub->passes++;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: scrub_repair
+********************************************************************************
+*
+* Summary:
+* Writes a chunk with its known good content. The fast initialization hint
+* is dropped for the write and taken again afterwards.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t scrub_repair(eeprom_scrub_t *scrub, uint32_t addr,
+                                             const uint8_t *data, uint32_t size)
+{
+    cy_en_em_eeprom_status_t status;
+
+    eeprom_fastinit_invalidate();
+    eeprom_flash_enter();
+    status = Cy_Em_EEPROM_Write(addr, data, size, scrub->context);
+    eeprom_flash_exit();
+    eeprom_fastinit_update(scrub->config, scrub->context);
+
+    if((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status))
+    {
+        scrub->flash_repairs++;
+    }
+    else
+    {
+        scrub->failures++;
+    }
+
+    return status;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name: eeprom_scrub.h
+*
+* Description: This file contains the structure and function prototypes of
+*              the background scrub, which checks an Em_EEPROM instance and
+*              its RAM shadow against each other a chunk at a time.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_SCRUB_H
+#define EEPROM_SCRUB_H
+
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Logical bytes checked per eeprom_scrub_step(), one row of data by default. */
+#ifndef EEPROM_SCRUB_CHUNK
+#define EEPROM_SCRUB_CHUNK              CY_EM_EEPROM_EEPROM_DATA_LEN(0u)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    const cy_stc_eeprom_config_t *config;
+    cy_stc_eeprom_context_t *context;
+    /* Logical address checked next. */
+    uint32_t cursor;
+    /* Complete passes over the instance. */
+    uint32_t passes;
+    /* Chunks whose mirror was corrected from the flash. */
+    uint32_t shadow_repairs;
+    /* Chunks written again from the redundant copy or the mirror. */
+    uint32_t flash_repairs;
+    /* Chunks that could not be read and had no mirror to restore them from,
+     * or whose repair failed.
+     */
+    uint32_t failures;
+} eeprom_scrub_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_scrub_init(eeprom_scrub_t *scrub,
+                                           const cy_stc_eeprom_config_t *config,
+                                           cy_stc_eeprom_context_t *context);
+cy_en_em_eeprom_status_t eeprom_scrub_step(eeprom_scrub_t *scrub);
+
+#endif /* EEPROM_SCRUB_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,258 @@
+/******************************************************************************
+* File Name: eeprom_shadow.c
+*
+* Description: This file implements the RAM shadow of an Em_EEPROM instance. The
+*              mirror is filled once from the flash; afterwards only successful
+*              writes change it, so a read of the shadowed range neither walks
+*              the Em_EEPROM rows nor checks any checksum.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_flash.h"
+#include "eeprom_io.h"
+#include "eeprom_registry.h"
+#include "eeprom_shadow.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define SHADOW_COVERS(shadow, addr, size) \
+    ((shadow)->valid && ((addr) <= (shadow)->size) && ((size) <= ((shadow)->size - (addr))))
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Shadows by instance. Reads and writes look them up, and the compare before
+ * a write uses the mirror instead of the flash.
+ */
+EEPROM_REGISTRY_DEFINE(shadow_registry, EEPROM_SHADOW_MAX_INSTANCES);
+
+
+/*******************************************************************************
+* Function Name: eeprom_shadow_init
+********************************************************************************
+*
+* Summary:
+* Fills the mirror of an Em_EEPROM instance from the flash and registers it
+* with the access layer. A lazily initialized instance is initialized first.
+* The mirror can cover less than the whole instance to save RAM; reads
+* beyond it go to the flash.
+*
+* Parameters:
+* eeprom_shadow_t *shadow: shadow instance.
+* cy_stc_eeprom_context_t *context: Em_EEPROM instance.
+* uint8_t *image: RAM mirror of size bytes.
+* uint32_t size: number of logical bytes mirrored from address 0, at most
+*  eepromSize.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_shadow_init(eeprom_shadow_t *shadow,
+                                            cy_stc_eeprom_context_t *context,
+                                            uint8_t *image, uint32_t size)
+{
+    uint32_t free_slot;
+    cy_en_em_eeprom_status_t status;
+
+    if((NULL == shadow) || (NULL == context) || (NULL == image) || (0u == size))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    free_slot = eeprom_registry_slot(&shadow_registry, shadow, context);
+    if(EEPROM_SHADOW_MAX_INSTANCES == free_slot)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    status = eeprom_io_ready(context);
+    if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+    {
+        return status;
+    }
+    if(size > context->eepromSize)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    eeprom_flash_enter();
+    status = Cy_Em_EEPROM_Read(0u, image, size, context);
+    eeprom_flash_exit();
+    if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+    {
+        return status;
+    }
+
+    shadow->context = context;
+    shadow->image = image;
+    shadow->size = size;
+    shadow->valid = true;
+    eeprom_registry_set(&shadow_registry, free_slot, shadow, context);
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_shadow_find
+********************************************************************************
+*
+* Summary:
+* Returns the shadow of an Em_EEPROM instance, or NULL.
+*
+*******************************************************************************/
+eeprom_shadow_t *eeprom_shadow_find(const cy_stc_eeprom_context_t *context)
+{
+    return (eeprom_shadow_t *) eeprom_registry_find(&shadow_registry, context);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_shadow_read
+********************************************************************************
+*
+* Summary:
+* Copies data out of the mirror.
+*
+* Parameters:
+* const eeprom_shadow_t *shadow: shadow instance.
+* uint32_t addr: logical address.
+* void *data: destination buffer.
+* uint32_t size: size in bytes.
+*
+* Return: bool
+* false if the range is not mirrored; nothing is copied then.
+*
+*******************************************************************************/
+bool eeprom_shadow_read(const eeprom_shadow_t *shadow, uint32_t addr, void *data, uint32_t size)
+{
+    if(!SHADOW_COVERS(shadow, addr, size))
+    {
+        return false;
+    }
+
+    memcpy(data, &shadow->image[addr], size);
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_shadow_update
+********************************************************************************
+*
+* Summary:
+* Brings the mirror in line with a write to the flash. After a failed write,
+* which may have committed part of the range, the mirrored part is read back
+* from the flash; if that fails too, the shadow is disabled.
+*
+* Parameters:
+* eeprom_shadow_t *shadow: shadow instance.
+* uint32_t addr: logical address of the write.
+* const void *data: data of the write.
+* uint32_t size: size of the write.
+* cy_en_em_eeprom_status_t status: status of the write.
+*
+*******************************************************************************/
+void eeprom_shadow_update(eeprom_shadow_t *shadow, uint32_t addr, const void *data,
+                          uint32_t size, cy_en_em_eeprom_status_t status)
+{
+    uint32_t interrupt_state;
+
+    if(addr >= shadow->size)
+    {
+        return;
+    }
+    if(size > (shadow->size - addr))
+    {
+        size = shadow->size - addr;
+    }
+
+    if((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status))
+    {
+        /* Readers in interrupts must not see a half-updated range. */
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+        memcpy(&shadow->image[addr], data, size);
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+    }
+    else
+    {
+        status = Cy_Em_EEPROM_Read(addr, &shadow->image[addr], size, shadow->context);
+        if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+        {
+            shadow->valid = false;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_shadow_data
+********************************************************************************
+*
+* Summary:
+* Returns a pointer into the mirror for zero-copy reads. The data changes
+* with every write to the range.
+*
+* Parameters:
+* const cy_stc_eeprom_context_t *context: Em_EEPROM instance.
+* uint32_t addr: logical address.
+* uint32_t size: size of the range the caller accesses.
+*
+* Return: const void *
+* NULL if the range is not mirrored.
+*
+*******************************************************************************/
+const void *eeprom_shadow_data(const cy_stc_eeprom_context_t *context, uint32_t addr,
+                               uint32_t size)
+{
+    const eeprom_shadow_t *shadow = eeprom_shadow_find(context);
+
+    if((NULL == shadow) || !SHADOW_COVERS(shadow, addr, size))
+    {
+        return NULL;
+    }
+    return &shadow->image[addr];
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name: eeprom_shadow.h
+*
+* Description: This file contains the interface of the RAM shadow of an Em_EEPROM
+*              instance. Reads of the shadowed range are served from RAM, and
+*              writes through eeprom_io_write() update flash and shadow together.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_SHADOW_H
+#define EEPROM_SHADOW_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of instances that can have a shadow at the same time. */
+#ifndef EEPROM_SHADOW_MAX_INSTANCES
+#define EEPROM_SHADOW_MAX_INSTANCES     (4u)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    cy_stc_eeprom_context_t *context;
+    /* Mirror of the logical bytes 0 to size - 1. */
+    uint8_t *image;
+    uint32_t size;
+    /* Cleared if the mirror could not be brought back in line with the flash
+     * after a failed write; reads then go to the flash again.
+     */
+    volatile bool valid;
+} eeprom_shadow_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_shadow_init(eeprom_shadow_t *shadow,
+                                            cy_stc_eeprom_context_t *context,
+                                            uint8_t *image, uint32_t size);
+eeprom_shadow_t *eeprom_shadow_find(const cy_stc_eeprom_context_t *context);
+bool eeprom_shadow_read(const eeprom_shadow_t *shadow, uint32_t addr, void *data, uint32_t size);
+void eeprom_shadow_update(eeprom_shadow_t *shadow, uint32_t addr, const void *data,
+                          uint32_t size, cy_en_em_eeprom_status_t status);
+const void *eeprom_shadow_data(const cy_stc_eeprom_context_t *context, uint32_t addr,
+                               uint32_t size);
+
+#endif /* EEPROM_SHADOW_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,518 @@
+/******************************************************************************
+* File Name: eeprom_stats.c
+*
+* Description: This file contains the wear and health telemetry of Em_EEPROM
+*              instances. eeprom_io.c reports every read and write of a tracked
+*              instance here. The counters live in RAM and can be persisted at a
+*              low rate to another Em_EEPROM instance.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_crc.h"
+#include "eeprom_cycles.h"
+#include "eeprom_io.h"
+#include "eeprom_registry.h"
+#include "eeprom_stats.h"
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Persisted counters. */
+typedef struct
+{
+    eeprom_stats_counters_t counters;
+    uint32_t crc;
+} stats_record_t;
+
+_Static_assert(sizeof(stats_record_t) == EEPROM_STATS_RECORD_SIZE,
+               "EEPROM_STATS_RECORD_SIZE does not match the persisted record");
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void stats_count_row(eeprom_stats_t *stats, uint32_t row);
+static uint32_t stats_row_index(const eeprom_stats_t *stats, const uint32_t *row);
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Tracked instances. The access layer counts every read and write of them. */
+EEPROM_REGISTRY_DEFINE(stats_registry, EEPROM_STATS_MAX_INSTANCES);
+static stats_record_t stats_record;
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_init
+********************************************************************************
+*
+* Summary:
+* Starts tracking an Em_EEPROM instance with all counters cleared. Also
+* starts the DWT cycle counter used for the latency.
+*
+* Parameters:
+* eeprom_stats_t *stats: telemetry instance.
+* const cy_stc_eeprom_config_t *config: configuration of the instance.
+* const cy_stc_eeprom_context_t *context: tracked instance.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_BAD_PARAM if EEPROM_STATS_MAX_INSTANCES are tracked already.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stats_init(eeprom_stats_t *stats,
+                                           const cy_stc_eeprom_config_t *config,
+                                           const cy_stc_eeprom_context_t *context)
+{
+    uint32_t free_slot;
+
+    if((NULL == stats) || (NULL == config) || (NULL == context))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    free_slot = eeprom_registry_slot(&stats_registry, stats, context);
+    if(EEPROM_STATS_MAX_INSTANCES == free_slot)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->context = context;
+    stats->main_rows = CY_EM_EEPROM_GET_PHYSICAL_SIZE(config->eepromSize, config->simpleMode,
+                                                      config->wearLevelingFactor, 0u) /
+                       CY_EM_EEPROM_FLASH_SIZEOF_ROW;
+    eeprom_registry_set(&stats_registry, free_slot, stats, context);
+
+    eeprom_cycles_init();
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_find
+********************************************************************************
+*
+* Summary:
+* Returns the telemetry instance tracking an Em_EEPROM instance.
+*
+* Return:
+* The telemetry instance, or NULL if the instance is not tracked.
+*
+*******************************************************************************/
+eeprom_stats_t *eeprom_stats_find(const cy_stc_eeprom_context_t *context)
+{
+    return (eeprom_stats_t *) eeprom_registry_find(&stats_registry, context);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_record_read
+********************************************************************************
+*
+* Summary:
+* Counts one Cy_Em_EEPROM_Read() call.
+*
+* Parameters:
+* eeprom_stats_t *stats: telemetry instance.
+* cy_en_em_eeprom_status_t status: status returned by the read.
+* uint32_t size: bytes read.
+*
+*******************************************************************************/
+void eeprom_stats_record_read(eeprom_stats_t *stats, cy_en_em_eeprom_status_t status,
+                              uint32_t size)
+{
+    stats->counters.reads++;
+    stats->counters.read_bytes += size;
+
+    if(CY_EM_EEPROM_REDUNDANT_COPY_USED == status)
+    {
+        stats->counters.redundant_copy_used++;
+    }
+    else if(CY_EM_EEPROM_BAD_CHECKSUM == status)
+    {
+        stats->counters.checksum_failures++;
+    }
+    else
+    {
+        /* No other status is counted for reads. */
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_record_write
+********************************************************************************
+*
+* Summary:
+* Counts one Cy_Em_EEPROM_Write() call and the rows it programmed. With wear
+* leveling these are the rows after the last written row before the call, up
+* to the last written row after it; in simple mode they are the rows holding
+* the written range. The redundant copy of each row is counted too.
+*
+* Parameters:
+* eeprom_stats_t *stats: telemetry instance.
+* cy_en_em_eeprom_status_t status: status returned by the write.
+* uint32_t addr: logical address of the write.
+* uint32_t size: bytes written.
+* uint32_t latency_us: duration of the call.
+* const uint32_t *last_row: ptrLastWrittenRow of the context before the call.
+*
+*******************************************************************************/
+void eeprom_stats_record_write(eeprom_stats_t *stats, cy_en_em_eeprom_status_t status,
+                               uint32_t addr, uint32_t size, uint32_t latency_us,
+                               const uint32_t *last_row)
+{
+    eeprom_stats_counters_t *counters = &stats->counters;
+    uint32_t bucket = 0u;
+
+    counters->writes++;
+    counters->write_bytes += size;
+    counters->write_time_us += latency_us;
+    stats->unsaved_writes++;
+
+    while(((bucket + 1u) < EEPROM_STATS_LATENCY_BUCKETS) &&
+          (latency_us >= (EEPROM_STATS_LATENCY_BASE_US << bucket)))
+    {
+        bucket++;
+    }
+    counters->write_latency[bucket]++;
+    if(latency_us > counters->write_latency_max_us)
+    {
+        counters->write_latency_max_us = latency_us;
+    }
+
+    if(CY_EM_EEPROM_REDUNDANT_COPY_USED == status)
+    {
+        counters->redundant_copy_used++;
+    }
+    else if(CY_EM_EEPROM_BAD_CHECKSUM == status)
+    {
+        counters->checksum_failures++;
+        return;
+    }
+    else if(CY_EM_EEPROM_SUCCESS != status)
+    {
+        counters->write_failures++;
+        return;
+    }
+    else
+    {
+        /* Success. */
+    }
+
+    if((0u == size) || (0u == stats->main_rows))
+    {
+        return;
+    }
+
+    if(0u != stats->context->simpleMode)
+    {
+        for(uint32_t row = addr / CY_EM_EEPROM_EEPROM_DATA_LEN(1u);
+            row <= ((addr + size - 1u) / CY_EM_EEPROM_EEPROM_DATA_LEN(1u)); row++)
+        {
+            stats_count_row(stats, row);
+        }
+    }
+    else
+    {
+        uint32_t before = (NULL != last_row) ? stats_row_index(stats, last_row) :
+                          (stats->main_rows - 1u);
+        uint32_t after = stats_row_index(stats, stats->context->ptrLastWrittenRow);
+        uint32_t count = ((after + stats->main_rows) - before) % stats->main_rows;
+
+        for(uint32_t i = 1u; i <= count; i++)
+        {
+            stats_count_row(stats, (before + i) % stats->main_rows);
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_record_suppressed
+********************************************************************************
+*
+* Summary:
+* Counts bytes that a write left alone because the EEPROM held them already.
+*
+* Parameters:
+* eeprom_stats_t *stats: telemetry instance.
+* uint32_t size: bytes not programmed.
+* bool whole: true if the write programmed nothing at all.
+*
+*******************************************************************************/
+void eeprom_stats_record_suppressed(eeprom_stats_t *stats, uint32_t size, bool whole)
+{
+    stats->counters.suppressed_bytes += size;
+    if(whole)
+    {
+        stats->counters.suppressed_writes++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_get
+********************************************************************************
+*
+* Summary:
+* Returns the counters of a telemetry instance.
+*
+*******************************************************************************/
+const eeprom_stats_counters_t *eeprom_stats_get(const eeprom_stats_t *stats)
+{
+    return &stats->counters;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_average_write_us
+********************************************************************************
+*
+* Summary:
+* Returns the average duration of a write in microseconds.
+*
+*******************************************************************************/
+uint32_t eeprom_stats_average_write_us(const eeprom_stats_t *stats)
+{
+    return (0u != stats->counters.writes) ?
+           (stats->counters.write_time_us / stats->counters.writes) : 0u;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_max_row_programs
+********************************************************************************
+*
+* Summary:
+* Returns the program count of the most worn row.
+*
+*******************************************************************************/
+uint32_t eeprom_stats_max_row_programs(const eeprom_stats_t *stats)
+{
+    uint32_t max = 0u;
+
+    for(uint32_t i = 0u; i < EEPROM_STATS_MAX_ROWS; i++)
+    {
+        if(stats->counters.row_programs[i] > max)
+        {
+            max = stats->counters.row_programs[i];
+        }
+    }
+    return max;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_wear_percent
+********************************************************************************
+*
+* Summary:
+* Returns the wear level of the most worn row in percent of
+* EEPROM_STATS_ROW_ENDURANCE.
+*
+*******************************************************************************/
+uint32_t eeprom_stats_wear_percent(const eeprom_stats_t *stats)
+{
+    return (uint32_t) (((uint64_t) eeprom_stats_max_row_programs(stats) * 100u) /
+                       EEPROM_STATS_ROW_ENDURANCE);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_save_due
+********************************************************************************
+*
+* Summary:
+* Returns true once EEPROM_STATS_SAVE_INTERVAL writes were counted since the
+* last save.
+*
+*******************************************************************************/
+bool eeprom_stats_save_due(const eeprom_stats_t *stats)
+{
+    return (stats->unsaved_writes >= EEPROM_STATS_SAVE_INTERVAL);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_save
+********************************************************************************
+*
+* Summary:
+* Persists the counters with a CRC. Use a different Em_EEPROM instance than
+* the tracked one, so that saving does not add to the wear it measures.
+*
+* Parameters:
+* eeprom_stats_t *stats: telemetry instance.
+* uint32_t addr: logical address of the record in the storage instance.
+* cy_stc_eeprom_context_t *storage: Em_EEPROM instance for the record.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stats_save(eeprom_stats_t *stats, uint32_t addr,
+                                           cy_stc_eeprom_context_t *storage)
+{
+    cy_en_em_eeprom_status_t status;
+
+    if((NULL == stats) || (NULL == storage))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    stats_record.counters = stats->counters;
+    stats_record.crc = eeprom_crc32_update(0u, &stats_record.counters,
+                                           sizeof(stats_record.counters));
+    status = eeprom_io_write(addr, &stats_record, sizeof(stats_record), storage);
+    if((CY_EM_EEPROM_SUCCESS == status) || (CY_EM_EEPROM_REDUNDANT_COPY_USED == status))
+    {
+        stats->unsaved_writes = 0u;
+    }
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stats_load
+********************************************************************************
+*
+* Summary:
+* Adds the persisted counters to the counters in RAM, so that they are kept
+* across resets. A record that fails the CRC, such as one never saved, is
+* ignored.
+*
+* Parameters:
+* eeprom_stats_t *stats: telemetry instance.
+* uint32_t addr: logical address of the record in the storage instance.
+* cy_stc_eeprom_context_t *storage: Em_EEPROM instance holding the record.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_BAD_DATA if there is no valid record.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stats_load(eeprom_stats_t *stats, uint32_t addr,
+                                           cy_stc_eeprom_context_t *storage)
+{
+    eeprom_stats_counters_t *counters;
+    const eeprom_stats_counters_t *saved = &stats_record.counters;
+    cy_en_em_eeprom_status_t status;
+
+    if((NULL == stats) || (NULL == storage))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    status = eeprom_io_read(addr, &stats_record, sizeof(stats_record), storage);
+    if((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status))
+    {
+        return status;
+    }
+    if(stats_record.crc != eeprom_crc32_update(0u, saved, sizeof(*saved)))
+    {
+        return CY_EM_EEPROM_BAD_DATA;
+    }
+
+    counters = &stats->counters;
+    counters->reads += saved->reads;
+    counters->writes += saved->writes;
+    counters->read_bytes += saved->read_bytes;
+    counters->write_bytes += saved->write_bytes;
+    counters->redundant_copy_used += saved->redundant_copy_used;
+    counters->checksum_failures += saved->checksum_failures;
+    counters->write_failures += saved->write_failures;
+    counters->write_time_us += saved->write_time_us;
+    counters->suppressed_writes += saved->suppressed_writes;
+    counters->suppressed_bytes += saved->suppressed_bytes;
+    if(saved->write_latency_max_us > counters->write_latency_max_us)
+    {
+        counters->write_latency_max_us = saved->write_latency_max_us;
+    }
+    for(uint32_t i = 0u; i < EEPROM_STATS_LATENCY_BUCKETS; i++)
+    {
+        counters->write_latency[i] += saved->write_latency[i];
+    }
+    for(uint32_t i = 0u; i < EEPROM_STATS_MAX_ROWS; i++)
+    {
+        counters->row_programs[i] += saved->row_programs[i];
+    }
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: stats_count_row
+********************************************************************************
+*
+* Summary:
+* Counts a program of a row of the main copy and of its redundant copy.
+*
+*******************************************************************************/
+static void stats_count_row(eeprom_stats_t *stats, uint32_t row)
+{
+    uint32_t index = (row < EEPROM_STATS_MAX_ROWS) ? row : (EEPROM_STATS_MAX_ROWS - 1u);
+
+    stats->counters.row_programs[index]++;
+
+    if(0u != stats->context->redundantCopy)
+    {
+        row += stats->main_rows;
+        index = (row < EEPROM_STATS_MAX_ROWS) ? row : (EEPROM_STATS_MAX_ROWS - 1u);
+        stats->counters.row_programs[index]++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: stats_row_index
+********************************************************************************
+*
+* Summary:
+* Returns the index of a row of the main copy from its address.
+*
+*******************************************************************************/
+static uint32_t stats_row_index(const eeprom_stats_t *stats, const uint32_t *row)
+{
+    return (((uint32_t) row - stats->context->userFlashStartAddr) /
+            CY_EM_EEPROM_FLASH_SIZEOF_ROW) % stats->main_rows;
+}
+
+
+/* [] END OF FILE */
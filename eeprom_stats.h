@@ -0,0 +1,152 @@
+/******************************************************************************
+* File Name: eeprom_stats.h
+*
+* Description: This file contains the interface of the wear and health
+*              telemetry kept for an Em_EEPROM instance: per-row program counts,
+*              redundant-copy fallbacks, checksum failures and write latency.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_STATS_H
+#define EEPROM_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Number of instances that can be tracked at the same time. */
+#ifndef EEPROM_STATS_MAX_INSTANCES
+#define EEPROM_STATS_MAX_INSTANCES      (4u)
+#endif
+
+/* Number of physical rows with a program counter, from the start of the
+ * instance. Rows beyond are counted in the last counter.
+ */
+#ifndef EEPROM_STATS_MAX_ROWS
+#define EEPROM_STATS_MAX_ROWS           (32u)
+#endif
+
+/* Write latency histogram. Bucket i counts writes that took less than
+ * EEPROM_STATS_LATENCY_BASE_US << i microseconds, the last bucket the rest.
+ */
+#define EEPROM_STATS_LATENCY_BUCKETS    (10u)
+#ifndef EEPROM_STATS_LATENCY_BASE_US
+#define EEPROM_STATS_LATENCY_BASE_US    (500u)
+#endif
+
+/* Rated program/erase endurance of a flash row, used for the wear level. */
+#ifndef EEPROM_STATS_ROW_ENDURANCE
+#define EEPROM_STATS_ROW_ENDURANCE      (100000u)
+#endif
+
+/* Number of writes after which eeprom_stats_save_due() asks for the
+ * counters to be persisted.
+ */
+#ifndef EEPROM_STATS_SAVE_INTERVAL
+#define EEPROM_STATS_SAVE_INTERVAL      (1024u)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Counters of one instance. This is also the persisted format. */
+typedef struct
+{
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t read_bytes;
+    uint32_t write_bytes;
+    uint32_t redundant_copy_used;
+    uint32_t checksum_failures;
+    uint32_t write_failures;
+    uint32_t write_time_us;
+    uint32_t write_latency_max_us;
+    /* Writes that programmed nothing because the data was stored already,
+     * and the bytes not programmed because they were unchanged.
+     */
+    uint32_t suppressed_writes;
+    uint32_t suppressed_bytes;
+    uint32_t write_latency[EEPROM_STATS_LATENCY_BUCKETS];
+    uint32_t row_programs[EEPROM_STATS_MAX_ROWS];
+} eeprom_stats_counters_t;
+
+typedef struct
+{
+    const cy_stc_eeprom_context_t *context;
+    /* Rows of the main copy, the redundant copy follows them. */
+    uint32_t main_rows;
+    uint32_t unsaved_writes;
+    eeprom_stats_counters_t counters;
+} eeprom_stats_t;
+
+/* Logical bytes taken by the record of eeprom_stats_save(): the counters and
+ * their CRC.
+ */
+#define EEPROM_STATS_RECORD_SIZE        (sizeof(eeprom_stats_counters_t) + sizeof(uint32_t))
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stats_init(eeprom_stats_t *stats,
+                                           const cy_stc_eeprom_config_t *config,
+                                           const cy_stc_eeprom_context_t *context);
+eeprom_stats_t *eeprom_stats_find(const cy_stc_eeprom_context_t *context);
+void eeprom_stats_record_read(eeprom_stats_t *stats, cy_en_em_eeprom_status_t status,
+                              uint32_t size);
+void eeprom_stats_record_write(eeprom_stats_t *stats, cy_en_em_eeprom_status_t status,
+                               uint32_t addr, uint32_t size, uint32_t latency_us,
+                               const uint32_t *last_row);
+void eeprom_stats_record_suppressed(eeprom_stats_t *stats, uint32_t size, bool whole);
+const eeprom_stats_counters_t *eeprom_stats_get(const eeprom_stats_t *stats);
+uint32_t eeprom_stats_average_write_us(const eeprom_stats_t *stats);
+uint32_t eeprom_stats_max_row_programs(const eeprom_stats_t *stats);
+uint32_t eeprom_stats_wear_percent(const eeprom_stats_t *stats);
+bool eeprom_stats_save_due(const eeprom_stats_t *stats);
+cy_en_em_eeprom_status_t eeprom_stats_save(eeprom_stats_t *stats, uint32_t addr,
+                                           cy_stc_eeprom_context_t *storage);
+cy_en_em_eeprom_status_t eeprom_stats_load(eeprom_stats_t *stats, uint32_t addr,
+                                           cy_stc_eeprom_context_t *storage);
+
+#endif /* EEPROM_STATS_H */
+
+/* [] END OF FILE */
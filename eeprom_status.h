@@ -0,0 +1,106 @@
+/******************************************************************************
+* File Name: eeprom_status.h
+*
+* Description: This file contains the statuses that the EEPROM modules of this
+*              example return in addition to those of the Em_EEPROM middleware.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_STATUS_H
+#define EEPROM_STATUS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* A request was not accepted because a queue is full, or a cache holds data
+ * that is not written yet. Nothing is lost: the caller retries once the queue
+ * has drained or the cache is flushed. The value lies in the range of
+ * the middleware and does not collide with its statuses.
+ */
+#define EEPROM_STATUS_BUSY \
+    ((cy_en_em_eeprom_status_t) ((uint32_t) CY_EM_EEPROM_REDUNDANT_COPY_USED | 0x80uL))
+
+/* A task, queue or other object could not be allocated. Unlike
+ * EEPROM_STATUS_BUSY, retrying does not help until memory is freed.
+ */
+#define EEPROM_STATUS_NO_MEMORY \
+    ((cy_en_em_eeprom_status_t) ((uint32_t) CY_EM_EEPROM_REDUNDANT_COPY_USED | 0x40uL))
+
+
+/*******************************************************************************
+* Function Name: eeprom_status_failed
+********************************************************************************
+*
+* Summary:
+* Returns true for a status that is neither CY_EM_EEPROM_SUCCESS nor the
+* CY_EM_EEPROM_REDUNDANT_COPY_USED warning, with which the data is valid.
+*
+*******************************************************************************/
+__STATIC_INLINE bool eeprom_status_failed(cy_en_em_eeprom_status_t status)
+{
+    return ((CY_EM_EEPROM_SUCCESS != status) && (CY_EM_EEPROM_REDUNDANT_COPY_USED != status));
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_status_combine
+********************************************************************************
+*
+* Summary:
+* Combines the status of a sequence of accesses with the result of the next
+* one: a failure wins, then CY_EM_EEPROM_REDUNDANT_COPY_USED.
+*
+*******************************************************************************/
+__STATIC_INLINE cy_en_em_eeprom_status_t eeprom_status_combine(cy_en_em_eeprom_status_t status,
+                                                               cy_en_em_eeprom_status_t result)
+{
+    if(eeprom_status_failed(status) || (CY_EM_EEPROM_SUCCESS == result))
+    {
+        return status;
+    }
+    return result;
+}
+
+#endif /* EEPROM_STATUS_H */
+
+/* [] END OF FILE */
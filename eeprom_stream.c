@@ -0,0 +1,455 @@
+/******************************************************************************
+* File Name: eeprom_stream.c
+*
+* Description: This file implements the blob streams. A writer collects the
+*              appended data in a buffer that ends on an Em_EEPROM row
+*              boundary and writes it when it is full, so a blob of any
+*              size is programmed row by row. The header with the length and
+*              CRC of the blob is written last, a blob that was not closed
+*              reads as missing. A reader returns the blob in chunks of any
+*              size and checks the CRC with the last chunk.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "eeprom_crc.h"
+#include "eeprom_io.h"
+#include "eeprom_status.h"
+#include "eeprom_stream.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* "BLOB" */
+#define STREAM_MAGIC            (0x424F4C42uL)
+
+#define STREAM_WORD_MAGIC       (0u)
+#define STREAM_WORD_LENGTH      (1u)
+#define STREAM_WORD_CRC         (2u)
+#define STREAM_WORD_CHECK       (3u)
+
+/* Logical address of the first buffered byte. */
+#define STREAM_BUFFER_ADDR(writer) \
+    ((writer)->addr + EEPROM_STREAM_HEADER_SIZE + (writer)->length - (writer)->fill)
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t stream_room(const eeprom_stream_writer_t *writer);
+static cy_en_em_eeprom_status_t stream_flush(eeprom_stream_writer_t *writer);
+
+
+/*******************************************************************************
+* Function Name: eeprom_stream_write_open
+********************************************************************************
+*
+* Summary:
+* Starts a blob at a logical address. The header of the blob stored there
+* before is cleared first, so until eeprom_stream_write_close() returns, the
+* blob reads as missing, and a blob cut short by a power loss is never
+* returned.
+*
+* Parameters:
+* eeprom_stream_writer_t *writer: writer instance.
+* cy_stc_eeprom_context_t *context: Em_EEPROM instance.
+* uint32_t addr: logical address of the blob.
+* uint32_t capacity: logical bytes reserved for the blob, at least
+*  EEPROM_STREAM_SIZE() of its length.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stream_write_open(eeprom_stream_writer_t *writer,
+                                                  cy_stc_eeprom_context_t *context,
+                                                  uint32_t addr, uint32_t capacity)
+{
+    const uint32_t header[EEPROM_STREAM_HEADER_SIZE / sizeof(uint32_t)] = {0u};
+    cy_en_em_eeprom_status_t status;
+
+    if((NULL == writer) || (NULL == context) || (capacity < EEPROM_STREAM_HEADER_SIZE))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    status = eeprom_io_ready(context);
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+    if((capacity > context->eepromSize) || (addr > (context->eepromSize - capacity)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    writer->context = context;
+    writer->addr = addr;
+    writer->capacity = capacity;
+    writer->length = 0u;
+    writer->fill = 0u;
+    writer->crc = 0u;
+
+    return eeprom_io_write(addr, header, sizeof(header), context);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stream_write
+********************************************************************************
+*
+* Summary:
+* Appends data to the blob. The data is copied to the buffer, and every time
+* the buffer reaches a row boundary it is written.
+*
+* Parameters:
+* eeprom_stream_writer_t *writer: writer instance.
+* const void *data: data to append.
+* uint32_t size: number of bytes, within the capacity left.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stream_write(eeprom_stream_writer_t *writer,
+                                             const void *data, uint32_t size)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint8_t *space;
+    uint32_t chunk;
+
+    if((NULL == writer) || ((NULL == data) && (0u != size)) ||
+       (size > (writer->capacity - EEPROM_STREAM_HEADER_SIZE - writer->length)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    while(0u != size)
+    {
+        chunk = eeprom_stream_write_reserve(writer, &space);
+        if(chunk > size)
+        {
+            chunk = size;
+        }
+
+        (void) memcpy(space, bytes, chunk);
+        status = eeprom_status_combine(status, eeprom_stream_write_commit(writer, chunk));
+        if(eeprom_status_failed(status))
+        {
+            break;
+        }
+
+        bytes += chunk;
+        size -= chunk;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stream_write_reserve
+********************************************************************************
+*
+* Summary:
+* Returns the free space of the buffer up to the next row boundary, so that a
+* UART or DMA transfer can fill it in place. Pass the number of bytes filled
+* to eeprom_stream_write_commit().
+*
+* Parameters:
+* eeprom_stream_writer_t *writer: writer instance.
+* uint8_t **space: returned start of the free space.
+*
+* Return: uint32_t
+* Free bytes at *space, 0 if the capacity is used up.
+*
+*******************************************************************************/
+uint32_t eeprom_stream_write_reserve(eeprom_stream_writer_t *writer, uint8_t **space)
+{
+    if((NULL == writer) || (NULL == space))
+    {
+        return 0u;
+    }
+
+    *space = &writer->buffer[writer->fill];
+
+    return stream_room(writer);
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stream_write_commit
+********************************************************************************
+*
+* Summary:
+* Appends the bytes filled in at the space returned by
+* eeprom_stream_write_reserve() to the blob, and writes the buffer if it
+* reached the row boundary.
+*
+* Parameters:
+* eeprom_stream_writer_t *writer: writer instance.
+* uint32_t size: number of bytes filled, at most the reserved size.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stream_write_commit(eeprom_stream_writer_t *writer,
+                                                    uint32_t size)
+{
+    uint32_t room;
+
+    if(NULL == writer)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    room = stream_room(writer);
+    if(size > room)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    writer->crc = eeprom_crc32_update(writer->crc, &writer->buffer[writer->fill], size);
+    writer->fill += size;
+    writer->length += size;
+
+    /* The capacity can end before the row does. */
+    return (0u == stream_room(writer)) ? stream_flush(writer) : CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stream_write_close
+********************************************************************************
+*
+* Summary:
+* Writes the buffered rest of the blob, then the header with its length and
+* CRC, which makes the blob visible to readers.
+*
+* Parameters:
+* eeprom_stream_writer_t *writer: writer instance.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stream_write_close(eeprom_stream_writer_t *writer)
+{
+    uint32_t header[EEPROM_STREAM_HEADER_SIZE / sizeof(uint32_t)];
+    cy_en_em_eeprom_status_t status;
+
+    if(NULL == writer)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    status = stream_flush(writer);
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+
+    header[STREAM_WORD_MAGIC] = STREAM_MAGIC;
+    header[STREAM_WORD_LENGTH] = writer->length;
+    header[STREAM_WORD_CRC] = writer->crc;
+    header[STREAM_WORD_CHECK] = eeprom_crc32_update(0u, header,
+                                                    STREAM_WORD_CHECK * sizeof(uint32_t));
+
+    return eeprom_status_combine(status, eeprom_io_write(writer->addr, header, sizeof(header),
+                                                         writer->context));
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stream_read_open
+********************************************************************************
+*
+* Summary:
+* Opens the blob at a logical address for reading.
+*
+* Parameters:
+* eeprom_stream_reader_t *reader: reader instance.
+* cy_stc_eeprom_context_t *context: Em_EEPROM instance.
+* uint32_t addr: logical address of the blob.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_BAD_DATA if no closed blob is stored at the address.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stream_read_open(eeprom_stream_reader_t *reader,
+                                                 cy_stc_eeprom_context_t *context,
+                                                 uint32_t addr)
+{
+    uint32_t header[EEPROM_STREAM_HEADER_SIZE / sizeof(uint32_t)];
+    cy_en_em_eeprom_status_t status;
+
+    if((NULL == reader) || (NULL == context))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    status = eeprom_io_read(addr, header, sizeof(header), context);
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+
+    if((STREAM_MAGIC != header[STREAM_WORD_MAGIC]) ||
+       (header[STREAM_WORD_CHECK] != eeprom_crc32_update(0u, header,
+                                                         STREAM_WORD_CHECK * sizeof(uint32_t))) ||
+       (header[STREAM_WORD_LENGTH] >
+        (context->eepromSize - addr - EEPROM_STREAM_HEADER_SIZE)))
+    {
+        return CY_EM_EEPROM_BAD_DATA;
+    }
+
+    reader->context = context;
+    reader->addr = addr + EEPROM_STREAM_HEADER_SIZE;
+    reader->length = header[STREAM_WORD_LENGTH];
+    reader->offset = 0u;
+    reader->crc = 0u;
+    reader->expected_crc = header[STREAM_WORD_CRC];
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_stream_read
+********************************************************************************
+*
+* Summary:
+* Reads the next chunk of the blob. The CRC of the blob is checked when its
+* last byte is read, so the data of earlier chunks must not be relied upon
+* before the stream ends without an error.
+*
+* Parameters:
+* eeprom_stream_reader_t *reader: reader instance.
+* void *data: buffer for the chunk.
+* uint32_t size: size of the buffer.
+* uint32_t *count: returned number of bytes read, 0 at the end of the blob.
+*
+* Return: cy_en_em_eeprom_status_t
+* CY_EM_EEPROM_BAD_CHECKSUM with the last chunk if the CRC does not match.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stream_read(eeprom_stream_reader_t *reader, void *data,
+                                            uint32_t size, uint32_t *count)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    uint32_t chunk;
+
+    if((NULL == reader) || (NULL == count) || ((NULL == data) && (0u != size)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    chunk = reader->length - reader->offset;
+    if(chunk > size)
+    {
+        chunk = size;
+    }
+    *count = 0u;
+
+    if(0u != chunk)
+    {
+        status = eeprom_io_read(reader->addr + reader->offset, data, chunk, reader->context);
+        if(eeprom_status_failed(status))
+        {
+            return status;
+        }
+
+        reader->crc = eeprom_crc32_update(reader->crc, data, chunk);
+        reader->offset += chunk;
+        *count = chunk;
+
+        if((reader->offset == reader->length) && (reader->crc != reader->expected_crc))
+        {
+            status = CY_EM_EEPROM_BAD_CHECKSUM;
+        }
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: stream_room
+********************************************************************************
+*
+* Summary:
+* Returns the bytes that can be buffered before the next row boundary or the
+* end of the capacity.
+*
+*******************************************************************************/
+static uint32_t stream_room(const eeprom_stream_writer_t *writer)
+{
+    uint32_t room = EEPROM_STREAM_BUFFER_SIZE -
+                    (STREAM_BUFFER_ADDR(writer) % EEPROM_STREAM_BUFFER_SIZE) - writer->fill;
+    uint32_t left = writer->capacity - EEPROM_STREAM_HEADER_SIZE - writer->length;
+
+    return (room < left) ? room : left;
+}
+
+
+/*******************************************************************************
+* Function Name: stream_flush
+********************************************************************************
+*
+* Summary:
+* Writes the buffered bytes, which lie within one row, with one write.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t stream_flush(eeprom_stream_writer_t *writer)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+
+    if(0u != writer->fill)
+    {
+        status = eeprom_io_write(STREAM_BUFFER_ADDR(writer), writer->buffer, writer->fill,
+                                 writer->context);
+        if(!eeprom_status_failed(status))
+        {
+            writer->fill = 0u;
+        }
+    }
+
+    return status;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,122 @@
+/******************************************************************************
+* File Name: eeprom_stream.h
+*
+* Description: This file contains the structures and function prototypes of
+*              the blob streams, which write and read a blob of any size
+*              through a buffer of at most one flash row.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_STREAM_H
+#define EEPROM_STREAM_H
+
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Bytes buffered by a writer. A full buffer is written with one
+ * Cy_Em_EEPROM_Write() call that covers one Em_EEPROM row; the default matches
+ * the logical bytes of a row in the normal (non-simple) mode. It must not be
+ * larger than CY_EM_EEPROM_FLASH_SIZEOF_ROW.
+ */
+#ifndef EEPROM_STREAM_BUFFER_SIZE
+#define EEPROM_STREAM_BUFFER_SIZE       (CY_EM_EEPROM_EEPROM_DATA_LEN(0u))
+#endif
+
+/* Blob header: magic, length, CRC of the data, CRC of the header words. The
+ * data follows the header.
+ */
+#define EEPROM_STREAM_HEADER_SIZE       (16u)
+
+/* Logical bytes taken by a blob of a given length. */
+#define EEPROM_STREAM_SIZE(length)      (EEPROM_STREAM_HEADER_SIZE + (length))
+
+#if (EEPROM_STREAM_BUFFER_SIZE > CY_EM_EEPROM_FLASH_SIZEOF_ROW)
+#error "EEPROM_STREAM_BUFFER_SIZE must not exceed CY_EM_EEPROM_FLASH_SIZEOF_ROW"
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    cy_stc_eeprom_context_t *context;
+    uint32_t addr;
+    uint32_t capacity;
+    /* Bytes appended so far, the last fill bytes of them still buffered. */
+    uint32_t length;
+    uint32_t fill;
+    uint32_t crc;
+    uint8_t buffer[EEPROM_STREAM_BUFFER_SIZE];
+} eeprom_stream_writer_t;
+
+typedef struct
+{
+    cy_stc_eeprom_context_t *context;
+    uint32_t addr;
+    uint32_t length;
+    uint32_t offset;
+    uint32_t crc;
+    uint32_t expected_crc;
+} eeprom_stream_reader_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_stream_write_open(eeprom_stream_writer_t *writer,
+                                                  cy_stc_eeprom_context_t *context,
+                                                  uint32_t addr, uint32_t capacity);
+cy_en_em_eeprom_status_t eeprom_stream_write(eeprom_stream_writer_t *writer,
+                                             const void *data, uint32_t size);
+uint32_t eeprom_stream_write_reserve(eeprom_stream_writer_t *writer, uint8_t **space);
+cy_en_em_eeprom_status_t eeprom_stream_write_commit(eeprom_stream_writer_t *writer,
+                                                    uint32_t size);
+cy_en_em_eeprom_status_t eeprom_stream_write_close(eeprom_stream_writer_t *writer);
+cy_en_em_eeprom_status_t eeprom_stream_read_open(eeprom_stream_reader_t *reader,
+                                                 cy_stc_eeprom_context_t *context,
+                                                 uint32_t addr);
+cy_en_em_eeprom_status_t eeprom_stream_read(eeprom_stream_reader_t *reader, void *data,
+                                            uint32_t size, uint32_t *count);
+
+#endif /* EEPROM_STREAM_H */
+
+/* [] END OF FILE */
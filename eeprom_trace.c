@@ -0,0 +1,207 @@
+/******************************************************************************
+* File Name: eeprom_trace.c
+*
+* Description: This file implements the trace record output of the EEPROM
+*              modules, either to an ITM stimulus port or to a RAM ring
+*              buffer that is printed over the UART.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include "eeprom_cycles.h"
+#include "eeprom_trace.h"
+
+#if (EEPROM_TRACE_NONE != EEPROM_TRACE)
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define TRACE_INFO(event, phase, size) \
+    ((uint32_t) (event) | ((uint32_t) (phase) << 8u) | ((uint32_t) (size) << 16u))
+#define TRACE_INFO_EVENT(info)          ((info) & 0xFFu)
+#define TRACE_INFO_PHASE(info)          (((info) >> 8u) & 0xFFu)
+#define TRACE_INFO_SIZE(info)           ((info) >> 16u)
+#define TRACE_MAX_SIZE                  (0xFFFFu)
+
+#if ((EEPROM_TRACE_RING_SIZE & (EEPROM_TRACE_RING_SIZE - 1u)) != 0u)
+#error "EEPROM_TRACE_RING_SIZE must be a power of two"
+#endif
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+#if (EEPROM_TRACE_RAM == EEPROM_TRACE)
+static eeprom_trace_record_t trace_ring[EEPROM_TRACE_RING_SIZE];
+/* Records emitted and records printed since eeprom_trace_init(). */
+static volatile uint32_t trace_head;
+static uint32_t trace_tail;
+
+static const char *const trace_event_names[EEPROM_TRACE_EVENT_COUNT] =
+{
+    "init", "read", "write", "erase", "redundant",
+};
+static const char *const trace_phase_names[] =
+{
+    "begin", "end", "point",
+};
+#endif
+
+
+/*******************************************************************************
+* Function Name: eeprom_trace_init
+********************************************************************************
+*
+* Summary:
+* Starts the cycle counter the records are stamped with and empties the RAM
+* ring. For EEPROM_TRACE_ITM the debugger enables the ITM and the stimulus
+* port; records are dropped while it is disabled.
+*
+*******************************************************************************/
+void eeprom_trace_init(void)
+{
+    eeprom_cycles_init();
+#if (EEPROM_TRACE_RAM == EEPROM_TRACE)
+    trace_head = 0u;
+    trace_tail = 0u;
+#endif
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_trace_emit
+********************************************************************************
+*
+* Summary:
+* Emits one record. Use the EEPROM_TRACE_* macros instead, which compile to
+* nothing without EEPROM_TRACE. Can be called from interrupts.
+*
+* Parameters:
+* eeprom_trace_event_t event: traced operation.
+* uint32_t phase: EEPROM_TRACE_BEGIN, EEPROM_TRACE_END or EEPROM_TRACE_POINT.
+* uint32_t size: bytes of the operation, saturated to 16 bits.
+* uint32_t arg: address or status.
+*
+*******************************************************************************/
+void eeprom_trace_emit(eeprom_trace_event_t event, uint32_t phase, uint32_t size, uint32_t arg)
+{
+    uint32_t interrupt_state;
+    uint32_t cycles = eeprom_cycles_now();
+    uint32_t info = TRACE_INFO(event, phase, (size > TRACE_MAX_SIZE) ? TRACE_MAX_SIZE : size);
+
+#if (EEPROM_TRACE_ITM == EEPROM_TRACE)
+    if((0u == (ITM->TCR & ITM_TCR_ITMENA_Msk)) ||
+       (0u == (ITM->TER & (1uL << EEPROM_TRACE_ITM_PORT))))
+    {
+        return;
+    }
+
+    /* The three words of a record must not interleave with another one. */
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    while(0u == ITM->PORT[EEPROM_TRACE_ITM_PORT].u32) { }
+    ITM->PORT[EEPROM_TRACE_ITM_PORT].u32 = cycles;
+    while(0u == ITM->PORT[EEPROM_TRACE_ITM_PORT].u32) { }
+    ITM->PORT[EEPROM_TRACE_ITM_PORT].u32 = info;
+    while(0u == ITM->PORT[EEPROM_TRACE_ITM_PORT].u32) { }
+    ITM->PORT[EEPROM_TRACE_ITM_PORT].u32 = arg;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+#else
+    eeprom_trace_record_t *record;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    record = &trace_ring[trace_head & (EEPROM_TRACE_RING_SIZE - 1u)];
+    record->cycles = cycles;
+    record->info = info;
+    record->arg = arg;
+    trace_head++;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+#endif
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_trace_dump
+********************************************************************************
+*
+* Summary:
+* Prints the records of the RAM ring that were not printed yet, oldest first,
+* each with the time since the record before it. Records overwritten before
+* they were printed are counted as lost. Does nothing for EEPROM_TRACE_ITM.
+*
+*******************************************************************************/
+void eeprom_trace_dump(void)
+{
+#if (EEPROM_TRACE_RAM == EEPROM_TRACE)
+    eeprom_trace_record_t record;
+    uint32_t interrupt_state;
+    uint32_t previous = 0u;
+    uint32_t head = trace_head;
+    uint32_t lost = 0u;
+
+    if((head - trace_tail) > EEPROM_TRACE_RING_SIZE)
+    {
+        lost = (head - trace_tail) - EEPROM_TRACE_RING_SIZE;
+        trace_tail = head - EEPROM_TRACE_RING_SIZE;
+    }
+    printf("EEPROM trace: %lu records, %lu lost\r\n",
+           (unsigned long) (head - trace_tail), (unsigned long) lost);
+
+    for(uint32_t i = 0u; trace_tail != head; i++, trace_tail++)
+    {
+        /* Newer records may be emitted while this one is printed. */
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+        record = trace_ring[trace_tail & (EEPROM_TRACE_RING_SIZE - 1u)];
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+        printf("%10lu +%8lu us  %-9s %-5s size %5lu  0x%08lx\r\n",
+               (unsigned long) record.cycles,
+               (unsigned long) ((0u == i) ? 0u : eeprom_cycles_to_us(record.cycles - previous)),
+               trace_event_names[TRACE_INFO_EVENT(record.info)],
+               trace_phase_names[TRACE_INFO_PHASE(record.info)],
+               (unsigned long) TRACE_INFO_SIZE(record.info),
+               (unsigned long) record.arg);
+        previous = record.cycles;
+    }
+#endif
+}
+
+#endif /* #if (EEPROM_TRACE_NONE != EEPROM_TRACE) */
+
+
+/* [] END OF FILE */
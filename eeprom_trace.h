@@ -0,0 +1,139 @@
+/******************************************************************************
+* File Name: eeprom_trace.h
+*
+* Description: This file contains the trace points of the EEPROM modules.
+*              With EEPROM_TRACE set, each point emits a timestamped record
+*              over ITM/SWO or into a RAM ring buffer; otherwise the points
+*              compile to nothing.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_TRACE_H
+#define EEPROM_TRACE_H
+
+#include <stdint.h>
+#include "cy_pdl.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Values of EEPROM_TRACE. */
+#define EEPROM_TRACE_NONE               (0u)
+/* Records are written to stimulus port EEPROM_TRACE_ITM_PORT, three words
+ * each, and leave the device over SWO.
+ */
+#define EEPROM_TRACE_ITM                (1u)
+/* Records are kept in a RAM ring of EEPROM_TRACE_RING_SIZE entries and
+ * printed by eeprom_trace_dump().
+ */
+#define EEPROM_TRACE_RAM                (2u)
+
+#ifndef EEPROM_TRACE
+#define EEPROM_TRACE                    EEPROM_TRACE_NONE
+#endif
+
+#ifndef EEPROM_TRACE_ITM_PORT
+#define EEPROM_TRACE_ITM_PORT           (1u)
+#endif
+
+/* Power of two; the oldest records are overwritten. */
+#ifndef EEPROM_TRACE_RING_SIZE
+#define EEPROM_TRACE_RING_SIZE          (64u)
+#endif
+
+/* Phase of a record, in bits 8 to 15 of eeprom_trace_record_t.info. */
+#define EEPROM_TRACE_BEGIN              (0u)
+#define EEPROM_TRACE_END                (1u)
+#define EEPROM_TRACE_POINT              (2u)
+
+#if (EEPROM_TRACE_NONE != EEPROM_TRACE)
+/* Start of an operation; arg is its logical or flash address. */
+#define EEPROM_TRACE_BEGIN_OP(event, addr, size) \
+    eeprom_trace_emit((event), EEPROM_TRACE_BEGIN, (uint32_t) (size), (uint32_t) (addr))
+/* End of an operation; arg is its status. */
+#define EEPROM_TRACE_END_OP(event, status) \
+    eeprom_trace_emit((event), EEPROM_TRACE_END, 0u, (uint32_t) (status))
+/* Single event, such as a fallback to the redundant copy. */
+#define EEPROM_TRACE_EVENT(event, arg) \
+    eeprom_trace_emit((event), EEPROM_TRACE_POINT, 0u, (uint32_t) (arg))
+#else
+#define EEPROM_TRACE_BEGIN_OP(event, addr, size)    do { } while(0)
+#define EEPROM_TRACE_END_OP(event, status)          do { } while(0)
+#define EEPROM_TRACE_EVENT(event, arg)              do { } while(0)
+#endif
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef enum
+{
+    EEPROM_TRACE_INIT,
+    EEPROM_TRACE_READ,
+    EEPROM_TRACE_WRITE,
+    EEPROM_TRACE_ERASE,
+    EEPROM_TRACE_REDUNDANT_COPY,
+    EEPROM_TRACE_EVENT_COUNT,
+} eeprom_trace_event_t;
+
+typedef struct
+{
+    /* DWT cycle counter at the trace point. */
+    uint32_t cycles;
+    /* Event in bits 0 to 7, phase in bits 8 to 15, size in bits 16 to 31. */
+    uint32_t info;
+    /* Address at the beginning, status at the end. */
+    uint32_t arg;
+} eeprom_trace_record_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+#if (EEPROM_TRACE_NONE != EEPROM_TRACE)
+void eeprom_trace_init(void);
+void eeprom_trace_emit(eeprom_trace_event_t event, uint32_t phase, uint32_t size, uint32_t arg);
+void eeprom_trace_dump(void);
+#else
+__STATIC_INLINE void eeprom_trace_init(void) { }
+__STATIC_INLINE void eeprom_trace_dump(void) { }
+#endif
+
+#endif /* EEPROM_TRACE_H */
+
+/* [] END OF FILE */
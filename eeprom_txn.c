@@ -0,0 +1,566 @@
+/******************************************************************************
+* File Name: eeprom_txn.c
+*
+* Description: This file contains the transactional batch write. Ranges staged
+*              between eeprom_txn_begin() and eeprom_txn_commit() are written
+*              with one Em_EEPROM write per touched row. If they touch a single
+*              row, that write is atomic by itself: Em_EEPROM writes a new
+*              checksummed row and keeps the old one until it is complete.
+*              Otherwise the ranges are first written to a journal record in a
+*              separate Em_EEPROM instance, which eeprom_txn_init() applies again
+*              if the supply was lost before the commit finished.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include "cy_pdl.h"
+#include "eeprom_area.h"
+#include "eeprom_crc.h"
+#include "eeprom_io.h"
+#include "eeprom_status.h"
+#include "eeprom_txn.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* "TX" */
+#define TXN_MAGIC                       (0x5854u)
+
+/* Journal record states. The erased journal reads as zero. */
+#define TXN_STATE_PENDING               (0x01u)
+#define TXN_STATE_APPLIED               (0x02u)
+
+/* Largest logical address a range can start at. */
+#define TXN_MAX_ADDRESS                 (0xFFFFu)
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+/* Header of the journal record. The CRC covers the record from count to the
+ * end of the ranges, so that the state can be updated on its own.
+ */
+typedef __PACKED_STRUCT
+{
+    uint32_t crc;
+    uint8_t state;
+    uint8_t count;
+    uint16_t magic;
+    uint16_t sequence;
+    uint16_t length;
+} txn_header_t;
+
+_Static_assert(sizeof(txn_header_t) == EEPROM_TXN_HEADER_SIZE, "journal header size");
+
+#define TXN_CRC_OFFSET                  (offsetof(txn_header_t, count))
+#define TXN_STATE_OFFSET                (offsetof(txn_header_t, state))
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t txn_entry(const eeprom_txn_t *txn, uint32_t offset,
+                          uint32_t *addr, uint32_t *size, const uint8_t **data);
+static bool txn_is_atomic(const eeprom_txn_t *txn);
+static cy_en_em_eeprom_status_t txn_apply(eeprom_txn_t *txn);
+static cy_en_em_eeprom_status_t txn_journal(eeprom_txn_t *txn);
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Logical data of one row, assembled by txn_apply(). */
+static uint8_t txn_span[EEPROM_TXN_RECORD_SIZE];
+
+
+/*******************************************************************************
+* Function Name: eeprom_txn_init
+********************************************************************************
+*
+* Summary:
+* Initializes a transaction instance and completes a transaction that was
+* journaled but not completely applied before the last reset.
+*
+* Parameters:
+* eeprom_txn_t *txn: transaction instance.
+* cy_stc_eeprom_context_t *context: initialized Em_EEPROM instance the
+*  transactions write to.
+* cy_stc_eeprom_context_t *journal: initialized Em_EEPROM instance holding
+*  the journal.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_txn_init(eeprom_txn_t *txn, cy_stc_eeprom_context_t *context,
+                                         cy_stc_eeprom_context_t *journal)
+{
+    cy_en_em_eeprom_status_t status;
+    txn_header_t header;
+
+    if((NULL == txn) || (NULL == context) || (NULL == journal) ||
+       (journal->eepromSize < EEPROM_TXN_RECORD_SIZE) || (0u != journal->simpleMode))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    memset(txn, 0, sizeof(*txn));
+    txn->context = context;
+    txn->journal = journal;
+
+    status = eeprom_io_read(0u, &header, sizeof(header), journal);
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+
+    if((TXN_MAGIC != header.magic) || (header.length > EEPROM_TXN_MAX_DATA) ||
+       (header.count > EEPROM_TXN_MAX_RANGES))
+    {
+        /* Empty journal. */
+        return status;
+    }
+    txn->sequence = header.sequence + 1u;
+
+    if(TXN_STATE_PENDING == header.state)
+    {
+        status = eeprom_status_combine(status, eeprom_io_read(0u, txn->record,
+                                                              EEPROM_TXN_HEADER_SIZE + header.length,
+                                                              journal));
+        if(eeprom_status_failed(status))
+        {
+            return status;
+        }
+
+        /* A record that fails the CRC was never completely written, so the
+         * transaction did not start to apply either.
+         */
+        if(header.crc == eeprom_crc32_update(0u, &txn->record[TXN_CRC_OFFSET],
+                                             (EEPROM_TXN_HEADER_SIZE - TXN_CRC_OFFSET) +
+                                             header.length))
+        {
+            txn->count = header.count;
+            txn->used = header.length;
+            status = eeprom_status_combine(status, txn_apply(txn));
+            if(!eeprom_status_failed(status))
+            {
+                uint8_t state = TXN_STATE_APPLIED;
+
+                status = eeprom_status_combine(status, eeprom_io_write(TXN_STATE_OFFSET, &state,
+                                                                       sizeof(state), journal));
+            }
+            txn->count = 0u;
+            txn->used = 0u;
+        }
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_txn_begin
+********************************************************************************
+*
+* Summary:
+* Starts a transaction.
+*
+* Parameters:
+* eeprom_txn_t *txn: transaction instance.
+*
+* Return: cy_en_em_eeprom_status_t
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_txn_begin(eeprom_txn_t *txn)
+{
+    if((NULL == txn) || (NULL == txn->context) || txn->open)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    txn->open = true;
+    txn->count = 0u;
+    txn->used = 0u;
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_txn_stage
+********************************************************************************
+*
+* Summary:
+* Adds a range to the open transaction. Nothing is written until the commit.
+* Ranges are applied in the order they were staged, so a later range wins
+* where two overlap.
+*
+* Parameters:
+* eeprom_txn_t *txn: transaction instance.
+* uint32_t addr: logical address.
+* const void *data: data, copied into the transaction.
+* uint32_t size: size in bytes.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_BAD_PARAM if no transaction is open, the range is outside
+*  the EEPROM or the transaction is full.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_txn_stage(eeprom_txn_t *txn, uint32_t addr,
+                                          const void *data, uint32_t size)
+{
+    uint8_t *entry;
+
+    if((NULL == txn) || !txn->open || (NULL == data) || (0u == size) ||
+       (addr > TXN_MAX_ADDRESS) || (addr > txn->context->eepromSize) ||
+       (size > (txn->context->eepromSize - addr)) || (txn->count >= EEPROM_TXN_MAX_RANGES) ||
+       ((EEPROM_TXN_ENTRY_HEADER_SIZE + size) > (EEPROM_TXN_MAX_DATA - txn->used)))
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+
+    entry = &txn->record[EEPROM_TXN_HEADER_SIZE + txn->used];
+    entry[0] = (uint8_t) addr;
+    entry[1] = (uint8_t) (addr >> 8u);
+    entry[2] = (uint8_t) size;
+    entry[3] = (uint8_t) (size >> 8u);
+    memcpy(&entry[EEPROM_TXN_ENTRY_HEADER_SIZE], data, size);
+
+    txn->used += EEPROM_TXN_ENTRY_HEADER_SIZE + size;
+    txn->count++;
+    return CY_EM_EEPROM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_txn_commit
+********************************************************************************
+*
+* Summary:
+* Writes all ranges of the open transaction and closes it. Unless the ranges
+* can be written with a single row write, the transaction is journaled first:
+* one write for the journal record, one per touched row and one to mark the
+* record applied.
+*
+* Parameters:
+* eeprom_txn_t *txn: transaction instance.
+*
+* Return: cy_en_em_eeprom_status_t
+*  CY_EM_EEPROM_REDUNDANT_COPY_USED if any of the reads or writes reported it.
+*  After a failure of a journaled transaction, the next eeprom_txn_init()
+*  applies it again.
+*
+*******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_txn_commit(eeprom_txn_t *txn)
+{
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+
+    if((NULL == txn) || !txn->open)
+    {
+        return CY_EM_EEPROM_BAD_PARAM;
+    }
+    txn->open = false;
+
+    if(0u == txn->count)
+    {
+        return CY_EM_EEPROM_SUCCESS;
+    }
+
+    if(!txn_is_atomic(txn))
+    {
+        status = txn_journal(txn);
+    }
+    else
+    {
+        status = txn_apply(txn);
+    }
+
+    txn->count = 0u;
+    txn->used = 0u;
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: eeprom_txn_abort
+********************************************************************************
+*
+* Summary:
+* Drops the ranges of the open transaction and closes it.
+*
+* Parameters:
+* eeprom_txn_t *txn: transaction instance.
+*
+*******************************************************************************/
+void eeprom_txn_abort(eeprom_txn_t *txn)
+{
+    if(NULL != txn)
+    {
+        txn->open = false;
+        txn->count = 0u;
+        txn->used = 0u;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: txn_entry
+********************************************************************************
+*
+* Summary:
+* Decodes the staged range at an offset into the staged data.
+*
+* Return:
+* The offset of the next range.
+*
+*******************************************************************************/
+static uint32_t txn_entry(const eeprom_txn_t *txn, uint32_t offset,
+                          uint32_t *addr, uint32_t *size, const uint8_t **data)
+{
+    const uint8_t *entry = &txn->record[EEPROM_TXN_HEADER_SIZE + offset];
+
+    *addr = (uint32_t) entry[0] | ((uint32_t) entry[1] << 8u);
+    *size = (uint32_t) entry[2] | ((uint32_t) entry[3] << 8u);
+    *data = &entry[EEPROM_TXN_ENTRY_HEADER_SIZE];
+    return offset + EEPROM_TXN_ENTRY_HEADER_SIZE + *size;
+}
+
+
+/*******************************************************************************
+* Function Name: txn_is_atomic
+********************************************************************************
+*
+* Summary:
+* Tells whether the staged ranges can be written with a single row write:
+* they are in the logical data of one Em_EEPROM row, and the span they cover,
+* which txn_apply() writes with one Cy_Em_EEPROM_Write(), fits into the
+* data of one write. Simple mode rewrites rows in place, so it never is.
+*
+*******************************************************************************/
+static bool txn_is_atomic(const eeprom_txn_t *txn)
+{
+    uint32_t row_size = CY_EM_EEPROM_EEPROM_DATA_LEN(0u);
+    uint32_t offset = 0u;
+    uint32_t low = UINT32_MAX;
+    uint32_t high = 0u;
+
+    if(0u != txn->context->simpleMode)
+    {
+        return false;
+    }
+
+    for(uint32_t i = 0u; i < txn->count; i++)
+    {
+        uint32_t addr;
+        uint32_t size;
+        const uint8_t *data;
+
+        offset = txn_entry(txn, offset, &addr, &size, &data);
+        low = (addr < low) ? addr : low;
+        high = ((addr + size) > high) ? (addr + size) : high;
+    }
+
+    return (((low / row_size) == ((high - 1u) / row_size)) &&
+            ((high - low) <= EEPROM_AREA_WRITE_DATA_LEN));
+}
+
+
+/*******************************************************************************
+* Function Name: txn_apply
+********************************************************************************
+*
+* Summary:
+* Writes the staged ranges to the EEPROM, one row at a time in ascending
+* order. The ranges in a row are merged into the current content of the span
+* they cover, which is then written with a single Cy_Em_EEPROM_Write().
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t txn_apply(eeprom_txn_t *txn)
+{
+    uint32_t row_size = CY_EM_EEPROM_EEPROM_DATA_LEN(txn->context->simpleMode);
+    cy_en_em_eeprom_status_t status = CY_EM_EEPROM_SUCCESS;
+    uint32_t row = 0u;
+
+    for(;;)
+    {
+        uint32_t next = UINT32_MAX;
+        uint32_t low = UINT32_MAX;
+        uint32_t high = 0u;
+        uint32_t offset = 0u;
+
+        /* Lowest row at or above row touched by a range, and the span of the
+         * ranges in it.
+         */
+        for(uint32_t i = 0u; i < txn->count; i++)
+        {
+            uint32_t addr;
+            uint32_t size;
+            const uint8_t *data;
+            uint32_t first;
+
+            offset = txn_entry(txn, offset, &addr, &size, &data);
+            if(((addr + size - 1u) / row_size) < row)
+            {
+                continue;
+            }
+            first = ((addr / row_size) > row) ? (addr / row_size) : row;
+            if(first < next)
+            {
+                next = first;
+                low = UINT32_MAX;
+                high = 0u;
+            }
+            if(first == next)
+            {
+                uint32_t start = (addr > (next * row_size)) ? addr : (next * row_size);
+                uint32_t end = ((addr + size) < ((next + 1u) * row_size)) ?
+                               (addr + size) : ((next + 1u) * row_size);
+
+                low = (start < low) ? start : low;
+                high = (end > high) ? end : high;
+            }
+        }
+
+        if(UINT32_MAX == next)
+        {
+            return status;
+        }
+
+        if((high - low) <= sizeof(txn_span))
+        {
+            status = eeprom_status_combine(status, eeprom_io_read(low, txn_span, high - low,
+                                                                  txn->context));
+            if(eeprom_status_failed(status))
+            {
+                return status;
+            }
+        }
+
+        offset = 0u;
+        for(uint32_t i = 0u; i < txn->count; i++)
+        {
+            uint32_t addr;
+            uint32_t size;
+            const uint8_t *data;
+            uint32_t start;
+            uint32_t end;
+
+            offset = txn_entry(txn, offset, &addr, &size, &data);
+            start = (addr > low) ? addr : low;
+            end = ((addr + size) < high) ? (addr + size) : high;
+            if(start >= end)
+            {
+                continue;
+            }
+
+            if((high - low) <= sizeof(txn_span))
+            {
+                memcpy(&txn_span[start - low], &data[start - addr], end - start);
+            }
+            else
+            {
+                /* Only possible in simple mode, whose rows hold more logical
+                 * data than the span buffer. Write the ranges one by one.
+                 */
+                status = eeprom_status_combine(status, eeprom_io_write(start, &data[start - addr],
+                                                                       end - start, txn->context));
+            }
+        }
+
+        if((high - low) <= sizeof(txn_span))
+        {
+            status = eeprom_status_combine(status, eeprom_io_write(low, txn_span, high - low,
+                                                                   txn->context));
+        }
+        if(eeprom_status_failed(status))
+        {
+            return status;
+        }
+
+        row = next + 1u;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: txn_journal
+********************************************************************************
+*
+* Summary:
+* Writes the journal record, applies the ranges and marks the record
+* applied. A power loss before the mark leaves a pending record, which
+* eeprom_txn_init() applies again; applying it twice has the same result.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t txn_journal(eeprom_txn_t *txn)
+{
+    cy_en_em_eeprom_status_t status;
+    uint8_t state = TXN_STATE_APPLIED;
+    txn_header_t header =
+    {
+        .state = TXN_STATE_PENDING,
+        .count = txn->count,
+        .magic = TXN_MAGIC,
+        .sequence = txn->sequence,
+        .length = (uint16_t) txn->used,
+    };
+
+    memcpy(txn->record, &header, sizeof(header));
+    header.crc = eeprom_crc32_update(0u, &txn->record[TXN_CRC_OFFSET],
+                                     (EEPROM_TXN_HEADER_SIZE - TXN_CRC_OFFSET) + txn->used);
+    memcpy(txn->record, &header, sizeof(header));
+    txn->sequence++;
+
+    status = eeprom_io_write(0u, txn->record, EEPROM_TXN_HEADER_SIZE + txn->used,
+                             txn->journal);
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+
+    status = eeprom_status_combine(status, txn_apply(txn));
+    if(eeprom_status_failed(status))
+    {
+        return status;
+    }
+
+    return eeprom_status_combine(status, eeprom_io_write(TXN_STATE_OFFSET, &state, sizeof(state),
+                                                         txn->journal));
+}
+
+
+/* [] END OF FILE */
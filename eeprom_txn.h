@@ -0,0 +1,107 @@
+/******************************************************************************
+* File Name: eeprom_txn.h
+*
+* Description: This file contains the interface of the transactional batch
+*              write. A transaction collects several logical ranges and commits
+*              them atomically, with one Em_EEPROM write per touched row.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef EEPROM_TXN_H
+#define EEPROM_TXN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_em_eeprom.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Size of the journal record, the logical data of one Em_EEPROM row of the
+ * journal. Its CRC tells a record whose write was cut from a complete one.
+ */
+#define EEPROM_TXN_RECORD_SIZE          CY_EM_EEPROM_EEPROM_DATA_LEN(0u)
+
+/* Size of the record header and of the header of each staged range. */
+#define EEPROM_TXN_HEADER_SIZE          (12u)
+#define EEPROM_TXN_ENTRY_HEADER_SIZE    (4u)
+
+/* Number of ranges in one transaction. */
+#ifndef EEPROM_TXN_MAX_RANGES
+#define EEPROM_TXN_MAX_RANGES           (8u)
+#endif
+
+/* Staged data of one transaction, including the range headers. */
+#define EEPROM_TXN_MAX_DATA             (EEPROM_TXN_RECORD_SIZE - EEPROM_TXN_HEADER_SIZE)
+
+
+/*******************************************************************************
+ * Data structures
+ ******************************************************************************/
+typedef struct
+{
+    cy_stc_eeprom_context_t *context;
+    /* Em_EEPROM instance holding the journal, at least EEPROM_TXN_RECORD_SIZE
+     * bytes, without simple mode.
+     */
+    cy_stc_eeprom_context_t *journal;
+    uint16_t sequence;
+    uint8_t count;
+    bool open;
+    uint32_t used;
+    /* Journal record: header followed by the staged ranges, each an
+     * address, a size and the data.
+     */
+    uint8_t record[EEPROM_TXN_RECORD_SIZE];
+} eeprom_txn_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+cy_en_em_eeprom_status_t eeprom_txn_init(eeprom_txn_t *txn, cy_stc_eeprom_context_t *context,
+                                         cy_stc_eeprom_context_t *journal);
+cy_en_em_eeprom_status_t eeprom_txn_begin(eeprom_txn_t *txn);
+cy_en_em_eeprom_status_t eeprom_txn_stage(eeprom_txn_t *txn, uint32_t addr,
+                                          const void *data, uint32_t size);
+cy_en_em_eeprom_status_t eeprom_txn_commit(eeprom_txn_t *txn);
+void eeprom_txn_abort(eeprom_txn_t *txn);
+
+#endif /* EEPROM_TXN_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,596 @@
+/******************************************************************************
+* File Name: eeprom_sim.c
+*
+* Description: This file contains the driver of the host simulator. It runs
+*              main() of the example once per simulated power cycle against the
+*              RAM flash model, checks that the reset counter never goes back,
+*              and reports the fault, wear and throughput statistics. It
+*              also generates the preformatted EEPROM image of the example.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "sim.h"
+#include "eeprom_counter.h"
+#include "eeprom_layout.h"
+#include "eeprom_stats.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define SIM_DEFAULT_CYCLES              (100000u)
+#define SIM_DEFAULT_SEED                (1u)
+#define SIM_COUNTER_MODULO              (100)
+
+/* Offsets in eeprom_read_data, which points to the EEPROM content read back
+ * at the end of main().
+ */
+#define SIM_BANNER_OFFSET               EEPROM_FIELD_OFFSET(banner)
+#define SIM_COUNTER_OFFSET              EEPROM_FIELD_OFFSET(reset_count)
+
+/* Number of counter errors printed before the rest are only counted. */
+#define SIM_MAX_REPORTED_ERRORS         (10u)
+
+/* Bytes per line of the generated image. */
+#define SIM_IMAGE_LINE_BYTES            (16u)
+
+/* Number of scenarios selectable with -x. */
+#define SIM_SCENARIO_COUNT              (sizeof(sim_scenarios) / sizeof(sim_scenarios[0]))
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+typedef struct
+{
+    uint64_t completed;
+    uint64_t power_losses;
+    uint64_t halts;
+    uint64_t counter_errors;
+    /* Completed boots not checked because of a bit flip in the rows of the
+     * reset counter, which keep no redundant copy.
+     */
+    uint64_t counter_resyncs;
+    /* Completed boots whose persisted write count went down. */
+    uint64_t telemetry_errors;
+} sim_results_t;
+
+/* Scenario run instead of the example. */
+typedef struct
+{
+    const char *name;
+    int (*run)(uint64_t cycles, uint32_t seed);
+} sim_scenario_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+/* main() of the example, renamed by the host build. */
+int app_main(void);
+extern const uint8_t *eeprom_read_data;
+extern eeprom_counter_t eeprom_reset_counter;
+extern cy_stc_eeprom_config_t Em_EEPROM_config;
+#if defined(EEPROM_PARTITIONS)
+extern eeprom_stats_t Em_EEPROM_stats;
+#endif
+
+static const sim_scenario_t sim_scenarios[] =
+{
+    { "log",     sim_log_run },
+    { "poll",    sim_poll_run },
+    { "counter", sim_counter_run },
+    { "kv",      sim_kv_run },
+    { "txn",     sim_txn_run },
+    { "stream",  sim_stream_run },
+    { "ipc",     sim_ipc_run },
+    { "journal", sim_journal_run },
+};
+
+static const sim_scenario_t *find_scenario(const char *name);
+static int64_t read_counter(void);
+static uint32_t counter_bit_flips(void);
+static void print_wear(const char *csv_path);
+static int write_image(const char *path);
+static void usage(const char *name);
+
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+*
+* Summary:
+* Parses the options and runs the power-cycle loop.
+*
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    sim_flash_config_t config =
+    {
+        .row_write_us = SIM_FLASH_ROW_WRITE_US,
+        .row_erase_us = SIM_FLASH_ROW_ERASE_US,
+        .row_program_us = SIM_FLASH_ROW_PROGRAM_US,
+        .subsector_erase_us = SIM_FLASH_SUBSECTOR_ERASE_US,
+        .sector_erase_us = SIM_FLASH_SECTOR_ERASE_US,
+    };
+    uint64_t cycles = SIM_DEFAULT_CYCLES;
+    uint32_t seed = SIM_DEFAULT_SEED;
+    const char *csv_path = NULL;
+    const char *image_path = NULL;
+    sim_results_t results = {0};
+    sim_flash_stats_t stats;
+    bool power_cycle = true;
+    const sim_scenario_t *scenario = NULL;
+    /* Counter seen at the last successful boot, -1 right after a format. */
+    int64_t last_count = -1;
+    /* Boots since then that may have committed an increment. */
+    int64_t uncommitted = 0;
+    /* Bit flips in the rows of the reset counter at that boot, and the
+     * completed boots after a new flip that are not checked.
+     */
+    uint32_t last_flips = 0u;
+    uint32_t unchecked = 0u;
+#if defined(EEPROM_PARTITIONS)
+    /* Write count of the last successful boot, persisted in the COLD
+     * partition, so it only grows until a format.
+     */
+    uint32_t last_writes = 0u;
+#endif
+    struct timespec start;
+    struct timespec stop;
+    double seconds;
+    int option;
+
+    while(-1 != (option = getopt(argc, argv, "n:p:f:s:w:i:lx:v")))
+    {
+        switch(option)
+        {
+            case 'n': cycles = strtoull(optarg, NULL, 0); break;
+            case 'p': config.power_loss_ppm = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'f': config.bit_flip_ppm = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 's': seed = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'w': csv_path = optarg; break;
+            case 'i': image_path = optarg; break;
+            case 'l': scenario = &sim_scenarios[0]; break;
+            case 'x':
+                scenario = find_scenario(optarg);
+                if(NULL == scenario)
+                {
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'v': sim_board_set_verbose(true); break;
+            default: usage(argv[0]); return EXIT_FAILURE;
+        }
+    }
+
+    sim_flash_init(&config, seed);
+
+    if(NULL != image_path)
+    {
+        uint32_t status;
+
+        /* The first boot on an erased device formats the EEPROM. Faults are
+         * not injected, whatever the options say.
+         */
+        config.power_loss_ppm = 0u;
+        config.bit_flip_ppm = 0u;
+        sim_flash_init(&config, seed);
+        sim_board_reset(true);
+        if(SIM_STOP_NONE != sim_boot(app_main, &status))
+        {
+            fprintf(stderr, "first boot halted with status 0x%lx\n", (unsigned long) status);
+            return EXIT_FAILURE;
+        }
+        return write_image(image_path);
+    }
+
+    if(NULL != scenario)
+    {
+        /* The scenarios keep no redundant copy, so a flipped bit loses data
+         * by design. Only the supply is cut.
+         */
+        config.bit_flip_ppm = 0u;
+        sim_flash_init(&config, seed);
+        return scenario->run(cycles, seed);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for(uint64_t cycle = 0u; cycle < cycles; cycle++)
+    {
+        uint32_t status;
+        sim_stop_t reason;
+
+        /* A completed boot is followed by a reset, which keeps the backup
+         * registers. A power loss or a fresh image clears them.
+         */
+        sim_board_reset(power_cycle);
+        reason = sim_boot(app_main, &status);
+        power_cycle = (SIM_STOP_NONE != reason);
+
+        switch(reason)
+        {
+            case SIM_STOP_NONE:
+            {
+                int64_t count = read_counter();
+                int64_t lowest = last_count + 1;
+                int64_t highest = lowest + uncommitted;
+                uint32_t flips = counter_bit_flips();
+
+                if(flips != last_flips)
+                {
+                    /* The boot that took the flip still counts in RAM; the
+                     * flip shows in the value restored by the next one.
+                     */
+                    last_flips = flips;
+                    unchecked = 2u;
+                }
+
+                if((0u != unchecked) && (count >= 0))
+                {
+                    /* Continue from the value the flip left. */
+                    results.counter_resyncs++;
+                    unchecked--;
+                }
+                else if((count < lowest) || (count > highest))
+                {
+                    if(results.counter_errors < SIM_MAX_REPORTED_ERRORS)
+                    {
+                        printf("cycle %llu: counter %lld, expected %lld..%lld\n",
+                               (unsigned long long) cycle, (long long) count,
+                               (long long) lowest, (long long) highest);
+                    }
+                    results.counter_errors++;
+                }
+                last_count = (count >= 0) ? count : last_count;
+                uncommitted = 0;
+#if defined(EEPROM_PARTITIONS)
+                if(eeprom_stats_get(&Em_EEPROM_stats)->writes < last_writes)
+                {
+                    if(results.telemetry_errors < SIM_MAX_REPORTED_ERRORS)
+                    {
+                        printf("cycle %llu: %lu writes counted, %lu at the last boot\n",
+                               (unsigned long long) cycle,
+                               (unsigned long) eeprom_stats_get(&Em_EEPROM_stats)->writes,
+                               (unsigned long) last_writes);
+                    }
+                    results.telemetry_errors++;
+                }
+                last_writes = eeprom_stats_get(&Em_EEPROM_stats)->writes;
+#endif
+                results.completed++;
+                break;
+            }
+
+            case SIM_STOP_POWER_LOSS:
+                uncommitted++;
+                results.power_losses++;
+                break;
+
+            default:
+                /* Em_EEPROM reported an error it could not recover from. Put
+                 * a fresh image on the device, as a field return would get.
+                 */
+                if(results.halts < SIM_MAX_REPORTED_ERRORS)
+                {
+                    printf("cycle %llu: halted with status 0x%lx\n",
+                           (unsigned long long) cycle, (unsigned long) status);
+                }
+                results.halts++;
+                sim_flash_format();
+                last_count = -1;
+                uncommitted = 0;
+#if defined(EEPROM_PARTITIONS)
+                last_writes = 0u;
+#endif
+                break;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    seconds = (double) (stop.tv_sec - start.tv_sec) +
+              ((double) (stop.tv_nsec - start.tv_nsec) / 1e9);
+    sim_flash_get_stats(&stats);
+
+    printf("boots:             %llu (%llu completed, %llu power losses, %llu halts)\n",
+           (unsigned long long) cycles, (unsigned long long) results.completed,
+           (unsigned long long) results.power_losses, (unsigned long long) results.halts);
+    printf("counter errors:    %llu (%llu boots not checked after a bit flip in the counter rows)\n",
+           (unsigned long long) results.counter_errors,
+           (unsigned long long) results.counter_resyncs);
+#if defined(EEPROM_PARTITIONS)
+    printf("telemetry errors:  %llu\n", (unsigned long long) results.telemetry_errors);
+#endif
+    printf("redundant copy:    %lu uses\n", (unsigned long) sim_board_redundant_copy_uses());
+    printf("bit flips:         %llu\n", (unsigned long long) stats.bit_flips);
+    printf("flash operations:  %llu erases, %llu programs\n",
+           (unsigned long long) stats.erases, (unsigned long long) stats.programs);
+    printf("flash busy time:   %.3f s simulated, %.1f ms per boot\n",
+           (double) stats.busy_us / 1e6,
+           (0u != cycles) ? ((double) stats.busy_us / 1e3 / (double) cycles) : 0.0);
+    printf("host throughput:   %.0f boots/s over %.3f s\n",
+           (seconds > 0.0) ? ((double) cycles / seconds) : 0.0, seconds);
+    print_wear(csv_path);
+
+    return (((0u == results.counter_errors) && (0u == results.telemetry_errors)) ?
+            EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*******************************************************************************
+* Function Name: find_scenario
+********************************************************************************
+*
+* Summary:
+* Looks up a scenario by name.
+*
+* Return:
+* The scenario, or NULL if there is none of that name.
+*
+*******************************************************************************/
+static const sim_scenario_t *find_scenario(const char *name)
+{
+    for(uint32_t i = 0u; i < SIM_SCENARIO_COUNT; i++)
+    {
+        if(0 == strcmp(name, sim_scenarios[i].name))
+        {
+            return &sim_scenarios[i];
+        }
+    }
+    return NULL;
+}
+
+
+/*******************************************************************************
+* Function Name: read_counter
+********************************************************************************
+*
+* Summary:
+* Returns the reset counter of main(), after checking that the two ASCII
+* digits read back from the EEPROM show it.
+*
+* Return:
+* The counter, or -1 if the content is not valid.
+*
+*******************************************************************************/
+static int64_t read_counter(void)
+{
+    int64_t count = (int64_t) eeprom_counter_get(&eeprom_reset_counter);
+    uint8_t tens = eeprom_read_data[SIM_COUNTER_OFFSET];
+    uint8_t ones = eeprom_read_data[SIM_COUNTER_OFFSET + 1u];
+
+    if(('P' != eeprom_read_data[SIM_BANNER_OFFSET]) ||
+       (tens < '0') || (tens > '9') || (ones < '0') || (ones > '9'))
+    {
+        return -1;
+    }
+    if((((tens - '0') * 10) + (ones - '0')) != (count % SIM_COUNTER_MODULO))
+    {
+        return -1;
+    }
+    return count;
+}
+
+
+/*******************************************************************************
+* Function Name: counter_bit_flips
+********************************************************************************
+*
+* Summary:
+* Returns how many bits the flash model has flipped in the rows of the reset
+* counter.
+*
+*******************************************************************************/
+static uint32_t counter_bit_flips(void)
+{
+    uint32_t first = (eeprom_reset_counter.area - sim_flash_row_address(0u)) / CY_FLASH_SIZEOF_ROW;
+    uint32_t flips = 0u;
+
+    for(uint32_t row = first; row < (first + (EEPROM_COUNTER_AREA_SIZE / CY_FLASH_SIZEOF_ROW)); row++)
+    {
+        flips += sim_flash_row_bit_flips(row);
+    }
+    return flips;
+}
+
+
+/*******************************************************************************
+* Function Name: print_wear
+********************************************************************************
+*
+* Summary:
+* Prints the erase count distribution over the rows that were written and
+* optionally the per-row counts as CSV.
+*
+* Parameters:
+* const char *csv_path: file for the per-row counts, or NULL.
+*
+*******************************************************************************/
+static void print_wear(const char *csv_path)
+{
+    FILE *csv = NULL;
+    uint32_t used = 0u;
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0u;
+    uint64_t total = 0u;
+
+    if(NULL != csv_path)
+    {
+        csv = fopen(csv_path, "w");
+        if(NULL == csv)
+        {
+            perror(csv_path);
+        }
+        else
+        {
+            fprintf(csv, "row,address,erases,programs\n");
+        }
+    }
+
+    for(uint32_t row = 0u; row < sim_flash_num_rows(); row++)
+    {
+        uint32_t erases = sim_flash_row_erases(row);
+        uint32_t programs = sim_flash_row_programs(row);
+
+        if(NULL != csv)
+        {
+            fprintf(csv, "%lu,0x%08lx,%lu,%lu\n", (unsigned long) row,
+                    (unsigned long) sim_flash_row_address(row),
+                    (unsigned long) erases, (unsigned long) programs);
+        }
+        if(0u != programs)
+        {
+            used++;
+            total += erases;
+            min = (erases < min) ? erases : min;
+            max = (erases > max) ? erases : max;
+        }
+    }
+
+    if(0u != used)
+    {
+        printf("row erases:        %lu rows written, min %lu, mean %.1f, max %lu\n",
+               (unsigned long) used, (unsigned long) min,
+               (double) total / (double) used, (unsigned long) max);
+    }
+
+    if(NULL != csv)
+    {
+        fclose(csv);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: write_image
+********************************************************************************
+*
+* Summary:
+* Writes the Em_EEPROM area of the example as the initializer of
+* eeprom_storage for PREFORMATTED_EEPROM. The row format of Em_EEPROM holds no
+* flash addresses, so the area can be placed anywhere on the device.
+*
+* Parameters:
+* const char *path: header file to write.
+*
+* Return:
+* EXIT_SUCCESS, or EXIT_FAILURE if the file cannot be written.
+*
+*******************************************************************************/
+static int write_image(const char *path)
+{
+    const uint8_t *area = (const uint8_t *) Em_EEPROM_config.userFlashStartAddr;
+    uint32_t size = CY_EM_EEPROM_GET_PHYSICAL_SIZE(Em_EEPROM_config.eepromSize,
+                                                   Em_EEPROM_config.simpleMode,
+                                                   Em_EEPROM_config.wearLevelingFactor,
+                                                   Em_EEPROM_config.redundantCopy);
+    FILE *file = fopen(path, "w");
+
+    if(NULL == file)
+    {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(file,
+            "/* Em_EEPROM area of the example formatted with the initial data,\n"
+            " * generated by the host simulator (eeprom_sim -i). Generate it again\n"
+            " * whenever the EEPROM configuration or the initial data change.\n"
+            " * eepromSize %lu, wearLevelingFactor %lu, redundantCopy %u, simpleMode %u\n"
+            " */\n"
+            "#ifndef EEPROM_IMAGE_H\n"
+            "#define EEPROM_IMAGE_H\n\n"
+            "#define EEPROM_IMAGE_SIZE       (%luu)\n"
+            "#define EEPROM_IMAGE \\\n"
+            "{ \\\n",
+            (unsigned long) Em_EEPROM_config.eepromSize,
+            (unsigned long) Em_EEPROM_config.wearLevelingFactor,
+            (unsigned) Em_EEPROM_config.redundantCopy,
+            (unsigned) Em_EEPROM_config.simpleMode,
+            (unsigned long) size);
+
+    for(uint32_t i = 0u; i < size; i++)
+    {
+        fprintf(file, "%s0x%02X,%s", (0u == (i % SIM_IMAGE_LINE_BYTES)) ? "    " : " ",
+                area[i], ((SIM_IMAGE_LINE_BYTES - 1u) == (i % SIM_IMAGE_LINE_BYTES)) ? " \\\n" : "");
+    }
+    if(0u != (size % SIM_IMAGE_LINE_BYTES))
+    {
+        fprintf(file, " \\\n");
+    }
+
+    fprintf(file, "}\n\n#endif /* EEPROM_IMAGE_H */\n");
+
+    if(0 != fclose(file))
+    {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    printf("wrote %lu bytes of EEPROM image to %s\n", (unsigned long) size, path);
+
+    return EXIT_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: usage
+********************************************************************************
+*
+* Summary:
+* Prints the command line options.
+*
+*******************************************************************************/
+static void usage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [-n boots] [-p power_loss_ppm] [-f bit_flip_ppm] [-s seed]\n"
+            "          [-w wear.csv] [-i eeprom_image.h] [-l | -x scenario] [-v]\n"
+            "scenarios:", name);
+    for(uint32_t i = 0u; i < SIM_SCENARIO_COUNT; i++)
+    {
+        fprintf(stderr, " %s", sim_scenarios[i].name);
+    }
+    fprintf(stderr, "\n");
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,2 @@
+/* Host simulator build: see sim_pdl.h */
+#include "sim_pdl.h"
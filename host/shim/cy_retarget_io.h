@@ -0,0 +1,5 @@
+/* Host simulator build: see sim_pdl.h. Application output is captured by the
+ * simulator.
+ */
+#include "sim_pdl.h"
+#define printf sim_printf
@@ -0,0 +1,357 @@
+/******************************************************************************
+* File Name: sim_pdl.h
+*
+* Description: This file replaces the PDL, HAL, BSP and retarget-io headers in
+*              the host (x86 Linux) simulator build. It declares only what the
+*              example and the Em_EEPROM middleware use; flash operations are
+*              implemented by the RAM-backed flash model in sim_flash.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef SIM_PDL_H
+#define SIM_PDL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+
+/*******************************************************************************
+ * Device
+ ******************************************************************************/
+/* The simulated device has a dedicated Em_EEPROM region like the default
+ * target. Objects placed with CY_SECTION() all go to the simulated flash.
+ */
+#define CY_EM_EEPROM_SIZE               (0x8000u)
+#define CY_IP_M4CPUSS                   (1u)
+#define CY_IP_MXS40SRSS                 (1u)
+#define SRSS_BACKUP_NUM_BREG            (16u)
+
+#define CY_SECTION(name)                __attribute__((section("sim_flash")))
+#define CY_NOINIT
+#define CY_ALIGN(align)                 __attribute__((aligned(align)))
+#define CY_UNUSED_PARAMETER(x)          ((void) (x))
+#define CY_ASSERT(x)                    do { if(!(x)) { sim_halt(0xFFFFFFFFu); } } while(0)
+#define CY_ASSERT_L1(x)                 CY_ASSERT(x)
+#define CY_ASSERT_L2(x)                 CY_ASSERT(x)
+#define CY_ASSERT_L3(x)                 CY_ASSERT(x)
+#define CY_MISRA_DEVIATE_LINE(...)
+#define CY_MISRA_DEVIATE_BLOCK_START(...)
+#define CY_MISRA_BLOCK_END(...)
+#define CY_MISRA_FP_LINE(...)
+
+#define __STATIC_INLINE                 static inline
+#define __PACKED_STRUCT                 struct __attribute__((packed))
+#define __enable_irq()                  do { } while(0)
+#define __disable_irq()                 do { } while(0)
+#define __DMB()                         do { } while(0)
+#define __DSB()                         do { } while(0)
+#define __ISB()                         do { } while(0)
+#define __NOP()                         do { } while(0)
+#define __WFI()                         do { } while(0)
+
+typedef uint32_t cy_rslt_t;
+#define CY_RSLT_SUCCESS                 ((cy_rslt_t) 0u)
+
+extern uint32_t SystemCoreClock;
+
+
+/*******************************************************************************
+ * Core debug and trace
+ ******************************************************************************/
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    union
+    {
+        volatile uint8_t u8;
+        volatile uint16_t u16;
+        volatile uint32_t u32;
+    } PORT[32u];
+    volatile uint32_t TER;
+    volatile uint32_t TCR;
+} ITM_Type;
+
+extern CoreDebug_Type sim_core_debug;
+extern DWT_Type sim_dwt;
+extern ITM_Type sim_itm;
+#define CoreDebug                       (&sim_core_debug)
+#define DWT                             (&sim_dwt)
+#define ITM                             (&sim_itm)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1uL << 24u)
+#define DWT_CTRL_CYCCNTENA_Msk          (1uL)
+#define ITM_TCR_ITMENA_Msk              (1uL)
+
+/* Backup registers keep their content across simulated resets and are
+ * cleared by a simulated power loss.
+ */
+extern volatile uint32_t BACKUP_BREG[SRSS_BACKUP_NUM_BREG];
+
+
+/*******************************************************************************
+ * Interrupts
+ ******************************************************************************/
+typedef int32_t IRQn_Type;
+#define srss_interrupt_IRQn             ((IRQn_Type) 21)
+
+typedef void (*cy_israddress)(void);
+typedef struct
+{
+    IRQn_Type intrSrc;
+    uint32_t intrPriority;
+} cy_stc_sysint_t;
+typedef enum
+{
+    CY_SYSINT_SUCCESS = 0u,
+} cy_en_sysint_status_t;
+
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress handler);
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_SetPendingIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t saved);
+void Cy_SysLib_Delay(uint32_t ms);
+void Cy_SysLib_DelayUs(uint16_t us);
+
+
+/*******************************************************************************
+ * Low-voltage detector
+ ******************************************************************************/
+typedef enum
+{
+    CY_LVD_THRESHOLD_2_8_V = 12u,
+    CY_LVD_THRESHOLD_3_0_V = 14u,
+} cy_en_lvd_tripsel_select_t;
+typedef enum
+{
+    CY_LVD_INTR_FALLING = 2u,
+} cy_en_lvd_intr_config_t;
+
+void Cy_LVD_Enable(void);
+void Cy_LVD_Disable(void);
+void Cy_LVD_SetThreshold(cy_en_lvd_tripsel_select_t threshold);
+void Cy_LVD_SetInterruptConfig(cy_en_lvd_intr_config_t config);
+uint32_t Cy_LVD_GetInterruptStatus(void);
+void Cy_LVD_ClearInterrupt(void);
+void Cy_LVD_SetInterruptMask(void);
+void Cy_LVD_ClearInterruptMask(void);
+
+
+/*******************************************************************************
+ * System power management
+ ******************************************************************************/
+typedef enum
+{
+    CY_SYSPM_SUCCESS = 0u,
+    CY_SYSPM_BAD_PARAM,
+    CY_SYSPM_TIMEOUT,
+    CY_SYSPM_INVALID_STATE,
+    CY_SYSPM_CANCELED,
+    CY_SYSPM_SYSCALL_PENDING,
+    CY_SYSPM_FAIL,
+} cy_en_syspm_status_t;
+typedef enum
+{
+    CY_SYSPM_SLEEP = 0u,
+    CY_SYSPM_DEEPSLEEP,
+    CY_SYSPM_HIBERNATE,
+} cy_en_syspm_callback_type_t;
+typedef enum
+{
+    CY_SYSPM_CHECK_READY = 0x01u,
+    CY_SYSPM_CHECK_FAIL = 0x02u,
+    CY_SYSPM_BEFORE_TRANSITION = 0x04u,
+    CY_SYSPM_AFTER_TRANSITION = 0x08u,
+} cy_en_syspm_callback_mode_t;
+typedef enum
+{
+    CY_SYSPM_WAIT_FOR_INTERRUPT = 0u,
+    CY_SYSPM_WAIT_FOR_EVENT,
+} cy_en_syspm_waitfor_t;
+
+typedef struct
+{
+    void *base;
+    void *context;
+} cy_stc_syspm_callback_params_t;
+
+typedef cy_en_syspm_status_t (*Cy_SysPmCallback)(cy_stc_syspm_callback_params_t *callbackParams,
+                                                 cy_en_syspm_callback_mode_t mode);
+
+typedef struct cy_stc_syspm_callback
+{
+    Cy_SysPmCallback callback;
+    cy_en_syspm_callback_type_t type;
+    uint32_t skipMode;
+    cy_stc_syspm_callback_params_t *callbackParams;
+    struct cy_stc_syspm_callback *prevItm;
+    struct cy_stc_syspm_callback *nextItm;
+    uint8_t order;
+} cy_stc_syspm_callback_t;
+
+/* Deep Sleep runs the registered callbacks and returns at once, as if an
+ * interrupt woke the CPU.
+ */
+bool Cy_SysPm_RegisterCallback(cy_stc_syspm_callback_t *handler);
+bool Cy_SysPm_UnregisterCallback(cy_stc_syspm_callback_t const *handler);
+cy_en_syspm_status_t Cy_SysPm_CpuEnterDeepSleep(cy_en_syspm_waitfor_t waitFor);
+
+
+/*******************************************************************************
+ * Inter-processor communication
+ ******************************************************************************/
+/* The host has one core: locks are always free and release events are
+ * dropped.
+ */
+#define CY_IPC_CHAN_USER                (8u)
+#define CY_IPC_INTR_USER                (8u)
+#define CY_IPC_NO_NOTIFICATION          (0uL)
+
+typedef struct
+{
+    volatile uint32_t ACQUIRE;
+    volatile uint32_t DATA0;
+} IPC_STRUCT_Type;
+typedef struct
+{
+    volatile uint32_t INTR_MASK;
+} IPC_INTR_STRUCT_Type;
+typedef enum
+{
+    CY_IPC_DRV_SUCCESS = 0x00u,
+    CY_IPC_DRV_ERROR = 0x01u,
+} cy_en_ipcdrv_status_t;
+
+IPC_STRUCT_Type *Cy_IPC_Drv_GetIpcBaseAddress(uint32_t ipcIndex);
+IPC_INTR_STRUCT_Type *Cy_IPC_Drv_GetIntrBaseAddr(uint32_t ipcIntrIndex);
+cy_en_ipcdrv_status_t Cy_IPC_Drv_LockAcquire(IPC_STRUCT_Type const *base);
+cy_en_ipcdrv_status_t Cy_IPC_Drv_LockRelease(IPC_STRUCT_Type *base, uint32_t releaseEventIntr);
+void Cy_IPC_Drv_WriteDataValue(IPC_STRUCT_Type *base, uint32_t dataValue);
+uint32_t Cy_IPC_Drv_ReadDataValue(IPC_STRUCT_Type const *base);
+void Cy_IPC_Drv_SetInterruptMask(IPC_INTR_STRUCT_Type *base, uint32_t ipcReleaseMask,
+                                 uint32_t ipcNotifyMask);
+void Cy_IPC_Drv_ClearInterrupt(IPC_INTR_STRUCT_Type *base, uint32_t ipcReleaseMask,
+                               uint32_t ipcNotifyMask);
+
+
+/*******************************************************************************
+ * Flash
+ ******************************************************************************/
+#define CY_FLASH_SIZEOF_ROW             (512u)
+#define CY_FLASH_NUMBER_ROWS            (4096u)
+
+typedef enum
+{
+    CY_FLASH_DRV_SUCCESS = 0x00u,
+    CY_FLASH_DRV_INV_PROT = 0x01u,
+    CY_FLASH_DRV_INVALID_FM_PL = 0x02u,
+    CY_FLASH_DRV_INVALID_FLASH_ADDR = 0x03u,
+    CY_FLASH_DRV_ROW_PROTECTED = 0x04u,
+    CY_FLASH_DRV_IPC_BUSY = 0x05u,
+    CY_FLASH_DRV_INVALID_INPUT_PARAMETERS = 0x06u,
+    CY_FLASH_DRV_PL_ROW_COMP_FA = 0x22u,
+    CY_FLASH_DRV_ERR_UNC = 0xFFu,
+    CY_FLASH_DRV_PROGRESS_NO_ERROR = 0x40u,
+    CY_FLASH_DRV_OPERATION_STARTED = 0x41u,
+    CY_FLASH_DRV_OPCODE_BUSY = 0x42u,
+} cy_en_flashdrv_status_t;
+
+cy_en_flashdrv_status_t Cy_Flash_EraseRow(uint32_t rowAddr);
+cy_en_flashdrv_status_t Cy_Flash_EraseSubsector(uint32_t subSectorAddr);
+cy_en_flashdrv_status_t Cy_Flash_EraseSector(uint32_t sectorAddr);
+cy_en_flashdrv_status_t Cy_Flash_ProgramRow(uint32_t rowAddr, const uint32_t *data);
+cy_en_flashdrv_status_t Cy_Flash_WriteRow(uint32_t rowAddr, const uint32_t *data);
+cy_en_flashdrv_status_t Cy_Flash_StartEraseRow(uint32_t rowAddr);
+cy_en_flashdrv_status_t Cy_Flash_StartProgram(uint32_t rowAddr, const uint32_t *data);
+cy_en_flashdrv_status_t Cy_Flash_StartWrite(uint32_t rowAddr, const uint32_t *data);
+cy_en_flashdrv_status_t Cy_Flash_IsOperationComplete(void);
+
+
+/*******************************************************************************
+ * HAL, BSP and retarget-io
+ ******************************************************************************/
+typedef uint32_t cyhal_gpio_t;
+typedef enum
+{
+    CYHAL_GPIO_DIR_INPUT,
+    CYHAL_GPIO_DIR_OUTPUT,
+} cyhal_gpio_direction_t;
+typedef enum
+{
+    CYHAL_GPIO_DRIVE_NONE,
+    CYHAL_GPIO_DRIVE_STRONG,
+} cyhal_gpio_drive_mode_t;
+
+#define CYBSP_USER_LED                  ((cyhal_gpio_t) 1u)
+#define CYBSP_LED_STATE_OFF             (1u)
+#define CYBSP_DEBUG_UART_TX             ((cyhal_gpio_t) 2u)
+#define CYBSP_DEBUG_UART_RX             ((cyhal_gpio_t) 3u)
+#define CY_RETARGET_IO_BAUDRATE         (115200u)
+
+cy_rslt_t cybsp_init(void);
+cy_rslt_t cy_retarget_io_init(cyhal_gpio_t tx, cyhal_gpio_t rx, uint32_t baudrate);
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                          cyhal_gpio_drive_mode_t drive_mode, bool init_val);
+void cyhal_gpio_write(cyhal_gpio_t pin, bool value);
+
+
+/*******************************************************************************
+ * Simulator hooks
+ ******************************************************************************/
+/* Called instead of the infinite loop of handle_error(). Does not return. */
+void sim_halt(uint32_t status);
+
+/* Console output of the application, captured by the simulator. */
+int sim_printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+#endif /* SIM_PDL_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,158 @@
+/******************************************************************************
+* File Name: sim.h
+*
+* Description: This file contains the interface of the host simulator: the
+*              RAM-backed flash model, the board model and the power-cycle
+*              sequencing used by the driver in eeprom_sim.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <setjmp.h>
+#include "sim_pdl.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Default flash timings in microseconds. These are the PSoC 6 datasheet
+ * values for the LP mode: row write (erase and program), row erase, row
+ * program, subsector (8 rows) erase and sector (512 rows) erase.
+ */
+#define SIM_FLASH_ROW_WRITE_US          (16000u)
+#define SIM_FLASH_ROW_ERASE_US          (11000u)
+#define SIM_FLASH_ROW_PROGRAM_US        (5000u)
+#define SIM_FLASH_SUBSECTOR_ERASE_US    (15000u)
+#define SIM_FLASH_SECTOR_ERASE_US       (31000u)
+
+/* Clock of the simulated CPU. The cycle counter advances by the flash busy
+ * time at this frequency.
+ */
+#define SIM_CORE_CLOCK_HZ               (100000000u)
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+/* Why a simulated boot stopped before main() returned. */
+typedef enum
+{
+    SIM_STOP_NONE,
+    SIM_STOP_POWER_LOSS,
+    SIM_STOP_HALT,
+} sim_stop_t;
+
+typedef struct
+{
+    uint32_t row_write_us;
+    uint32_t row_erase_us;
+    uint32_t row_program_us;
+    uint32_t subsector_erase_us;
+    uint32_t sector_erase_us;
+    /* Probability in parts per million that the supply is lost during a
+     * flash operation. The row being written is left partially programmed.
+     */
+    uint32_t power_loss_ppm;
+    /* Probability in parts per million that a programmed row has one bit
+     * flipped.
+     */
+    uint32_t bit_flip_ppm;
+} sim_flash_config_t;
+
+/* Cumulative counters of the flash model. */
+typedef struct
+{
+    uint64_t erases;
+    uint64_t programs;
+    uint64_t busy_us;
+    uint64_t power_losses;
+    uint64_t bit_flips;
+} sim_flash_stats_t;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+void sim_flash_init(const sim_flash_config_t *config, uint32_t seed);
+void sim_flash_format(void);
+void sim_flash_get_stats(sim_flash_stats_t *stats);
+uint32_t sim_flash_num_rows(void);
+uint32_t sim_flash_row_address(uint32_t row);
+uint32_t sim_flash_row_erases(uint32_t row);
+uint32_t sim_flash_row_programs(uint32_t row);
+uint32_t sim_flash_row_bit_flips(uint32_t row);
+uint32_t sim_flash_last_row(void);
+uint32_t sim_flash_fail_programs(uint32_t count);
+void sim_flash_advance_us(uint64_t us);
+
+void sim_board_reset(bool power_loss);
+uint32_t sim_board_redundant_copy_uses(void);
+void sim_board_set_verbose(bool verbose);
+
+/* Abandons the current simulated boot and returns to sim_boot(). */
+void sim_stop(sim_stop_t reason, uint32_t status) __attribute__((noreturn));
+
+/* Runs one simulated boot of the application. Returns SIM_STOP_NONE if
+ * main() returned.
+ */
+sim_stop_t sim_boot(int (*entry)(void), uint32_t *status);
+
+/* Scenarios run instead of the example, selected with -x. Each returns
+ * EXIT_SUCCESS if no check failed.
+ */
+/* Power loss during the writes and the compaction of eeprom_log.c. */
+int sim_log_run(uint64_t cycles, uint32_t seed);
+/* Staleness bound of eeprom_cache_poll(), with power loss during its flushes. */
+int sim_poll_run(uint64_t cycles, uint32_t seed);
+/* Power loss during the increments and the rollovers of eeprom_counter.c. */
+int sim_counter_run(uint64_t cycles, uint32_t seed);
+/* Power loss during the sets and the bank compaction of eeprom_kv.c. */
+int sim_kv_run(uint64_t cycles, uint32_t seed);
+/* Power loss at each step of the journaled commit of eeprom_txn.c. */
+int sim_txn_run(uint64_t cycles, uint32_t seed);
+/* Round trip of multi-row blobs of eeprom_stream.c, with power loss while one is written. */
+int sim_stream_run(uint64_t cycles, uint32_t seed);
+/* Per-ticket status of the queue of eeprom_ipc.c, run as owner and client in one process. */
+int sim_ipc_run(uint64_t cycles, uint32_t seed);
+/* Replay of the brown-out journal of eeprom_journal.c at the lazy initialization. */
+int sim_journal_run(uint64_t cycles, uint32_t seed);
+
+#endif /* SIM_H */
+
+/* [] END OF FILE */
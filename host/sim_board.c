@@ -0,0 +1,589 @@
+/******************************************************************************
+* File Name: sim_board.c
+*
+* Description: This file contains the board model of the host simulator: the
+*              BSP, HAL and retarget-io stubs, the interrupt controller, the
+*              backup registers, the core debug registers and the console that
+*              captures the output of the application.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdarg.h>
+#include <string.h>
+#include "sim.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define SIM_NUM_IRQ                     (64u)
+#define SIM_CONSOLE_LINE_SIZE           (256u)
+#define SIM_NUM_SYSPM_CALLBACKS         (8u)
+
+/* handle_error() prints this when Cy_Em_EEPROM falls back to the redundant
+ * copy.
+ */
+#define SIM_REDUNDANT_COPY_MESSAGE      "Redundant copy"
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+uint32_t SystemCoreClock = SIM_CORE_CLOCK_HZ;
+CoreDebug_Type sim_core_debug;
+DWT_Type sim_dwt;
+ITM_Type sim_itm;
+volatile uint32_t BACKUP_BREG[SRSS_BACKUP_NUM_BREG];
+
+static cy_israddress irq_handler[SIM_NUM_IRQ];
+static bool irq_enabled[SIM_NUM_IRQ];
+static bool irq_pending[SIM_NUM_IRQ];
+static uint32_t critical_nesting;
+static bool in_handler;
+static bool console_verbose;
+static uint32_t redundant_copy_uses;
+static cy_stc_syspm_callback_t *syspm_callback[SIM_NUM_SYSPM_CALLBACKS];
+static uint32_t syspm_callback_count;
+
+static jmp_buf boot_env;
+static sim_stop_t stop_reason;
+static uint32_t stop_status;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static void irq_dispatch(void);
+static cy_en_syspm_status_t syspm_run(uint32_t index, cy_en_syspm_callback_mode_t mode);
+
+
+/*******************************************************************************
+* Function Name: sim_board_reset
+********************************************************************************
+*
+* Summary:
+* Returns the board to the state after a reset. A power loss also clears
+* the backup registers.
+*
+* Parameters:
+* bool power_loss: the reset is a power cycle.
+*
+*******************************************************************************/
+void sim_board_reset(bool power_loss)
+{
+    memset(irq_handler, 0, sizeof(irq_handler));
+    memset(irq_enabled, 0, sizeof(irq_enabled));
+    memset(irq_pending, 0, sizeof(irq_pending));
+    critical_nesting = 0u;
+    in_handler = false;
+    sim_core_debug.DEMCR = 0u;
+    sim_dwt.CTRL = 0u;
+    memset(syspm_callback, 0, sizeof(syspm_callback));
+    syspm_callback_count = 0u;
+
+    if(power_loss)
+    {
+        for(uint32_t i = 0u; i < SRSS_BACKUP_NUM_BREG; i++)
+        {
+            BACKUP_BREG[i] = 0u;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_board_redundant_copy_uses
+********************************************************************************
+*
+* Summary:
+* Returns how many times the application reported that the redundant copy
+* was used.
+*
+*******************************************************************************/
+uint32_t sim_board_redundant_copy_uses(void)
+{
+    return redundant_copy_uses;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_board_set_verbose
+********************************************************************************
+*
+* Summary:
+* Selects whether the console output of the application is printed.
+*
+*******************************************************************************/
+void sim_board_set_verbose(bool verbose)
+{
+    console_verbose = verbose;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_boot
+********************************************************************************
+*
+* Summary:
+* Runs the application until main() returns, the application halts in
+* handle_error() or the flash model injects a power loss.
+*
+* Parameters:
+* int (*entry)(void): main() of the application.
+* uint32_t *status: receives the status passed to handle_error().
+*
+* Return:
+* Why the boot stopped, SIM_STOP_NONE if main() returned.
+*
+*******************************************************************************/
+sim_stop_t sim_boot(int (*entry)(void), uint32_t *status)
+{
+    stop_reason = SIM_STOP_NONE;
+    stop_status = 0u;
+
+    if(0 == setjmp(boot_env))
+    {
+        (void) entry();
+    }
+
+    *status = stop_status;
+    return stop_reason;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_stop
+********************************************************************************
+*
+* Summary:
+* Abandons the current boot. The RAM state of the application is kept; the
+* next boot starts from main() again, the same as a reset.
+*
+*******************************************************************************/
+void sim_stop(sim_stop_t reason, uint32_t status)
+{
+    stop_reason = reason;
+    stop_status = status;
+    longjmp(boot_env, 1);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_halt
+********************************************************************************
+*
+* Summary:
+* Replaces the infinite loop of handle_error().
+*
+*******************************************************************************/
+void sim_halt(uint32_t status)
+{
+    sim_stop(SIM_STOP_HALT, status);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_printf
+********************************************************************************
+*
+* Summary:
+* Console of the application. Output is printed only in verbose mode.
+*
+*******************************************************************************/
+int sim_printf(const char *format, ...)
+{
+    char line[SIM_CONSOLE_LINE_SIZE];
+    va_list args;
+    int length;
+
+    va_start(args, format);
+    length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+
+    if(NULL != strstr(line, SIM_REDUNDANT_COPY_MESSAGE))
+    {
+        redundant_copy_uses++;
+    }
+    if(console_verbose)
+    {
+        fputs(line, stdout);
+    }
+    return length;
+}
+
+
+/*******************************************************************************
+ * BSP, HAL and retarget-io
+ ******************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_retarget_io_init(cyhal_gpio_t tx, cyhal_gpio_t rx, uint32_t baudrate)
+{
+    CY_UNUSED_PARAMETER(tx);
+    CY_UNUSED_PARAMETER(rx);
+    CY_UNUSED_PARAMETER(baudrate);
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                          cyhal_gpio_drive_mode_t drive_mode, bool init_val)
+{
+    CY_UNUSED_PARAMETER(pin);
+    CY_UNUSED_PARAMETER(direction);
+    CY_UNUSED_PARAMETER(drive_mode);
+    CY_UNUSED_PARAMETER(init_val);
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_gpio_write(cyhal_gpio_t pin, bool value)
+{
+    CY_UNUSED_PARAMETER(pin);
+    CY_UNUSED_PARAMETER(value);
+}
+
+
+/*******************************************************************************
+ * Interrupts and system library
+ ******************************************************************************/
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress handler)
+{
+    if((uint32_t) config->intrSrc < SIM_NUM_IRQ)
+    {
+        irq_handler[config->intrSrc] = handler;
+    }
+    return CY_SYSINT_SUCCESS;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    irq_enabled[irq] = true;
+    irq_dispatch();
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+    irq_enabled[irq] = false;
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type irq)
+{
+    irq_pending[irq] = true;
+    irq_dispatch();
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+    irq_pending[irq] = false;
+}
+
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    critical_nesting++;
+    return critical_nesting - 1u;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t saved)
+{
+    critical_nesting = saved;
+    irq_dispatch();
+}
+
+void Cy_SysLib_Delay(uint32_t ms)
+{
+    sim_flash_advance_us((uint64_t) ms * 1000u);
+}
+
+void Cy_SysLib_DelayUs(uint16_t us)
+{
+    sim_flash_advance_us(us);
+}
+
+
+/*******************************************************************************
+* Function Name: irq_dispatch
+********************************************************************************
+*
+* Summary:
+* Runs the handlers of pending, enabled interrupts outside critical
+* sections. Interrupts do not nest.
+*
+*******************************************************************************/
+static void irq_dispatch(void)
+{
+    if((0u != critical_nesting) || in_handler)
+    {
+        return;
+    }
+
+    in_handler = true;
+    for(uint32_t irq = 0u; irq < SIM_NUM_IRQ; irq++)
+    {
+        if(irq_pending[irq] && irq_enabled[irq] && (NULL != irq_handler[irq]))
+        {
+            irq_pending[irq] = false;
+            irq_handler[irq]();
+        }
+    }
+    in_handler = false;
+}
+
+
+/*******************************************************************************
+ * Low-voltage detector. The supply never drops in the simulation; power loss
+ * is injected by the flash model instead.
+ ******************************************************************************/
+void Cy_LVD_Enable(void)
+{
+}
+
+void Cy_LVD_Disable(void)
+{
+}
+
+void Cy_LVD_SetThreshold(cy_en_lvd_tripsel_select_t threshold)
+{
+    CY_UNUSED_PARAMETER(threshold);
+}
+
+void Cy_LVD_SetInterruptConfig(cy_en_lvd_intr_config_t config)
+{
+    CY_UNUSED_PARAMETER(config);
+}
+
+uint32_t Cy_LVD_GetInterruptStatus(void)
+{
+    return 0u;
+}
+
+void Cy_LVD_ClearInterrupt(void)
+{
+}
+
+void Cy_LVD_SetInterruptMask(void)
+{
+}
+
+void Cy_LVD_ClearInterruptMask(void)
+{
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysPm_RegisterCallback
+********************************************************************************
+*
+* Summary:
+* Keeps the Deep Sleep callbacks sorted by their order, like the PDL list.
+* A callback is registered only once.
+*
+*******************************************************************************/
+bool Cy_SysPm_RegisterCallback(cy_stc_syspm_callback_t *handler)
+{
+    uint32_t index;
+
+    if((NULL == handler) || (NULL == handler->callback) ||
+       (CY_SYSPM_DEEPSLEEP != handler->type) ||
+       (SIM_NUM_SYSPM_CALLBACKS == syspm_callback_count))
+    {
+        return false;
+    }
+
+    for(index = 0u; index < syspm_callback_count; index++)
+    {
+        if(handler == syspm_callback[index])
+        {
+            return false;
+        }
+    }
+
+    index = syspm_callback_count;
+    while((index > 0u) && (syspm_callback[index - 1u]->order > handler->order))
+    {
+        syspm_callback[index] = syspm_callback[index - 1u];
+        index--;
+    }
+    syspm_callback[index] = handler;
+    syspm_callback_count++;
+
+    return true;
+}
+
+bool Cy_SysPm_UnregisterCallback(cy_stc_syspm_callback_t const *handler)
+{
+    for(uint32_t index = 0u; index < syspm_callback_count; index++)
+    {
+        if(handler == syspm_callback[index])
+        {
+            syspm_callback_count--;
+            memmove(&syspm_callback[index], &syspm_callback[index + 1u],
+                    (syspm_callback_count - index) * sizeof(syspm_callback[0]));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SysPm_CpuEnterDeepSleep
+********************************************************************************
+*
+* Summary:
+* Runs the transition protocol of the PDL: CHECK_READY in order, CHECK_FAIL
+* in reverse for the callbacks that were ready if one of them refuses,
+* otherwise BEFORE_TRANSITION in order and, after an immediate wakeup,
+* AFTER_TRANSITION in reverse.
+*
+*******************************************************************************/
+cy_en_syspm_status_t Cy_SysPm_CpuEnterDeepSleep(cy_en_syspm_waitfor_t waitFor)
+{
+    uint32_t ready;
+
+    CY_UNUSED_PARAMETER(waitFor);
+
+    for(ready = 0u; ready < syspm_callback_count; ready++)
+    {
+        if(CY_SYSPM_SUCCESS != syspm_run(ready, CY_SYSPM_CHECK_READY))
+        {
+            while(ready > 0u)
+            {
+                ready--;
+                (void) syspm_run(ready, CY_SYSPM_CHECK_FAIL);
+            }
+            return CY_SYSPM_FAIL;
+        }
+    }
+
+    for(uint32_t index = 0u; index < syspm_callback_count; index++)
+    {
+        (void) syspm_run(index, CY_SYSPM_BEFORE_TRANSITION);
+    }
+    for(uint32_t index = syspm_callback_count; index > 0u; index--)
+    {
+        (void) syspm_run(index - 1u, CY_SYSPM_AFTER_TRANSITION);
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: syspm_run
+********************************************************************************
+*
+* Summary:
+* Calls one registered callback unless its skipMode excludes the mode.
+*
+*******************************************************************************/
+static cy_en_syspm_status_t syspm_run(uint32_t index, cy_en_syspm_callback_mode_t mode)
+{
+    cy_stc_syspm_callback_t *handler = syspm_callback[index];
+
+    if(0u != (handler->skipMode & (uint32_t) mode))
+    {
+        return CY_SYSPM_SUCCESS;
+    }
+
+    return handler->callback(handler->callbackParams, mode);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Drv_GetIpcBaseAddress
+********************************************************************************
+*
+* Summary:
+* IPC driver of the single host core: every lock is acquired at once.
+*
+*******************************************************************************/
+IPC_STRUCT_Type *Cy_IPC_Drv_GetIpcBaseAddress(uint32_t ipcIndex)
+{
+    static IPC_STRUCT_Type channels[16u];
+
+    return &channels[ipcIndex % 16u];
+}
+
+IPC_INTR_STRUCT_Type *Cy_IPC_Drv_GetIntrBaseAddr(uint32_t ipcIntrIndex)
+{
+    static IPC_INTR_STRUCT_Type intrs[16u];
+
+    return &intrs[ipcIntrIndex % 16u];
+}
+
+cy_en_ipcdrv_status_t Cy_IPC_Drv_LockAcquire(IPC_STRUCT_Type const *base)
+{
+    (void) base;
+    return CY_IPC_DRV_SUCCESS;
+}
+
+cy_en_ipcdrv_status_t Cy_IPC_Drv_LockRelease(IPC_STRUCT_Type *base, uint32_t releaseEventIntr)
+{
+    (void) base;
+    (void) releaseEventIntr;
+    return CY_IPC_DRV_SUCCESS;
+}
+
+void Cy_IPC_Drv_WriteDataValue(IPC_STRUCT_Type *base, uint32_t dataValue)
+{
+    base->DATA0 = dataValue;
+}
+
+uint32_t Cy_IPC_Drv_ReadDataValue(IPC_STRUCT_Type const *base)
+{
+    return base->DATA0;
+}
+
+void Cy_IPC_Drv_SetInterruptMask(IPC_INTR_STRUCT_Type *base, uint32_t ipcReleaseMask,
+                                 uint32_t ipcNotifyMask)
+{
+    base->INTR_MASK = ipcReleaseMask | (ipcNotifyMask << 16u);
+}
+
+void Cy_IPC_Drv_ClearInterrupt(IPC_INTR_STRUCT_Type *base, uint32_t ipcReleaseMask,
+                               uint32_t ipcNotifyMask)
+{
+    (void) base;
+    (void) ipcReleaseMask;
+    (void) ipcNotifyMask;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,400 @@
+/******************************************************************************
+* File Name: sim_counter.c
+*
+* Description: This file contains the counter scenario of the host
+*              simulator. It increments the monotonic counter of eeprom_counter.c
+*              across power cycles, cuts the supply during the increments and the
+*              rollovers to the other row, and checks that the counter neither goes
+*              back nor skips a value, and that no row is programmed more than
+*              EEPROM_FLASH_MAX_PROGRAMS times between two erases, plus one
+*              for each increment of it that was cut.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "eeprom_counter.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Increments per boot. A boot that is not cut short rolls over once. */
+#define SIM_COUNTER_STEPS_PER_BOOT      (EEPROM_COUNTER_BITS_PER_ROW)
+
+/* Number of errors printed before the rest are only counted. */
+#define SIM_COUNTER_MAX_REPORTED_ERRORS (10u)
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+/* What the scenario was doing when the supply was cut. */
+typedef enum
+{
+    SIM_COUNTER_PHASE_INIT,
+    SIM_COUNTER_PHASE_INCREMENT,
+    SIM_COUNTER_PHASE_ROLLOVER,
+    SIM_COUNTER_PHASE_COUNT,
+} sim_counter_phase_t;
+
+typedef struct
+{
+    uint64_t completed;
+    uint64_t power_losses[SIM_COUNTER_PHASE_COUNT];
+    uint64_t halts;
+    uint64_t increments;
+    uint64_t rollovers;
+    /* Most programs of one row between two erases. */
+    uint32_t max_programs;
+    /* Values that went back or skipped one. */
+    uint64_t value_errors;
+    /* Increments that programmed or erased more than they should, and rows
+     * programmed more than EEPROM_FLASH_MAX_PROGRAMS times between two erases.
+     */
+    uint64_t wear_errors;
+} sim_counter_results_t;
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_counter_area[EEPROM_COUNTER_AREA_SIZE] = {0u};
+
+/* The state below is kept in RAM across the simulated boots. */
+static eeprom_counter_t sim_counter;
+static sim_counter_results_t sim_counter_results;
+static sim_counter_phase_t sim_counter_phase;
+static uint64_t sim_counter_boots;
+/* Value returned by the last increment, and whether the supply was cut
+ * during the one after it, which may have been recorded.
+ */
+static uint64_t sim_counter_committed;
+static bool sim_counter_in_flight;
+/* Erases and programs of the two rows seen so far, and the programs of each
+ * and the increments of it cut by a power loss since its last erase.
+ */
+static uint32_t sim_counter_erases[2];
+static uint32_t sim_counter_programs[2];
+static uint32_t sim_counter_since_erase[2];
+static uint32_t sim_counter_cut[2];
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static int sim_counter_boot(void);
+static void sim_counter_check(void);
+static void sim_counter_increment(void);
+static void sim_counter_account(uint32_t *erases, uint32_t *programs);
+static void sim_counter_error(uint64_t *errors, const char *message, uint64_t value);
+
+
+/*******************************************************************************
+* Function Name: sim_counter_run
+********************************************************************************
+*
+* Summary:
+* Runs the counter scenario for a number of simulated boots. Every boot
+* restores the counter, checks its value and increments it
+* SIM_COUNTER_STEPS_PER_BOOT times. An increment must program one row once,
+* a rollover must erase and program the other row once.
+*
+* Parameters:
+* uint64_t cycles: number of boots.
+* uint32_t seed: unused; the flash model injects the faults.
+*
+* Return:
+* EXIT_SUCCESS if no check failed.
+*
+*******************************************************************************/
+int sim_counter_run(uint64_t cycles, uint32_t seed)
+{
+    (void) seed;
+
+    for(sim_counter_boots = 0u; sim_counter_boots < cycles; sim_counter_boots++)
+    {
+        uint32_t status;
+        sim_stop_t reason;
+
+        sim_counter_phase = SIM_COUNTER_PHASE_INIT;
+        reason = sim_boot(sim_counter_boot, &status);
+
+        switch(reason)
+        {
+            case SIM_STOP_NONE:
+                sim_counter_results.completed++;
+                break;
+
+            case SIM_STOP_POWER_LOSS:
+                sim_counter_results.power_losses[sim_counter_phase]++;
+                if(SIM_COUNTER_PHASE_INCREMENT == sim_counter_phase)
+                {
+                    sim_counter_cut[sim_counter.active]++;
+                }
+                break;
+
+            default:
+                if(sim_counter_results.halts < SIM_COUNTER_MAX_REPORTED_ERRORS)
+                {
+                    printf("counter boot %llu: halted with status 0x%lx\n",
+                           (unsigned long long) sim_counter_boots, (unsigned long) status);
+                }
+                sim_counter_results.halts++;
+                sim_flash_format();
+                memset(sim_counter_since_erase, 0, sizeof(sim_counter_since_erase));
+                memset(sim_counter_cut, 0, sizeof(sim_counter_cut));
+                sim_counter_committed = 0u;
+                sim_counter_in_flight = false;
+                break;
+        }
+    }
+
+    printf("counter boots:        %llu (%llu completed, %llu halts)\n",
+           (unsigned long long) cycles, (unsigned long long) sim_counter_results.completed,
+           (unsigned long long) sim_counter_results.halts);
+    printf("counter power losses: %llu in init, %llu in increments, %llu in rollovers\n",
+           (unsigned long long) sim_counter_results.power_losses[SIM_COUNTER_PHASE_INIT],
+           (unsigned long long) sim_counter_results.power_losses[SIM_COUNTER_PHASE_INCREMENT],
+           (unsigned long long) sim_counter_results.power_losses[SIM_COUNTER_PHASE_ROLLOVER]);
+    printf("counter operations:   %llu increments, %llu rollovers, value %llu\n",
+           (unsigned long long) sim_counter_results.increments,
+           (unsigned long long) sim_counter_results.rollovers,
+           (unsigned long long) eeprom_counter_get(&sim_counter));
+    printf("counter value errors: %llu\n", (unsigned long long) sim_counter_results.value_errors);
+    printf("counter wear errors:  %llu, at most %lu programs of a row between erases (limit %lu plus cuts)\n",
+           (unsigned long long) sim_counter_results.wear_errors,
+           (unsigned long) sim_counter_results.max_programs,
+           (unsigned long) EEPROM_FLASH_MAX_PROGRAMS);
+
+    return (((0u == sim_counter_results.value_errors) && (0u == sim_counter_results.wear_errors) &&
+             (0u == sim_counter_results.halts) && (0u != sim_counter_results.rollovers)) ?
+            EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_counter_boot
+********************************************************************************
+*
+* Summary:
+* One simulated boot of the scenario.
+*
+*******************************************************************************/
+static int sim_counter_boot(void)
+{
+    cy_en_flashdrv_status_t status;
+
+    /* Count what the operation cut by the last power loss did. */
+    sim_counter_account(NULL, NULL);
+
+    /* An erased area starts a row at zero, which a power loss can cut. */
+    status = eeprom_counter_init(&sim_counter, (uint32_t) (uintptr_t) sim_counter_area);
+    if(CY_FLASH_DRV_SUCCESS != status)
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_counter_account(NULL, NULL);
+    sim_counter_check();
+
+    for(uint32_t i = 0u; i < SIM_COUNTER_STEPS_PER_BOOT; i++)
+    {
+        sim_counter_increment();
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_counter_check
+********************************************************************************
+*
+* Summary:
+* Compares the restored value with the value of the last increment that
+* returned. The increment in flight at the power loss may have been recorded,
+* whether it programmed one more bit or started the other row.
+*
+*******************************************************************************/
+static void sim_counter_check(void)
+{
+    uint64_t value = eeprom_counter_get(&sim_counter);
+
+    if((value != sim_counter_committed) &&
+       (!sim_counter_in_flight || (value != (sim_counter_committed + 1u))))
+    {
+        sim_counter_error(&sim_counter_results.value_errors, "restored", value);
+    }
+
+    /* Continue from the restored value, so that one error is counted once. */
+    sim_counter_committed = value;
+    sim_counter_in_flight = false;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_counter_increment
+********************************************************************************
+*
+* Summary:
+* Increments the counter and checks the new value and the flash operations
+* the increment took.
+*
+*******************************************************************************/
+static void sim_counter_increment(void)
+{
+    cy_en_flashdrv_status_t status;
+    uint32_t erases;
+    uint32_t programs;
+    bool rollover = (sim_counter.used >= EEPROM_COUNTER_BITS_PER_ROW);
+
+    sim_counter_phase = rollover ? SIM_COUNTER_PHASE_ROLLOVER : SIM_COUNTER_PHASE_INCREMENT;
+    sim_counter_in_flight = true;
+    status = eeprom_counter_increment(&sim_counter);
+    if(CY_FLASH_DRV_SUCCESS != status)
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_counter_in_flight = false;
+
+    sim_counter_account(&erases, &programs);
+    if((programs != 1u) || (erases != (rollover ? 1u : 0u)))
+    {
+        sim_counter_error(&sim_counter_results.wear_errors, "took extra flash operations at",
+                          eeprom_counter_get(&sim_counter));
+    }
+
+    if(eeprom_counter_get(&sim_counter) != (sim_counter_committed + 1u))
+    {
+        sim_counter_error(&sim_counter_results.value_errors, "incremented to",
+                          eeprom_counter_get(&sim_counter));
+    }
+    sim_counter_committed = eeprom_counter_get(&sim_counter);
+
+    sim_counter_results.increments++;
+    if(rollover)
+    {
+        sim_counter_results.rollovers++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_counter_account
+********************************************************************************
+*
+* Summary:
+* Reads the erase and program counts of the two rows from the flash model and
+* updates the programs of each row since its last erase. Every operation
+* erases a row at most once, before it programs it. The increments cut before
+* their bit was set are programmed again, so they are allowed on top of
+* EEPROM_FLASH_MAX_PROGRAMS.
+*
+* Parameters:
+* uint32_t *erases: receives the erases since the last call, or NULL.
+* uint32_t *programs: receives the programs since the last call, or NULL.
+*
+*******************************************************************************/
+static void sim_counter_account(uint32_t *erases, uint32_t *programs)
+{
+    uint32_t first = (uint32_t) (((uintptr_t) sim_counter_area - (uintptr_t) sim_flash_row_address(0u)) /
+                                 CY_FLASH_SIZEOF_ROW);
+    uint32_t total_erases = 0u;
+    uint32_t total_programs = 0u;
+
+    for(uint32_t i = 0u; i < 2u; i++)
+    {
+        uint32_t row_erases = sim_flash_row_erases(first + i) - sim_counter_erases[i];
+        uint32_t row_programs = sim_flash_row_programs(first + i) - sim_counter_programs[i];
+
+        sim_counter_erases[i] += row_erases;
+        sim_counter_programs[i] += row_programs;
+        total_erases += row_erases;
+        total_programs += row_programs;
+
+        if(0u != row_erases)
+        {
+            sim_counter_since_erase[i] = 0u;
+            sim_counter_cut[i] = 0u;
+        }
+        sim_counter_since_erase[i] += row_programs;
+        if(sim_counter_since_erase[i] > sim_counter_results.max_programs)
+        {
+            sim_counter_results.max_programs = sim_counter_since_erase[i];
+        }
+        if((0u != row_programs) &&
+           (sim_counter_since_erase[i] > (EEPROM_FLASH_MAX_PROGRAMS + sim_counter_cut[i])))
+        {
+            sim_counter_error(&sim_counter_results.wear_errors, "programmed a row too often at",
+                              eeprom_counter_get(&sim_counter));
+        }
+    }
+
+    if(NULL != erases)
+    {
+        *erases = total_erases;
+    }
+    if(NULL != programs)
+    {
+        *programs = total_programs;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_counter_error
+********************************************************************************
+*
+* Summary:
+* Counts an error and prints the first SIM_COUNTER_MAX_REPORTED_ERRORS of them.
+*
+*******************************************************************************/
+static void sim_counter_error(uint64_t *errors, const char *message, uint64_t value)
+{
+    if(*errors < SIM_COUNTER_MAX_REPORTED_ERRORS)
+    {
+        printf("counter boot %llu: %s %llu, last value %llu\n",
+               (unsigned long long) sim_counter_boots, message, (unsigned long long) value,
+               (unsigned long long) sim_counter_committed);
+    }
+    (*errors)++;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,557 @@
+/******************************************************************************
+* File Name: sim_flash.c
+*
+* Description: This file contains the RAM-backed flash model of the host
+*              simulator. All objects placed with CY_SECTION() are collected in
+*              the sim_flash section, which the model makes writable and serves
+*              the Cy_Flash_* row operations from. Each operation adds its
+*              datasheet time to the cycle counter, is counted per row and may
+*              be interrupted by a simulated power loss or leave a flipped bit.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "sim.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define SIM_FLASH_ERASED_VALUE          (0x00u)
+#define SIM_FLASH_ROW_WORDS             (CY_FLASH_SIZEOF_ROW / sizeof(uint32_t))
+#define SIM_FLASH_SUBSECTOR_ROWS        (8u)
+#define SIM_FLASH_SECTOR_ROWS           (512u)
+#define SIM_PPM                         (1000000u)
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+/* Bounds of the sim_flash section, provided by the linker. */
+extern uint8_t __start_sim_flash[];
+extern uint8_t __stop_sim_flash[];
+
+static sim_flash_config_t flash_config;
+static sim_flash_stats_t flash_stats;
+static uint32_t flash_rows;
+static uint32_t *row_erases;
+static uint32_t *row_programs;
+static uint32_t *row_bit_flips;
+/* First row of the last erase or program, the one a power loss cut. */
+static uint32_t last_row;
+/* Programs that fail before they change the row, set by
+ * sim_flash_fail_programs().
+ */
+static uint32_t failing_programs;
+static uint32_t flash_random;
+/* Non-blocking operations complete at once. This holds the status of the
+ * last one for Cy_Flash_IsOperationComplete().
+ */
+static cy_en_flashdrv_status_t pending_status = CY_FLASH_DRV_SUCCESS;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static uint32_t sim_random(void);
+static bool sim_chance(uint32_t ppm);
+static int32_t flash_row_index(uint32_t rowAddr);
+static void flash_erase(uint32_t row, uint32_t count, uint32_t time_us);
+static void flash_program(uint32_t row, const uint32_t *data, bool erase);
+
+
+/*******************************************************************************
+* Function Name: sim_flash_init
+********************************************************************************
+*
+* Summary:
+* Makes the sim_flash section writable and resets the counters. The content
+* of the section is kept, so that it starts out as the build left it.
+*
+* Parameters:
+* const sim_flash_config_t *config: timings and fault probabilities.
+* uint32_t seed: seed of the fault injection.
+*
+*******************************************************************************/
+void sim_flash_init(const sim_flash_config_t *config, uint32_t seed)
+{
+    uintptr_t page = (uintptr_t) sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t) __start_sim_flash & ~(page - 1u);
+    uintptr_t stop = ((uintptr_t) __stop_sim_flash + page - 1u) & ~(page - 1u);
+
+    /* The application and the middleware keep flash addresses in uint32_t. */
+    if((uintptr_t) __stop_sim_flash > UINT32_MAX)
+    {
+        fprintf(stderr, "sim_flash is above 4 GB, link with -no-pie or -m32\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if(0 != mprotect((void *) start, stop - start, PROT_READ | PROT_WRITE))
+    {
+        perror("mprotect");
+        exit(EXIT_FAILURE);
+    }
+
+    flash_config = *config;
+    flash_random = (0u != seed) ? seed : 1u;
+    flash_rows = (uint32_t) ((__stop_sim_flash - __start_sim_flash) / CY_FLASH_SIZEOF_ROW);
+    free(row_erases);
+    free(row_programs);
+    free(row_bit_flips);
+    row_erases = calloc(flash_rows, sizeof(uint32_t));
+    row_programs = calloc(flash_rows, sizeof(uint32_t));
+    row_bit_flips = calloc(flash_rows, sizeof(uint32_t));
+    memset(&flash_stats, 0, sizeof(flash_stats));
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_format
+********************************************************************************
+*
+* Summary:
+* Erases the whole simulated flash, like reprogramming the device with a
+* fresh image. The wear counters are kept.
+*
+*******************************************************************************/
+void sim_flash_format(void)
+{
+    memset(__start_sim_flash, SIM_FLASH_ERASED_VALUE,
+           (size_t) (__stop_sim_flash - __start_sim_flash));
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_get_stats
+********************************************************************************
+*
+* Summary:
+* Copies the cumulative counters of the flash model.
+*
+* Parameters:
+* sim_flash_stats_t *stats: receives the counters.
+*
+*******************************************************************************/
+void sim_flash_get_stats(sim_flash_stats_t *stats)
+{
+    *stats = flash_stats;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_num_rows
+********************************************************************************
+*
+* Summary:
+* Returns the number of rows in the simulated flash.
+*
+*******************************************************************************/
+uint32_t sim_flash_num_rows(void)
+{
+    return flash_rows;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_row_address
+********************************************************************************
+*
+* Summary:
+* Returns the address of a row of the simulated flash.
+*
+*******************************************************************************/
+uint32_t sim_flash_row_address(uint32_t row)
+{
+    return (uint32_t) (uintptr_t) (__start_sim_flash + (row * CY_FLASH_SIZEOF_ROW));
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_row_erases
+********************************************************************************
+*
+* Summary:
+* Returns how many times a row has been erased.
+*
+*******************************************************************************/
+uint32_t sim_flash_row_erases(uint32_t row)
+{
+    return row_erases[row];
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_row_programs
+********************************************************************************
+*
+* Summary:
+* Returns how many times a row has been programmed.
+*
+*******************************************************************************/
+uint32_t sim_flash_row_programs(uint32_t row)
+{
+    return row_programs[row];
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_row_bit_flips
+********************************************************************************
+*
+* Summary:
+* Returns how many bits of a row have been flipped.
+*
+*******************************************************************************/
+uint32_t sim_flash_row_bit_flips(uint32_t row)
+{
+    return row_bit_flips[row];
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_last_row
+********************************************************************************
+*
+* Summary:
+* Returns the first row of the last erase or program. After a power loss,
+* this is the row whose operation was cut.
+*
+*******************************************************************************/
+uint32_t sim_flash_last_row(void)
+{
+    return last_row;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_fail_programs
+********************************************************************************
+*
+* Summary:
+* Makes the next programs fail with CY_FLASH_DRV_PL_ROW_COMP_FA, as a row
+* that does not verify would, without changing the row.
+*
+* Parameters:
+* uint32_t count: number of programs to fail, 0 to stop failing them.
+*
+* Return:
+* The programs of the previous call that had not failed yet.
+*
+*******************************************************************************/
+uint32_t sim_flash_fail_programs(uint32_t count)
+{
+    uint32_t left = failing_programs;
+
+    failing_programs = count;
+    return left;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_flash_advance_us
+********************************************************************************
+*
+* Summary:
+* Advances the simulated time and the cycle counter.
+*
+* Parameters:
+* uint64_t us: elapsed time in microseconds.
+*
+*******************************************************************************/
+void sim_flash_advance_us(uint64_t us)
+{
+    sim_dwt.CYCCNT += (uint32_t) (us * (SIM_CORE_CLOCK_HZ / 1000000u));
+}
+
+
+/*******************************************************************************
+ * PDL flash driver
+ ******************************************************************************/
+cy_en_flashdrv_status_t Cy_Flash_EraseRow(uint32_t rowAddr)
+{
+    int32_t row = flash_row_index(rowAddr);
+
+    if(row < 0)
+    {
+        return CY_FLASH_DRV_INVALID_FLASH_ADDR;
+    }
+    flash_erase((uint32_t) row, 1u, flash_config.row_erase_us);
+    return CY_FLASH_DRV_SUCCESS;
+}
+
+cy_en_flashdrv_status_t Cy_Flash_EraseSubsector(uint32_t subSectorAddr)
+{
+    int32_t row = flash_row_index(subSectorAddr);
+
+    if((row < 0) || (0u != ((uint32_t) row % SIM_FLASH_SUBSECTOR_ROWS)) ||
+       (((uint32_t) row + SIM_FLASH_SUBSECTOR_ROWS) > flash_rows))
+    {
+        return CY_FLASH_DRV_INVALID_FLASH_ADDR;
+    }
+    flash_erase((uint32_t) row, SIM_FLASH_SUBSECTOR_ROWS, flash_config.subsector_erase_us);
+    return CY_FLASH_DRV_SUCCESS;
+}
+
+cy_en_flashdrv_status_t Cy_Flash_EraseSector(uint32_t sectorAddr)
+{
+    int32_t row = flash_row_index(sectorAddr);
+
+    if((row < 0) || (0u != ((uint32_t) row % SIM_FLASH_SECTOR_ROWS)) ||
+       (((uint32_t) row + SIM_FLASH_SECTOR_ROWS) > flash_rows))
+    {
+        return CY_FLASH_DRV_INVALID_FLASH_ADDR;
+    }
+    flash_erase((uint32_t) row, SIM_FLASH_SECTOR_ROWS, flash_config.sector_erase_us);
+    return CY_FLASH_DRV_SUCCESS;
+}
+
+cy_en_flashdrv_status_t Cy_Flash_ProgramRow(uint32_t rowAddr, const uint32_t *data)
+{
+    int32_t row = flash_row_index(rowAddr);
+
+    if(row < 0)
+    {
+        return CY_FLASH_DRV_INVALID_FLASH_ADDR;
+    }
+    if(0u != failing_programs)
+    {
+        failing_programs--;
+        return CY_FLASH_DRV_PL_ROW_COMP_FA;
+    }
+    flash_program((uint32_t) row, data, false);
+    return CY_FLASH_DRV_SUCCESS;
+}
+
+cy_en_flashdrv_status_t Cy_Flash_WriteRow(uint32_t rowAddr, const uint32_t *data)
+{
+    int32_t row = flash_row_index(rowAddr);
+
+    if(row < 0)
+    {
+        return CY_FLASH_DRV_INVALID_FLASH_ADDR;
+    }
+    if(0u != failing_programs)
+    {
+        failing_programs--;
+        return CY_FLASH_DRV_PL_ROW_COMP_FA;
+    }
+    flash_program((uint32_t) row, data, true);
+    return CY_FLASH_DRV_SUCCESS;
+}
+
+cy_en_flashdrv_status_t Cy_Flash_StartEraseRow(uint32_t rowAddr)
+{
+    pending_status = Cy_Flash_EraseRow(rowAddr);
+    return (CY_FLASH_DRV_SUCCESS == pending_status) ?
+           CY_FLASH_DRV_OPERATION_STARTED : pending_status;
+}
+
+cy_en_flashdrv_status_t Cy_Flash_StartProgram(uint32_t rowAddr, const uint32_t *data)
+{
+    pending_status = Cy_Flash_ProgramRow(rowAddr, data);
+    return (CY_FLASH_DRV_SUCCESS == pending_status) ?
+           CY_FLASH_DRV_OPERATION_STARTED : pending_status;
+}
+
+cy_en_flashdrv_status_t Cy_Flash_StartWrite(uint32_t rowAddr, const uint32_t *data)
+{
+    pending_status = Cy_Flash_WriteRow(rowAddr, data);
+    return (CY_FLASH_DRV_SUCCESS == pending_status) ?
+           CY_FLASH_DRV_OPERATION_STARTED : pending_status;
+}
+
+cy_en_flashdrv_status_t Cy_Flash_IsOperationComplete(void)
+{
+    return pending_status;
+}
+
+
+/*******************************************************************************
+* Function Name: flash_row_index
+********************************************************************************
+*
+* Summary:
+* Maps a row address to the row index in the simulated flash.
+*
+* Return:
+* The row index, or -1 if the address is not the start of a simulated row.
+*
+*******************************************************************************/
+static int32_t flash_row_index(uint32_t rowAddr)
+{
+    uintptr_t start = (uintptr_t) __start_sim_flash;
+    uintptr_t addr = (uintptr_t) rowAddr;
+
+    if((addr < start) || (addr >= (uintptr_t) __stop_sim_flash) ||
+       (0u != ((addr - start) % CY_FLASH_SIZEOF_ROW)))
+    {
+        return -1;
+    }
+    return (int32_t) ((addr - start) / CY_FLASH_SIZEOF_ROW);
+}
+
+
+/*******************************************************************************
+* Function Name: flash_erase
+********************************************************************************
+*
+* Summary:
+* Erases consecutive rows. A power loss during the erase leaves a random
+* number of them erased.
+*
+*******************************************************************************/
+static void flash_erase(uint32_t row, uint32_t count, uint32_t time_us)
+{
+    uint32_t erased = count;
+    bool lost = sim_chance(flash_config.power_loss_ppm);
+
+    last_row = row;
+    if(lost)
+    {
+        erased = sim_random() % count;
+    }
+
+    memset(__start_sim_flash + (row * CY_FLASH_SIZEOF_ROW), SIM_FLASH_ERASED_VALUE,
+           erased * CY_FLASH_SIZEOF_ROW);
+    for(uint32_t i = 0u; i < erased; i++)
+    {
+        row_erases[row + i]++;
+    }
+    flash_stats.erases += erased;
+    flash_stats.busy_us += time_us;
+    sim_flash_advance_us(time_us);
+
+    if(lost)
+    {
+        flash_stats.power_losses++;
+        sim_stop(SIM_STOP_POWER_LOSS, 0u);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: flash_program
+********************************************************************************
+*
+* Summary:
+* Programs one row, erasing it first for a row write. Programming sets bits
+* (the erased value is 0x00), so ProgramRow() ORs the data into the row. A
+* power loss programs only part of the words; the bits programmed before
+* stay set.
+*
+*******************************************************************************/
+static void flash_program(uint32_t row, const uint32_t *data, bool erase)
+{
+    uint32_t *words = (uint32_t *) (void *) (__start_sim_flash + (row * CY_FLASH_SIZEOF_ROW));
+    uint32_t count = SIM_FLASH_ROW_WORDS;
+    uint32_t time_us = erase ? flash_config.row_write_us : flash_config.row_program_us;
+    bool lost = sim_chance(flash_config.power_loss_ppm);
+
+    last_row = row;
+    if(erase)
+    {
+        memset(words, SIM_FLASH_ERASED_VALUE, CY_FLASH_SIZEOF_ROW);
+        row_erases[row]++;
+        flash_stats.erases++;
+    }
+
+    if(lost)
+    {
+        count = sim_random() % SIM_FLASH_ROW_WORDS;
+    }
+
+    for(uint32_t i = 0u; i < count; i++)
+    {
+        words[i] |= data[i];
+    }
+    row_programs[row]++;
+    flash_stats.programs++;
+
+    if(sim_chance(flash_config.bit_flip_ppm))
+    {
+        uint32_t bit = sim_random() % (CY_FLASH_SIZEOF_ROW * 8u);
+        words[bit / 32u] ^= (1uL << (bit % 32u));
+        row_bit_flips[row]++;
+        flash_stats.bit_flips++;
+    }
+
+    flash_stats.busy_us += time_us;
+    sim_flash_advance_us(time_us);
+
+    if(lost)
+    {
+        flash_stats.power_losses++;
+        sim_stop(SIM_STOP_POWER_LOSS, 0u);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_random
+********************************************************************************
+*
+* Summary:
+* xorshift32, so that a run can be repeated with the same seed.
+*
+*******************************************************************************/
+static uint32_t sim_random(void)
+{
+    flash_random ^= flash_random << 13u;
+    flash_random ^= flash_random >> 17u;
+    flash_random ^= flash_random << 5u;
+    return flash_random;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_chance
+********************************************************************************
+*
+* Summary:
+* Returns true with the given probability in parts per million.
+*
+*******************************************************************************/
+static bool sim_chance(uint32_t ppm)
+{
+    return (0u != ppm) && ((sim_random() % SIM_PPM) < ppm);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,523 @@
+/******************************************************************************
+* File Name: sim_ipc.c
+*
+* Description: This file contains the dual-core queue scenario of the host simulator.
+*              It runs the owner and the client side of eeprom_ipc.c in one process,
+*              queues bursts of writes, fails the flush of some batches and cuts the
+*              supply during others, and checks the status returned for every ticket
+*              and the data each boot reads back.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "eeprom_ipc.h"
+#include "eeprom_status.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Two rows of logical data, and a shared image starting in the first row and
+ * ending in the second, so that a batch touches one or two rows.
+ */
+#define SIM_IPC_SIZE                    (2u * CY_EM_EEPROM_EEPROM_DATA_LEN(0u))
+#define SIM_IPC_WEAR_LEVELLING          (2u)
+#define SIM_IPC_AREA_SIZE               (CY_EM_EEPROM_GET_PHYSICAL_SIZE(SIM_IPC_SIZE, 0u, \
+                                         SIM_IPC_WEAR_LEVELLING, 1u))
+#define SIM_IPC_BASE                    (128u)
+#define SIM_IPC_IMAGE_SIZE              (EEPROM_IPC_IMAGE_SIZE)
+
+/* Bursts per boot. One in SIM_IPC_LONG_BURST is longer than the queue, so
+ * that eeprom_ipc_write() waits for the owner; one in SIM_IPC_FAIL_BURST of
+ * the others gets a failing flush.
+ */
+#define SIM_IPC_BURSTS_PER_BOOT         (6u)
+#define SIM_IPC_LONG_BURST              (8u)
+#define SIM_IPC_FAIL_BURST              (4u)
+#define SIM_IPC_MAX_BURST               (2u * EEPROM_IPC_QUEUE_DEPTH)
+
+/* Writes not known to be committed: at most a failed burst and the next. */
+#define SIM_IPC_MAX_PENDING             (2u * SIM_IPC_MAX_BURST)
+
+/* Number of errors printed before the rest are only counted. */
+#define SIM_IPC_MAX_REPORTED_ERRORS     (10u)
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+/* What the client was doing when the supply was cut. */
+typedef enum
+{
+    /* Opening the instance and the queue. */
+    SIM_IPC_PHASE_INIT,
+    /* Queueing writes, with the owner serving a full queue. */
+    SIM_IPC_PHASE_QUEUE,
+    /* Waiting for a ticket while the owner serves the queue. */
+    SIM_IPC_PHASE_SYNC,
+    SIM_IPC_PHASE_COUNT,
+} sim_ipc_phase_t;
+
+typedef struct
+{
+    uint32_t addr;
+    uint32_t size;
+    uint8_t data[EEPROM_IPC_MAX_DATA];
+} sim_ipc_write_t;
+
+typedef struct
+{
+    uint64_t completed;
+    uint64_t power_losses[SIM_IPC_PHASE_COUNT];
+    uint64_t halts;
+    uint64_t writes;
+    uint64_t syncs;
+    uint64_t failed_batches;
+    /* Tickets whose eeprom_ipc_sync() status differed from the status of
+     * their batch, or from CY_EM_EEPROM_BAD_PARAM once their slot was reused.
+     */
+    uint64_t status_errors;
+    /* Images or flash content that differed from the committed writes, or
+     * after a power loss from them plus the writes in flight.
+     */
+    uint64_t data_errors;
+} sim_ipc_results_t;
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_ipc_area[SIM_IPC_AREA_SIZE] = {0u};
+
+static cy_stc_eeprom_config_t sim_ipc_config =
+{
+    .eepromSize = SIM_IPC_SIZE,
+    .blockingWrite = 1u,
+    .redundantCopy = 1u,
+    .wearLevelingFactor = SIM_IPC_WEAR_LEVELLING,
+    .simpleMode = 0u,
+};
+
+/* The state below is kept in RAM across the simulated boots. */
+static cy_stc_eeprom_context_t sim_ipc_context;
+static sim_ipc_results_t sim_ipc_results;
+static uint64_t sim_ipc_boots;
+static uint32_t sim_ipc_random_state;
+static sim_ipc_phase_t sim_ipc_phase;
+/* Image with every queued write applied, the image the flash held after the
+ * last successful batch, and the writes queued since then. After a power
+ * loss, every byte must hold its committed value or that of a pending write.
+ */
+static uint8_t sim_ipc_latest[SIM_IPC_IMAGE_SIZE];
+static uint8_t sim_ipc_committed[SIM_IPC_IMAGE_SIZE];
+static sim_ipc_write_t sim_ipc_pending[SIM_IPC_MAX_PENDING];
+static uint32_t sim_ipc_pending_count;
+/* Expected status of each ticket of the boot, the tickets restarting at 1
+ * with every eeprom_ipc_owner_init().
+ */
+static uint32_t sim_ipc_expected[SIM_IPC_BURSTS_PER_BOOT * SIM_IPC_MAX_BURST + 1u];
+static uint32_t sim_ipc_last_ticket;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static int sim_ipc_boot(void);
+static void sim_ipc_check(void);
+static bool sim_ipc_burst(bool may_fail);
+static void sim_ipc_sync(uint32_t ticket);
+static void sim_ipc_compare(const uint8_t *expected, bool flash, const char *message);
+static void sim_ipc_error(uint64_t *errors, const char *message, uint32_t ticket);
+static uint32_t sim_ipc_random(void);
+
+
+/*******************************************************************************
+* Function Name: sim_ipc_run
+********************************************************************************
+*
+* Summary:
+* Runs the dual-core queue scenario for a number of simulated boots. The
+* process is the owner core, and also the client, which queues bursts of
+* random writes with eeprom_ipc_write() and waits for them with
+* eeprom_ipc_sync(). Every ticket of a burst must report the status of the
+* batch that committed it, and a ticket whose slot a later write reused must
+* report CY_EM_EEPROM_BAD_PARAM.
+*
+* Parameters:
+* uint64_t cycles: number of boots.
+* uint32_t seed: seed of the bursts and the data.
+*
+* Return:
+* EXIT_SUCCESS if no check failed.
+*
+*******************************************************************************/
+int sim_ipc_run(uint64_t cycles, uint32_t seed)
+{
+    sim_ipc_random_state = (0u != seed) ? seed : 1u;
+    sim_ipc_config.userFlashStartAddr = (uint32_t) (uintptr_t) sim_ipc_area;
+
+    for(sim_ipc_boots = 0u; sim_ipc_boots < cycles; sim_ipc_boots++)
+    {
+        uint32_t status;
+        sim_stop_t reason;
+
+        sim_ipc_phase = SIM_IPC_PHASE_INIT;
+        reason = sim_boot(sim_ipc_boot, &status);
+        sim_flash_fail_programs(0u);
+
+        switch(reason)
+        {
+            case SIM_STOP_NONE:
+                sim_ipc_results.completed++;
+                break;
+
+            case SIM_STOP_POWER_LOSS:
+                sim_ipc_results.power_losses[sim_ipc_phase]++;
+                break;
+
+            default:
+                if(sim_ipc_results.halts < SIM_IPC_MAX_REPORTED_ERRORS)
+                {
+                    printf("ipc boot %llu: halted with status 0x%lx\n",
+                           (unsigned long long) sim_ipc_boots, (unsigned long) status);
+                }
+                sim_ipc_results.halts++;
+                sim_flash_format();
+                memset(sim_ipc_committed, 0, sizeof(sim_ipc_committed));
+                sim_ipc_pending_count = 0u;
+                break;
+        }
+    }
+
+    printf("ipc boots:         %llu (%llu completed, %llu halts)\n",
+           (unsigned long long) cycles, (unsigned long long) sim_ipc_results.completed,
+           (unsigned long long) sim_ipc_results.halts);
+    printf("ipc power losses:  %llu in init, %llu in queueing, %llu in syncs\n",
+           (unsigned long long) sim_ipc_results.power_losses[SIM_IPC_PHASE_INIT],
+           (unsigned long long) sim_ipc_results.power_losses[SIM_IPC_PHASE_QUEUE],
+           (unsigned long long) sim_ipc_results.power_losses[SIM_IPC_PHASE_SYNC]);
+    printf("ipc operations:    %llu writes, %llu syncs, %llu failed batches\n",
+           (unsigned long long) sim_ipc_results.writes,
+           (unsigned long long) sim_ipc_results.syncs,
+           (unsigned long long) sim_ipc_results.failed_batches);
+    printf("ipc status errors: %llu\n", (unsigned long long) sim_ipc_results.status_errors);
+    printf("ipc data errors:   %llu\n", (unsigned long long) sim_ipc_results.data_errors);
+
+    return (((0u == sim_ipc_results.status_errors) && (0u == sim_ipc_results.data_errors) &&
+             (0u == sim_ipc_results.halts)) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_ipc_boot
+********************************************************************************
+*
+* Summary:
+* One simulated boot of the scenario. After a failed batch the next burst
+* does not fail, so that it commits the writes the failed one left dirty.
+*
+*******************************************************************************/
+static int sim_ipc_boot(void)
+{
+    cy_en_em_eeprom_status_t status;
+    bool may_fail = true;
+
+    /* CY_EM_EEPROM_REDUNDANT_COPY_USED is expected after a power loss. */
+    status = Cy_Em_EEPROM_Init(&sim_ipc_config, &sim_ipc_context);
+    if(!eeprom_status_failed(status))
+    {
+        status = eeprom_ipc_owner_init(&sim_ipc_context, SIM_IPC_BASE, SIM_IPC_IMAGE_SIZE);
+    }
+    if(eeprom_status_failed(status) || !eeprom_ipc_is_ready())
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_ipc_last_ticket = 0u;
+
+    sim_ipc_check();
+
+    for(uint32_t i = 0u; i < SIM_IPC_BURSTS_PER_BOOT; i++)
+    {
+        may_fail = !sim_ipc_burst(may_fail);
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_ipc_check
+********************************************************************************
+*
+* Summary:
+* Checks the flash after a boot against the committed image and the writes in
+* flight, and the image the owner filled against the flash.
+*
+*******************************************************************************/
+static void sim_ipc_check(void)
+{
+    uint8_t data[SIM_IPC_IMAGE_SIZE];
+    uint8_t image[SIM_IPC_IMAGE_SIZE];
+    cy_en_em_eeprom_status_t status;
+    bool torn = false;
+
+    status = Cy_Em_EEPROM_Read(SIM_IPC_BASE, data, SIM_IPC_IMAGE_SIZE, &sim_ipc_context);
+    status = eeprom_status_combine(status, eeprom_ipc_read(SIM_IPC_BASE, image,
+                                                           SIM_IPC_IMAGE_SIZE));
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+
+    for(uint32_t offset = 0u; (offset < SIM_IPC_IMAGE_SIZE) && !torn; offset++)
+    {
+        bool found = (data[offset] == sim_ipc_committed[offset]);
+
+        for(uint32_t i = 0u; (i < sim_ipc_pending_count) && !found; i++)
+        {
+            const sim_ipc_write_t *write = &sim_ipc_pending[i];
+            uint32_t addr = SIM_IPC_BASE + offset;
+
+            found = (addr >= write->addr) && (addr < (write->addr + write->size)) &&
+                    (data[offset] == write->data[addr - write->addr]);
+        }
+        torn = !found;
+    }
+    if(torn)
+    {
+        sim_ipc_error(&sim_ipc_results.data_errors, "flash holds data never written", 0u);
+    }
+    if(0 != memcmp(image, data, SIM_IPC_IMAGE_SIZE))
+    {
+        sim_ipc_error(&sim_ipc_results.data_errors, "shared image differs from the flash", 0u);
+    }
+
+    /* Continue from what the instance holds, so that one error is counted once. */
+    memcpy(sim_ipc_committed, data, SIM_IPC_IMAGE_SIZE);
+    memcpy(sim_ipc_latest, data, SIM_IPC_IMAGE_SIZE);
+    sim_ipc_pending_count = 0u;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_ipc_burst
+********************************************************************************
+*
+* Summary:
+* Queues a burst of random writes, syncs its last ticket, with a failing
+* program if may_fail and the burst draws it, and then syncs every ticket of
+* the burst and one earlier ticket in random order.
+*
+* Return:
+* true if the flush of the burst failed.
+*
+*******************************************************************************/
+static bool sim_ipc_burst(bool may_fail)
+{
+    bool is_long = (0u == (sim_ipc_random() % SIM_IPC_LONG_BURST));
+    uint32_t count = is_long ? (EEPROM_IPC_QUEUE_DEPTH + 1u +
+                                (sim_ipc_random() % (SIM_IPC_MAX_BURST - EEPROM_IPC_QUEUE_DEPTH))) :
+                               (1u + (sim_ipc_random() % EEPROM_IPC_QUEUE_DEPTH));
+    bool fail = may_fail && !is_long && (0u == (sim_ipc_random() % SIM_IPC_FAIL_BURST));
+    uint32_t first = sim_ipc_last_ticket + 1u;
+    cy_en_em_eeprom_status_t status;
+    uint32_t ticket = 0u;
+
+    sim_ipc_phase = SIM_IPC_PHASE_QUEUE;
+    for(uint32_t i = 0u; i < count; i++)
+    {
+        sim_ipc_write_t *write = &sim_ipc_pending[sim_ipc_pending_count];
+
+        write->addr = SIM_IPC_BASE + (sim_ipc_random() % SIM_IPC_IMAGE_SIZE);
+        write->size = 1u + (sim_ipc_random() % EEPROM_IPC_MAX_DATA);
+        if(write->size > (SIM_IPC_BASE + SIM_IPC_IMAGE_SIZE - write->addr))
+        {
+            write->size = SIM_IPC_BASE + SIM_IPC_IMAGE_SIZE - write->addr;
+        }
+        for(uint32_t j = 0u; j < write->size; j++)
+        {
+            write->data[j] = (uint8_t) sim_ipc_random();
+        }
+        memcpy(&sim_ipc_latest[write->addr - SIM_IPC_BASE], write->data, write->size);
+        sim_ipc_pending_count++;
+
+        status = eeprom_ipc_write(write->addr, write->data, write->size, &ticket);
+        if(eeprom_status_failed(status))
+        {
+            sim_stop(SIM_STOP_HALT, (uint32_t) status);
+        }
+        if(ticket != (sim_ipc_last_ticket + 1u))
+        {
+            sim_ipc_error(&sim_ipc_results.status_errors, "out of sequence", ticket);
+        }
+        sim_ipc_last_ticket = ticket;
+        sim_ipc_results.writes++;
+    }
+
+    /* A short burst is one batch, committed by the sync of its last ticket.
+     * A failed batch keeps its data in the image of the owner.
+     */
+    sim_ipc_phase = SIM_IPC_PHASE_SYNC;
+    sim_flash_fail_programs(fail ? 1u : 0u);
+    status = eeprom_ipc_sync(ticket);
+    sim_ipc_results.syncs++;
+    fail = fail && (0u == sim_flash_fail_programs(0u));
+    if(fail != eeprom_status_failed(status))
+    {
+        sim_ipc_error(&sim_ipc_results.status_errors,
+                      fail ? "failed batch reported as committed" :
+                      "committed batch reported as failed", ticket);
+    }
+    for(uint32_t t = first; t <= ticket; t++)
+    {
+        sim_ipc_expected[t] = (uint32_t) (fail ? status : CY_EM_EEPROM_SUCCESS);
+    }
+    if(fail)
+    {
+        sim_ipc_results.failed_batches++;
+    }
+    else
+    {
+        sim_ipc_compare(sim_ipc_latest, true, "flash differs after a committed batch");
+        memcpy(sim_ipc_committed, sim_ipc_latest, SIM_IPC_IMAGE_SIZE);
+        sim_ipc_pending_count = 0u;
+    }
+    sim_ipc_compare(sim_ipc_latest, false, "shared image differs from the writes");
+
+    for(uint32_t i = 0u; i <= count; i++)
+    {
+        sim_ipc_sync(1u + (sim_ipc_random() % ticket));
+    }
+    sim_ipc_phase = SIM_IPC_PHASE_INIT;
+
+    return fail;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_ipc_sync
+********************************************************************************
+*
+* Summary:
+* Syncs a ticket that is already committed and checks its status.
+*
+*******************************************************************************/
+static void sim_ipc_sync(uint32_t ticket)
+{
+    cy_en_em_eeprom_status_t status = eeprom_ipc_sync(ticket);
+    bool reused = ((sim_ipc_last_ticket - ticket) >= EEPROM_IPC_QUEUE_DEPTH);
+
+    sim_ipc_results.syncs++;
+    if(reused ? (CY_EM_EEPROM_BAD_PARAM != status) :
+       (eeprom_status_failed(status) !=
+        eeprom_status_failed((cy_en_em_eeprom_status_t) sim_ipc_expected[ticket])) ||
+       (eeprom_status_failed(status) && ((uint32_t) status != sim_ipc_expected[ticket])))
+    {
+        sim_ipc_error(&sim_ipc_results.status_errors,
+                      reused ? "reused slot not reported" : "status of the batch not reported",
+                      ticket);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_ipc_compare
+********************************************************************************
+*
+* Summary:
+* Compares the flash or the shared image with an expected image.
+*
+*******************************************************************************/
+static void sim_ipc_compare(const uint8_t *expected, bool flash, const char *message)
+{
+    uint8_t data[SIM_IPC_IMAGE_SIZE];
+    cy_en_em_eeprom_status_t status;
+
+    status = flash ? Cy_Em_EEPROM_Read(SIM_IPC_BASE, data, SIM_IPC_IMAGE_SIZE, &sim_ipc_context) :
+             eeprom_ipc_read(SIM_IPC_BASE, data, SIM_IPC_IMAGE_SIZE);
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    if(0 != memcmp(data, expected, SIM_IPC_IMAGE_SIZE))
+    {
+        sim_ipc_error(&sim_ipc_results.data_errors, message, sim_ipc_last_ticket);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_ipc_error
+********************************************************************************
+*
+* Summary:
+* Counts an error and prints the first SIM_IPC_MAX_REPORTED_ERRORS of its
+* kind.
+*
+*******************************************************************************/
+static void sim_ipc_error(uint64_t *errors, const char *message, uint32_t ticket)
+{
+    if(*errors < SIM_IPC_MAX_REPORTED_ERRORS)
+    {
+        printf("ipc boot %llu ticket %lu: %s\n", (unsigned long long) sim_ipc_boots,
+               (unsigned long) ticket, message);
+    }
+    (*errors)++;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_ipc_random
+********************************************************************************
+*
+* Summary:
+* xorshift32, separate from the fault injection of the flash model.
+*
+*******************************************************************************/
+static uint32_t sim_ipc_random(void)
+{
+    sim_ipc_random_state ^= sim_ipc_random_state << 13u;
+    sim_ipc_random_state ^= sim_ipc_random_state >> 17u;
+    sim_ipc_random_state ^= sim_ipc_random_state << 5u;
+    return sim_ipc_random_state;
+}
+
+
+/* [] END OF FILE */
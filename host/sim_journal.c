@@ -0,0 +1,431 @@
+/******************************************************************************
+* File Name: sim_journal.c
+*
+* Description: This file contains the brown-out journal scenario of the host simulator.
+*              Every boot ends with ranges appended to the journal of eeprom_journal.c
+*              instead of written, as the brown-out interrupt saves them, and the next
+*              boot checks that the lazy initialization of eeprom_io.c replays them,
+*              also after a power loss during an append or during the replay.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "eeprom_io.h"
+#include "eeprom_journal.h"
+#include "eeprom_status.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Two rows of logical data. The redundant copies let the initialization
+ * recover from a row that a power loss left partially programmed.
+ */
+#define SIM_JOURNAL_SIZE                (2u * CY_EM_EEPROM_EEPROM_DATA_LEN(0u))
+#define SIM_JOURNAL_WEAR_LEVELLING      (2u)
+#define SIM_JOURNAL_AREA_SIZE           (CY_EM_EEPROM_GET_PHYSICAL_SIZE(SIM_JOURNAL_SIZE, 0u, \
+                                         SIM_JOURNAL_WEAR_LEVELLING, 1u))
+
+/* Writes within one row before the brown-out, and ranges appended at it. A
+ * range longer than EEPROM_JOURNAL_RECORD_DATA_SIZE takes two records; the
+ * appends of a boot take at most 448 of the 512 bytes of the row.
+ */
+#define SIM_JOURNAL_WRITES_PER_BOOT     (2u)
+#define SIM_JOURNAL_MAX_WRITE_SIZE      (48u)
+#define SIM_JOURNAL_APPENDS_PER_BOOT    (4u)
+#define SIM_JOURNAL_MAX_RANGE_SIZE      (96u)
+
+/* Number of errors printed before the rest are only counted. */
+#define SIM_JOURNAL_MAX_REPORTED_ERRORS (10u)
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+/* What the boot was doing when the supply was cut. */
+typedef enum
+{
+    /* Lazy initialization, including the replay. */
+    SIM_JOURNAL_PHASE_INIT,
+    /* Writing through the access layer. */
+    SIM_JOURNAL_PHASE_WRITE,
+    /* Programming an appended range into the journal row. */
+    SIM_JOURNAL_PHASE_APPEND,
+    SIM_JOURNAL_PHASE_COUNT,
+} sim_journal_phase_t;
+
+typedef struct
+{
+    uint64_t completed;
+    uint64_t power_losses[SIM_JOURNAL_PHASE_COUNT];
+    uint64_t halts;
+    uint64_t appends;
+    /* Boots whose first access found records to replay. */
+    uint64_t replays;
+    /* Boots that read back anything but the data written before plus the
+     * ranges appended completely, and any records of the range whose append
+     * was cut.
+     */
+    uint64_t data_errors;
+    /* Boots whose journal held records after the first access. */
+    uint64_t replay_errors;
+} sim_journal_results_t;
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_journal_area[SIM_JOURNAL_AREA_SIZE] = {0u};
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_journal_row[EEPROM_JOURNAL_AREA_SIZE] = {0u};
+
+static cy_stc_eeprom_config_t sim_journal_config =
+{
+    .eepromSize = SIM_JOURNAL_SIZE,
+    .blockingWrite = 1u,
+    .redundantCopy = 1u,
+    .wearLevelingFactor = SIM_JOURNAL_WEAR_LEVELLING,
+    .simpleMode = 0u,
+};
+
+/* The state below is kept in RAM across the simulated boots. */
+static cy_stc_eeprom_context_t sim_journal_context;
+static eeprom_journal_t sim_journal;
+static sim_journal_results_t sim_journal_results;
+static uint64_t sim_journal_boots;
+static uint32_t sim_journal_random_state;
+static sim_journal_phase_t sim_journal_phase;
+/* Content of the instance, and that content with the appended ranges
+ * applied oldest first. The range in flight is a write, or an append of which
+ * a leading part of its records may have been programmed before the cut.
+ */
+static uint8_t sim_journal_stored[SIM_JOURNAL_SIZE];
+static uint8_t sim_journal_expected[SIM_JOURNAL_SIZE];
+static bool sim_journal_in_flight;
+static bool sim_journal_flight_append;
+static uint32_t sim_journal_flight_addr;
+static uint32_t sim_journal_flight_size;
+static uint8_t sim_journal_flight_data[SIM_JOURNAL_MAX_RANGE_SIZE];
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static int sim_journal_boot(void);
+static void sim_journal_check(void);
+static void sim_journal_range(uint32_t max_size, bool in_row);
+static void sim_journal_error(uint64_t *errors, const char *message);
+static uint32_t sim_journal_random(void);
+
+
+/*******************************************************************************
+* Function Name: sim_journal_run
+********************************************************************************
+*
+* Summary:
+* Runs the brown-out journal scenario for a number of simulated boots. Every
+* boot defers the initialization of the instance with eeprom_io_lazy_init(),
+* attaches the journal, reads the instance and checks the replay, writes
+* SIM_JOURNAL_WRITES_PER_BOOT ranges and appends
+* SIM_JOURNAL_APPENDS_PER_BOOT others with eeprom_journal_append(), after
+* which the supply is cut.
+*
+* Parameters:
+* uint64_t cycles: number of boots.
+* uint32_t seed: seed of the ranges and the data.
+*
+* Return:
+* EXIT_SUCCESS if no check failed.
+*
+*******************************************************************************/
+int sim_journal_run(uint64_t cycles, uint32_t seed)
+{
+    sim_journal_random_state = (0u != seed) ? seed : 1u;
+    sim_journal_config.userFlashStartAddr = (uint32_t) (uintptr_t) sim_journal_area;
+
+    for(sim_journal_boots = 0u; sim_journal_boots < cycles; sim_journal_boots++)
+    {
+        uint32_t status;
+        sim_stop_t reason;
+
+        sim_journal_phase = SIM_JOURNAL_PHASE_INIT;
+        reason = sim_boot(sim_journal_boot, &status);
+        /* Every boot ends with the supply cut. */
+        sim_board_reset(true);
+
+        switch(reason)
+        {
+            case SIM_STOP_NONE:
+                sim_journal_results.completed++;
+                break;
+
+            case SIM_STOP_POWER_LOSS:
+                sim_journal_results.power_losses[sim_journal_phase]++;
+                break;
+
+            default:
+                if(sim_journal_results.halts < SIM_JOURNAL_MAX_REPORTED_ERRORS)
+                {
+                    printf("journal boot %llu: halted with status 0x%lx\n",
+                           (unsigned long long) sim_journal_boots, (unsigned long) status);
+                }
+                sim_journal_results.halts++;
+                sim_flash_format();
+                memset(sim_journal_stored, 0, sizeof(sim_journal_stored));
+                memset(sim_journal_expected, 0, sizeof(sim_journal_expected));
+                sim_journal_in_flight = false;
+                break;
+        }
+    }
+
+    printf("journal boots:         %llu (%llu completed, %llu halts)\n",
+           (unsigned long long) cycles, (unsigned long long) sim_journal_results.completed,
+           (unsigned long long) sim_journal_results.halts);
+    printf("journal power losses:  %llu in init, %llu in writes, %llu in appends\n",
+           (unsigned long long) sim_journal_results.power_losses[SIM_JOURNAL_PHASE_INIT],
+           (unsigned long long) sim_journal_results.power_losses[SIM_JOURNAL_PHASE_WRITE],
+           (unsigned long long) sim_journal_results.power_losses[SIM_JOURNAL_PHASE_APPEND]);
+    printf("journal operations:    %llu appends, %llu boots replayed them\n",
+           (unsigned long long) sim_journal_results.appends,
+           (unsigned long long) sim_journal_results.replays);
+    printf("journal data errors:   %llu\n", (unsigned long long) sim_journal_results.data_errors);
+    printf("journal replay errors: %llu\n",
+           (unsigned long long) sim_journal_results.replay_errors);
+
+    return (((0u == sim_journal_results.data_errors) &&
+             (0u == sim_journal_results.replay_errors) &&
+             (0u == sim_journal_results.halts)) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_journal_boot
+********************************************************************************
+*
+* Summary:
+* One simulated boot of the scenario.
+*
+*******************************************************************************/
+static int sim_journal_boot(void)
+{
+    cy_en_em_eeprom_status_t status;
+
+    status = eeprom_io_lazy_init(&sim_journal_config, &sim_journal_context);
+    if(!eeprom_status_failed(status))
+    {
+        status = eeprom_journal_init(&sim_journal, &sim_journal_config, &sim_journal_context,
+                                     (uint32_t) (uintptr_t) sim_journal_row);
+    }
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+
+    sim_journal_check();
+
+    sim_journal_phase = SIM_JOURNAL_PHASE_WRITE;
+    for(uint32_t i = 0u; i < SIM_JOURNAL_WRITES_PER_BOOT; i++)
+    {
+        sim_journal_range(SIM_JOURNAL_MAX_WRITE_SIZE, true);
+        status = eeprom_io_write(sim_journal_flight_addr, sim_journal_flight_data,
+                                 sim_journal_flight_size, &sim_journal_context);
+        if(eeprom_status_failed(status))
+        {
+            sim_stop(SIM_STOP_HALT, (uint32_t) status);
+        }
+        memcpy(&sim_journal_stored[sim_journal_flight_addr], sim_journal_flight_data,
+               sim_journal_flight_size);
+        memcpy(sim_journal_expected, sim_journal_stored, SIM_JOURNAL_SIZE);
+        sim_journal_in_flight = false;
+    }
+
+    /* The brown-out: the ranges are saved to the journal and not written. */
+    sim_journal_phase = SIM_JOURNAL_PHASE_APPEND;
+    for(uint32_t i = 0u; i < SIM_JOURNAL_APPENDS_PER_BOOT; i++)
+    {
+        sim_journal_range(SIM_JOURNAL_MAX_RANGE_SIZE, false);
+        status = eeprom_journal_append(&sim_journal, sim_journal_flight_addr,
+                                       sim_journal_flight_data, sim_journal_flight_size);
+        if(eeprom_status_failed(status))
+        {
+            sim_stop(SIM_STOP_HALT, (uint32_t) status);
+        }
+        memcpy(&sim_journal_expected[sim_journal_flight_addr], sim_journal_flight_data,
+               sim_journal_flight_size);
+        sim_journal_in_flight = false;
+        sim_journal_results.appends++;
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_journal_check
+********************************************************************************
+*
+* Summary:
+* Reads the instance through the access layer, whose first access runs the
+* deferred initialization and the replay, and compares it with the expected
+* content. After a cut write, the instance may hold the data before the
+* write; after a cut append, any leading records of the range.
+*
+*******************************************************************************/
+static void sim_journal_check(void)
+{
+    uint8_t data[SIM_JOURNAL_SIZE];
+    uint8_t candidate[SIM_JOURNAL_SIZE];
+    cy_en_em_eeprom_status_t status;
+    bool match;
+
+    if(!eeprom_journal_is_empty(&sim_journal))
+    {
+        sim_journal_results.replays++;
+    }
+
+    /* CY_EM_EEPROM_REDUNDANT_COPY_USED is expected after a power loss. */
+    status = eeprom_io_read(0u, data, SIM_JOURNAL_SIZE, &sim_journal_context);
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+
+    memcpy(candidate, sim_journal_expected, SIM_JOURNAL_SIZE);
+    match = (0 == memcmp(data, candidate, SIM_JOURNAL_SIZE));
+    for(uint32_t done = 0u; sim_journal_in_flight && !match && (done < sim_journal_flight_size);)
+    {
+        uint32_t chunk = sim_journal_flight_size - done;
+
+        /* A write is one Em_EEPROM row write; an append applies by records. */
+        if(sim_journal_flight_append && (chunk > EEPROM_JOURNAL_RECORD_DATA_SIZE))
+        {
+            chunk = EEPROM_JOURNAL_RECORD_DATA_SIZE;
+        }
+        memcpy(&candidate[sim_journal_flight_addr + done], &sim_journal_flight_data[done], chunk);
+        done += chunk;
+        match = (0 == memcmp(data, candidate, SIM_JOURNAL_SIZE));
+    }
+    if(!match)
+    {
+        sim_journal_error(&sim_journal_results.data_errors,
+                          (0 == memcmp(data, sim_journal_stored, SIM_JOURNAL_SIZE)) ?
+                          "journal not replayed" : "unexpected content");
+    }
+
+    if(!eeprom_journal_is_empty(&sim_journal))
+    {
+        sim_journal_error(&sim_journal_results.replay_errors, "journal kept after the replay");
+    }
+
+    /* Continue from what the instance holds, so that one error is counted once. */
+    memcpy(sim_journal_stored, data, SIM_JOURNAL_SIZE);
+    memcpy(sim_journal_expected, data, SIM_JOURNAL_SIZE);
+    sim_journal_in_flight = false;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_journal_range
+********************************************************************************
+*
+* Summary:
+* Draws the range in flight with random data: a write within one row of
+* logical data if in_row is set, an append otherwise.
+*
+*******************************************************************************/
+static void sim_journal_range(uint32_t max_size, bool in_row)
+{
+    uint32_t row_size = CY_EM_EEPROM_EEPROM_DATA_LEN(0u);
+    uint32_t addr = sim_journal_random() % SIM_JOURNAL_SIZE;
+    uint32_t size = 1u + (sim_journal_random() % max_size);
+    uint32_t end = in_row ? (((addr / row_size) + 1u) * row_size) : SIM_JOURNAL_SIZE;
+
+    if(size > (end - addr))
+    {
+        size = end - addr;
+    }
+    for(uint32_t i = 0u; i < size; i++)
+    {
+        sim_journal_flight_data[i] = (uint8_t) sim_journal_random();
+    }
+    sim_journal_flight_append = !in_row;
+    sim_journal_flight_addr = addr;
+    sim_journal_flight_size = size;
+    sim_journal_in_flight = true;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_journal_error
+********************************************************************************
+*
+* Summary:
+* Counts an error and prints the first SIM_JOURNAL_MAX_REPORTED_ERRORS of its
+* kind.
+*
+*******************************************************************************/
+static void sim_journal_error(uint64_t *errors, const char *message)
+{
+    if(*errors < SIM_JOURNAL_MAX_REPORTED_ERRORS)
+    {
+        printf("journal boot %llu: %s\n", (unsigned long long) sim_journal_boots, message);
+    }
+    (*errors)++;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_journal_random
+********************************************************************************
+*
+* Summary:
+* xorshift32, separate from the fault injection of the flash model.
+*
+*******************************************************************************/
+static uint32_t sim_journal_random(void)
+{
+    sim_journal_random_state ^= sim_journal_random_state << 13u;
+    sim_journal_random_state ^= sim_journal_random_state >> 17u;
+    sim_journal_random_state ^= sim_journal_random_state << 5u;
+    return sim_journal_random_state;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,418 @@
+/******************************************************************************
+* File Name: sim_kv.c
+*
+* Description: This file contains the key-value store scenario of the host
+*              simulator. It sets random records of eeprom_kv.c across power cycles,
+*              cuts the supply during the appends and the compactions into the other
+*              bank, and checks the values and the index that eeprom_kv_init()
+*              rebuilds at the next boot.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "eeprom_kv.h"
+#include "eeprom_status.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Two rows of logical data, one bank each. The redundant copy lets
+ * Cy_Em_EEPROM_Init() recover from a row that a power loss left partially
+ * programmed.
+ */
+#define SIM_KV_SIZE                     (2u * CY_EM_EEPROM_EEPROM_DATA_LEN(0u))
+#define SIM_KV_WEAR_LEVELLING           (2u)
+#define SIM_KV_AREA_SIZE                (CY_EM_EEPROM_GET_PHYSICAL_SIZE(SIM_KV_SIZE, 0u, \
+                                         SIM_KV_WEAR_LEVELLING, 1u))
+
+/* Records of the schema. One set of each fills about half a bank, so every
+ * few sets compact the store.
+ */
+#define SIM_KV_KEYS                     (4u)
+#define SIM_KV_MAX_LENGTH               (40u)
+
+/* Sets per boot. */
+#define SIM_KV_SETS_PER_BOOT            (8u)
+
+/* Number of errors printed before the rest are only counted. */
+#define SIM_KV_MAX_REPORTED_ERRORS      (10u)
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+/* What the store was doing when the supply was cut. */
+typedef enum
+{
+    SIM_KV_PHASE_INIT,
+    SIM_KV_PHASE_SET,
+    SIM_KV_PHASE_COMPACT,
+    SIM_KV_PHASE_COUNT,
+} sim_kv_phase_t;
+
+typedef struct
+{
+    uint64_t completed;
+    uint64_t power_losses[SIM_KV_PHASE_COUNT];
+    uint64_t halts;
+    uint64_t sets;
+    uint64_t compactions;
+    /* Reboots that read back anything but the last value set, or the value
+     * of the set in flight.
+     */
+    uint64_t data_errors;
+    /* Reboots after a completed boot whose rebuilt index differs from the
+     * one the store ended that boot with.
+     */
+    uint64_t index_errors;
+} sim_kv_results_t;
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_kv_area[SIM_KV_AREA_SIZE] = {0u};
+
+static cy_stc_eeprom_config_t sim_kv_config =
+{
+    .eepromSize = SIM_KV_SIZE,
+    .blockingWrite = 1u,
+    .redundantCopy = 1u,
+    .wearLevelingFactor = SIM_KV_WEAR_LEVELLING,
+    .simpleMode = 0u,
+};
+
+static const uint8_t sim_kv_defaults[SIM_KV_MAX_LENGTH] = {0u};
+
+static const eeprom_kv_record_t sim_kv_schema[SIM_KV_KEYS] =
+{
+    { 0u, 1u, 8u,  sim_kv_defaults },
+    { 1u, 1u, 16u, sim_kv_defaults },
+    { 2u, 2u, 24u, sim_kv_defaults },
+    { 3u, 1u, 40u, sim_kv_defaults },
+};
+
+/* The state below is kept in RAM across the simulated boots. */
+static cy_stc_eeprom_context_t sim_kv_context;
+static eeprom_kv_t sim_kv;
+static sim_kv_results_t sim_kv_results;
+static sim_kv_phase_t sim_kv_phase;
+static uint64_t sim_kv_boots;
+static uint32_t sim_kv_random_state;
+/* Value of every key after the last set that returned, and the key and value
+ * of the set in flight. After a power loss, the key may read back either.
+ */
+static uint8_t sim_kv_committed[SIM_KV_KEYS][SIM_KV_MAX_LENGTH];
+static uint8_t sim_kv_pending[SIM_KV_MAX_LENGTH];
+static uint32_t sim_kv_pending_key;
+static bool sim_kv_in_flight;
+/* The store at the end of the last boot, if that boot completed. */
+static eeprom_kv_t sim_kv_expected;
+static bool sim_kv_expected_valid;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static int sim_kv_boot(void);
+static void sim_kv_check(void);
+static void sim_kv_check_index(void);
+static void sim_kv_set(void);
+static uint32_t sim_kv_random(void);
+
+
+/*******************************************************************************
+* Function Name: sim_kv_run
+********************************************************************************
+*
+* Summary:
+* Runs the key-value store scenario for a number of simulated boots. Every
+* boot opens the instance and the store, checks the rebuilt index and the
+* value of every key, and sets SIM_KV_SETS_PER_BOOT random records. A set
+* that does not fit into the active bank compacts the store into the other
+* bank first; a power loss during that copy must leave the old bank in use.
+*
+* Parameters:
+* uint64_t cycles: number of boots.
+* uint32_t seed: seed of the written data.
+*
+* Return:
+* EXIT_SUCCESS if no check failed.
+*
+*******************************************************************************/
+int sim_kv_run(uint64_t cycles, uint32_t seed)
+{
+    sim_kv_random_state = (0u != seed) ? seed : 1u;
+    sim_kv_config.userFlashStartAddr = (uint32_t) (uintptr_t) sim_kv_area;
+
+    for(sim_kv_boots = 0u; sim_kv_boots < cycles; sim_kv_boots++)
+    {
+        uint32_t status;
+        sim_stop_t reason;
+
+        sim_kv_phase = SIM_KV_PHASE_INIT;
+        reason = sim_boot(sim_kv_boot, &status);
+
+        switch(reason)
+        {
+            case SIM_STOP_NONE:
+                sim_kv_results.completed++;
+                sim_kv_expected = sim_kv;
+                sim_kv_expected_valid = true;
+                break;
+
+            case SIM_STOP_POWER_LOSS:
+                sim_kv_results.power_losses[sim_kv_phase]++;
+                sim_kv_expected_valid = false;
+                break;
+
+            default:
+                if(sim_kv_results.halts < SIM_KV_MAX_REPORTED_ERRORS)
+                {
+                    printf("kv boot %llu: halted with status 0x%lx\n",
+                           (unsigned long long) sim_kv_boots, (unsigned long) status);
+                }
+                sim_kv_results.halts++;
+                sim_flash_format();
+                memset(sim_kv_committed, 0, sizeof(sim_kv_committed));
+                sim_kv_in_flight = false;
+                sim_kv_expected_valid = false;
+                break;
+        }
+    }
+
+    printf("kv boots:        %llu (%llu completed, %llu halts)\n",
+           (unsigned long long) cycles, (unsigned long long) sim_kv_results.completed,
+           (unsigned long long) sim_kv_results.halts);
+    printf("kv power losses: %llu in init, %llu in sets, %llu in compactions\n",
+           (unsigned long long) sim_kv_results.power_losses[SIM_KV_PHASE_INIT],
+           (unsigned long long) sim_kv_results.power_losses[SIM_KV_PHASE_SET],
+           (unsigned long long) sim_kv_results.power_losses[SIM_KV_PHASE_COMPACT]);
+    printf("kv operations:   %llu sets, %llu compactions\n",
+           (unsigned long long) sim_kv_results.sets,
+           (unsigned long long) sim_kv_results.compactions);
+    printf("kv data errors:  %llu\n", (unsigned long long) sim_kv_results.data_errors);
+    printf("kv index errors: %llu\n", (unsigned long long) sim_kv_results.index_errors);
+
+    return (((0u == sim_kv_results.data_errors) && (0u == sim_kv_results.index_errors) &&
+             (0u == sim_kv_results.halts) && (0u != sim_kv_results.compactions)) ?
+            EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_kv_boot
+********************************************************************************
+*
+* Summary:
+* One simulated boot of the scenario.
+*
+*******************************************************************************/
+static int sim_kv_boot(void)
+{
+    cy_en_em_eeprom_status_t status;
+
+    /* CY_EM_EEPROM_REDUNDANT_COPY_USED is expected after a power loss. An
+     * erased store is filled with the defaults, which a power loss can cut.
+     */
+    status = Cy_Em_EEPROM_Init(&sim_kv_config, &sim_kv_context);
+    if(!eeprom_status_failed(status))
+    {
+        status = eeprom_kv_init(&sim_kv, &sim_kv_context, 0u, SIM_KV_SIZE,
+                                sim_kv_schema, SIM_KV_KEYS);
+    }
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_kv_check_index();
+    sim_kv_check();
+
+    for(uint32_t i = 0u; i < SIM_KV_SETS_PER_BOOT; i++)
+    {
+        sim_kv_set();
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_kv_check
+********************************************************************************
+*
+* Summary:
+* Reads every key and compares it with the last value set. The key of the set
+* in flight at the power loss may hold its new value as well.
+*
+*******************************************************************************/
+static void sim_kv_check(void)
+{
+    uint8_t data[SIM_KV_MAX_LENGTH];
+    cy_en_em_eeprom_status_t status;
+
+    for(uint32_t key = 0u; key < SIM_KV_KEYS; key++)
+    {
+        uint32_t length = sim_kv_schema[key].length;
+
+        status = eeprom_kv_get(&sim_kv, (uint8_t) key, data, length);
+        if(eeprom_status_failed(status))
+        {
+            sim_stop(SIM_STOP_HALT, (uint32_t) status);
+        }
+
+        if((0 != memcmp(data, sim_kv_committed[key], length)) &&
+           (!sim_kv_in_flight || (key != sim_kv_pending_key) ||
+            (0 != memcmp(data, sim_kv_pending, length))))
+        {
+            if(sim_kv_results.data_errors < SIM_KV_MAX_REPORTED_ERRORS)
+            {
+                printf("kv boot %llu: key %lu reads 0x%02x.., set 0x%02x..\n",
+                       (unsigned long long) sim_kv_boots, (unsigned long) key,
+                       data[0], sim_kv_committed[key][0]);
+            }
+            sim_kv_results.data_errors++;
+        }
+
+        /* Continue from what the store holds, so that one error is counted once. */
+        memcpy(sim_kv_committed[key], data, length);
+    }
+
+    sim_kv_in_flight = false;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_kv_check_index
+********************************************************************************
+*
+* Summary:
+* After a completed boot, the flash holds exactly what the store had indexed,
+* so eeprom_kv_init() must rebuild the same bank, sequence numbers, end and
+* index.
+*
+*******************************************************************************/
+static void sim_kv_check_index(void)
+{
+    if(!sim_kv_expected_valid)
+    {
+        return;
+    }
+
+    if((sim_kv.bank != sim_kv_expected.bank) ||
+       (sim_kv.sequence != sim_kv_expected.sequence) ||
+       (sim_kv.last_sequence != sim_kv_expected.last_sequence) ||
+       (sim_kv.end != sim_kv_expected.end) ||
+       (0 != memcmp(sim_kv.index, sim_kv_expected.index, sizeof(sim_kv.index))) ||
+       (0 != memcmp(sim_kv.length, sim_kv_expected.length, sizeof(sim_kv.length))) ||
+       (0 != memcmp(sim_kv.version, sim_kv_expected.version, sizeof(sim_kv.version))))
+    {
+        if(sim_kv_results.index_errors < SIM_KV_MAX_REPORTED_ERRORS)
+        {
+            printf("kv boot %llu: rebuilt bank %lu end %lu, expected bank %lu end %lu\n",
+                   (unsigned long long) sim_kv_boots, (unsigned long) sim_kv.bank,
+                   (unsigned long) sim_kv.end, (unsigned long) sim_kv_expected.bank,
+                   (unsigned long) sim_kv_expected.end);
+        }
+        sim_kv_results.index_errors++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_kv_set
+********************************************************************************
+*
+* Summary:
+* Sets a random key to random data.
+*
+*******************************************************************************/
+static void sim_kv_set(void)
+{
+    uint32_t key = sim_kv_random() % SIM_KV_KEYS;
+    uint32_t length = sim_kv_schema[key].length;
+    cy_en_em_eeprom_status_t status;
+    /* The record does not fit behind the last one of the active bank. */
+    bool compact = ((sim_kv.end + EEPROM_KV_HEADER_SIZE + length) >
+                    (sim_kv.bank + (SIM_KV_SIZE / 2u)));
+
+    for(uint32_t i = 0u; i < length; i++)
+    {
+        sim_kv_pending[i] = (uint8_t) sim_kv_random();
+    }
+    sim_kv_pending_key = key;
+    sim_kv_in_flight = true;
+    sim_kv_phase = compact ? SIM_KV_PHASE_COMPACT : SIM_KV_PHASE_SET;
+
+    status = eeprom_kv_set(&sim_kv, (uint8_t) key, sim_kv_pending, length);
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_kv_in_flight = false;
+
+    memcpy(sim_kv_committed[key], sim_kv_pending, length);
+    sim_kv_results.sets++;
+    if(compact)
+    {
+        sim_kv_results.compactions++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_kv_random
+********************************************************************************
+*
+* Summary:
+* xorshift32, separate from the fault injection of the flash model.
+*
+*******************************************************************************/
+static uint32_t sim_kv_random(void)
+{
+    sim_kv_random_state ^= sim_kv_random_state << 13u;
+    sim_kv_random_state ^= sim_kv_random_state >> 17u;
+    sim_kv_random_state ^= sim_kv_random_state << 5u;
+    return sim_kv_random_state;
+}
+
+
+/* [] END OF FILE */
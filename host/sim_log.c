@@ -0,0 +1,421 @@
+/******************************************************************************
+* File Name: sim_log.c
+*
+* Description: This file contains the log scenario of the host simulator. It
+*              cuts the supply while eeprom_log.c appends records and while it
+*              compacts rows, checks after every reboot that the log reads back
+*              the last committed data, and checks that eeprom_log_gc_step()
+*              stays within its budget and spares the writes the compaction.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "eeprom_log.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Sixteen pages in the fewest rows the size allows. With no row to spare,
+ * the writes that open the last free row compact, and a power loss during
+ * that copy leaves the rollback to eeprom_log_init().
+ */
+#define SIM_LOG_SIZE                    (512u)
+#define SIM_LOG_ROWS                    (EEPROM_LOG_MIN_ROWS(SIM_LOG_SIZE))
+#define SIM_LOG_PAGES                   (SIM_LOG_SIZE / EEPROM_LOG_PAGE_SIZE)
+
+/* Writes per boot. Each changes a random range of one page, so it appends a
+ * single record and is either committed completely or not at all.
+ */
+#define SIM_LOG_WRITES_PER_BOOT         (16u)
+
+/* Slice of eeprom_log_gc_step() on the boots that run the compaction to the
+ * end between two writes, and the longest random slice on the other boots.
+ */
+#define SIM_LOG_GC_SLICE_MS             (20u)
+#define SIM_LOG_GC_MAX_SLICE_MS         (30u)
+
+/* Number of errors printed before the rest are only counted. */
+#define SIM_LOG_MAX_REPORTED_ERRORS     (10u)
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+/* What the log was doing when the supply was cut. */
+typedef enum
+{
+    SIM_LOG_PHASE_INIT,
+    SIM_LOG_PHASE_WRITE,
+    SIM_LOG_PHASE_GC,
+    SIM_LOG_PHASE_COUNT,
+} sim_log_phase_t;
+
+typedef struct
+{
+    uint64_t completed;
+    uint64_t power_losses[SIM_LOG_PHASE_COUNT];
+    uint64_t halts;
+    uint64_t writes;
+    uint64_t gc_steps;
+    /* Reboots that read back anything but the last committed data. */
+    uint64_t data_errors;
+    /* Steps that kept the flash busy for longer than their budget. */
+    uint64_t budget_errors;
+    /* Writes that erased or programmed more than one row although the
+     * compaction had run to the end before them.
+     */
+    uint64_t compaction_errors;
+} sim_log_results_t;
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_log_area[SIM_LOG_ROWS * CY_FLASH_SIZEOF_ROW] = {0u};
+
+/* The state below is kept in RAM across the simulated boots. */
+static eeprom_log_t sim_log;
+static sim_log_results_t sim_log_results;
+static sim_log_phase_t sim_log_phase;
+static uint64_t sim_log_boots;
+static uint32_t sim_log_random_state;
+/* Content of the last write that returned, and that content with the write
+ * in flight applied. After a power loss, the log must read back one of them.
+ */
+static uint8_t sim_log_committed[SIM_LOG_SIZE];
+static uint8_t sim_log_pending[SIM_LOG_SIZE];
+static bool sim_log_in_flight;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static int sim_log_boot(void);
+static void sim_log_check(void);
+static void sim_log_write(bool gc_done);
+static bool sim_log_gc_step(uint32_t budget_ms);
+static uint32_t sim_log_random(void);
+
+
+/*******************************************************************************
+* Function Name: sim_log_run
+********************************************************************************
+*
+* Summary:
+* Runs the log scenario for a number of simulated boots. Every boot opens the
+* log, checks its content and issues SIM_LOG_WRITES_PER_BOOT writes. Between
+* two writes, even boots run the compaction to the end in slices of
+* SIM_LOG_GC_SLICE_MS, so each write must cost a single row program. Every
+* other odd boot gives it one random slice, which may leave work to the
+* writes, and the remaining boots do not run it at all, so that the writes
+* compact the rows themselves.
+*
+* Parameters:
+* uint64_t cycles: number of boots.
+* uint32_t seed: seed of the written data and the slices.
+*
+* Return:
+* EXIT_SUCCESS if no check failed.
+*
+*******************************************************************************/
+int sim_log_run(uint64_t cycles, uint32_t seed)
+{
+    sim_log_random_state = (0u != seed) ? seed : 1u;
+
+    for(sim_log_boots = 0u; sim_log_boots < cycles; sim_log_boots++)
+    {
+        uint32_t status;
+        sim_stop_t reason;
+
+        sim_log_phase = SIM_LOG_PHASE_INIT;
+        reason = sim_boot(sim_log_boot, &status);
+
+        switch(reason)
+        {
+            case SIM_STOP_NONE:
+                sim_log_results.completed++;
+                break;
+
+            case SIM_STOP_POWER_LOSS:
+                sim_log_results.power_losses[sim_log_phase]++;
+                break;
+
+            default:
+                if(sim_log_results.halts < SIM_LOG_MAX_REPORTED_ERRORS)
+                {
+                    printf("log boot %llu: halted with status 0x%lx\n",
+                           (unsigned long long) sim_log_boots, (unsigned long) status);
+                }
+                sim_log_results.halts++;
+                sim_flash_format();
+                memset(sim_log_committed, 0, sizeof(sim_log_committed));
+                sim_log_in_flight = false;
+                break;
+        }
+    }
+
+    printf("log boots:         %llu (%llu completed, %llu halts)\n",
+           (unsigned long long) cycles, (unsigned long long) sim_log_results.completed,
+           (unsigned long long) sim_log_results.halts);
+    printf("log power losses:  %llu in init, %llu in writes, %llu in compaction\n",
+           (unsigned long long) sim_log_results.power_losses[SIM_LOG_PHASE_INIT],
+           (unsigned long long) sim_log_results.power_losses[SIM_LOG_PHASE_WRITE],
+           (unsigned long long) sim_log_results.power_losses[SIM_LOG_PHASE_GC]);
+    printf("log operations:    %llu writes, %llu compaction steps\n",
+           (unsigned long long) sim_log_results.writes,
+           (unsigned long long) sim_log_results.gc_steps);
+    printf("log data errors:   %llu\n", (unsigned long long) sim_log_results.data_errors);
+    printf("log budget errors: %llu\n", (unsigned long long) sim_log_results.budget_errors);
+    printf("log write errors:  %llu writes paid for the compaction\n",
+           (unsigned long long) sim_log_results.compaction_errors);
+
+    return (((0u == sim_log_results.data_errors) && (0u == sim_log_results.budget_errors) &&
+             (0u == sim_log_results.compaction_errors) && (0u == sim_log_results.halts)) ?
+            EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_log_boot
+********************************************************************************
+*
+* Summary:
+* One simulated boot of the scenario.
+*
+*******************************************************************************/
+static int sim_log_boot(void)
+{
+    uint32_t mode = (uint32_t) (sim_log_boots % 4u);
+    cy_en_em_eeprom_status_t status;
+
+    status = eeprom_log_init(&sim_log, (uint32_t) (uintptr_t) sim_log_area, SIM_LOG_ROWS,
+                             SIM_LOG_SIZE);
+    if(CY_EM_EEPROM_SUCCESS != status)
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_log_check();
+
+    for(uint32_t i = 0u; i < SIM_LOG_WRITES_PER_BOOT; i++)
+    {
+        bool gc_done = false;
+
+        if(0u == (mode % 2u))
+        {
+            while(sim_log_gc_step(SIM_LOG_GC_SLICE_MS))
+            {
+            }
+            gc_done = true;
+        }
+        else if(1u == mode)
+        {
+            (void) sim_log_gc_step(sim_log_random() % (SIM_LOG_GC_MAX_SLICE_MS + 1u));
+        }
+        else
+        {
+            /* No compaction. */
+        }
+        sim_log_write(gc_done);
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_log_check
+********************************************************************************
+*
+* Summary:
+* Compares the content of the log after a boot with the last committed data.
+* The write that was in flight at the power loss may have been committed as
+* well.
+*
+*******************************************************************************/
+static void sim_log_check(void)
+{
+    uint8_t data[SIM_LOG_SIZE];
+
+    (void) eeprom_log_read(&sim_log, 0u, data, SIM_LOG_SIZE);
+
+    if((0 != memcmp(data, sim_log_committed, SIM_LOG_SIZE)) &&
+       (!sim_log_in_flight || (0 != memcmp(data, sim_log_pending, SIM_LOG_SIZE))))
+    {
+        if(sim_log_results.data_errors < SIM_LOG_MAX_REPORTED_ERRORS)
+        {
+            uint32_t offset = 0u;
+
+            while(data[offset] == sim_log_committed[offset])
+            {
+                offset++;
+            }
+            printf("log boot %llu: byte %lu reads 0x%02x, committed 0x%02x\n",
+                   (unsigned long long) sim_log_boots, (unsigned long) offset,
+                   data[offset], sim_log_committed[offset]);
+        }
+        sim_log_results.data_errors++;
+    }
+
+    /* Continue from what the log holds, so that one error is counted once. */
+    memcpy(sim_log_committed, data, SIM_LOG_SIZE);
+    sim_log_in_flight = false;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_log_write
+********************************************************************************
+*
+* Summary:
+* Writes random data to a random range of one page.
+*
+* Parameters:
+* bool gc_done: the compaction had no work left, so the write must not erase
+*  and must program at most one row.
+*
+*******************************************************************************/
+static void sim_log_write(bool gc_done)
+{
+    uint32_t page = sim_log_random() % SIM_LOG_PAGES;
+    uint32_t offset = sim_log_random() % EEPROM_LOG_PAGE_SIZE;
+    uint32_t size = 1u + (sim_log_random() % (EEPROM_LOG_PAGE_SIZE - offset));
+    uint32_t addr = (page * EEPROM_LOG_PAGE_SIZE) + offset;
+    sim_flash_stats_t before;
+    sim_flash_stats_t after;
+    cy_en_em_eeprom_status_t status;
+
+    memcpy(sim_log_pending, sim_log_committed, SIM_LOG_SIZE);
+    for(uint32_t i = 0u; i < size; i++)
+    {
+        sim_log_pending[addr + i] = (uint8_t) sim_log_random();
+    }
+
+    sim_log_in_flight = true;
+    sim_log_phase = SIM_LOG_PHASE_WRITE;
+    sim_flash_get_stats(&before);
+    status = eeprom_log_write(&sim_log, addr, &sim_log_pending[addr], size);
+    sim_flash_get_stats(&after);
+    if(CY_EM_EEPROM_SUCCESS != status)
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    memcpy(sim_log_committed, sim_log_pending, SIM_LOG_SIZE);
+    sim_log_in_flight = false;
+    sim_log_results.writes++;
+
+    if(gc_done && ((after.erases != before.erases) || ((after.programs - before.programs) > 1u)))
+    {
+        if(sim_log_results.compaction_errors < SIM_LOG_MAX_REPORTED_ERRORS)
+        {
+            printf("log boot %llu: write took %llu erases and %llu programs\n",
+                   (unsigned long long) sim_log_boots,
+                   (unsigned long long) (after.erases - before.erases),
+                   (unsigned long long) (after.programs - before.programs));
+        }
+        sim_log_results.compaction_errors++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_log_gc_step
+********************************************************************************
+*
+* Summary:
+* Runs one compaction step and checks that the flash was busy for no longer
+* than the budget.
+*
+* Parameters:
+* uint32_t budget_ms: budget of the step.
+*
+* Return:
+* True if the compaction has work left.
+*
+*******************************************************************************/
+static bool sim_log_gc_step(uint32_t budget_ms)
+{
+    sim_flash_stats_t before;
+    sim_flash_stats_t after;
+    cy_en_em_eeprom_status_t status;
+
+    sim_log_phase = SIM_LOG_PHASE_GC;
+    sim_flash_get_stats(&before);
+    status = eeprom_log_gc_step(&sim_log, budget_ms);
+    sim_flash_get_stats(&after);
+    if(CY_EM_EEPROM_SUCCESS != status)
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_log_results.gc_steps++;
+
+    if((after.busy_us - before.busy_us) > ((uint64_t) budget_ms * 1000u))
+    {
+        if(sim_log_results.budget_errors < SIM_LOG_MAX_REPORTED_ERRORS)
+        {
+            printf("log boot %llu: compaction step of %lu ms kept the flash busy for %llu us\n",
+                   (unsigned long long) sim_log_boots, (unsigned long) budget_ms,
+                   (unsigned long long) (after.busy_us - before.busy_us));
+        }
+        sim_log_results.budget_errors++;
+    }
+
+    return eeprom_log_gc_pending(&sim_log);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_log_random
+********************************************************************************
+*
+* Summary:
+* xorshift32, separate from the fault injection of the flash model.
+*
+*******************************************************************************/
+static uint32_t sim_log_random(void)
+{
+    sim_log_random_state ^= sim_log_random_state << 13u;
+    sim_log_random_state ^= sim_log_random_state >> 17u;
+    sim_log_random_state ^= sim_log_random_state << 5u;
+    return sim_log_random_state;
+}
+
+
+/* [] END OF FILE */
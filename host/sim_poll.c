@@ -0,0 +1,407 @@
+/******************************************************************************
+* File Name: sim_poll.c
+*
+* Description: This file contains the cache staleness scenario of the host
+*              simulator. It writes to the write-back cache of eeprom_cache.c at
+*              random times, drives eeprom_cache_poll() with a simulated clock,
+*              checks that no data stays dirty for longer than the bound, and cuts
+*              the supply during the flushes that the poll starts.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "eeprom_cache.h"
+#include "eeprom_status.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* One row of logical data. The redundant copy lets Cy_Em_EEPROM_Init()
+ * recover from a row that a power loss left partially programmed.
+ */
+#define SIM_POLL_SIZE                   (CY_EM_EEPROM_EEPROM_DATA_LEN(0u))
+#define SIM_POLL_WEAR_LEVELLING         (2u)
+#define SIM_POLL_AREA_SIZE              (CY_EM_EEPROM_GET_PHYSICAL_SIZE(SIM_POLL_SIZE, 0u, \
+                                         SIM_POLL_WEAR_LEVELLING, 1u))
+
+/* Polls per boot, the largest write, and the longest time between two polls.
+ * A boot covers about eight staleness periods.
+ */
+#define SIM_POLL_STEPS_PER_BOOT         (64u)
+#define SIM_POLL_MAX_WRITE              (16u)
+#define SIM_POLL_MAX_STEP_MS            (EEPROM_CACHE_MAX_STALENESS_MS / 8u)
+
+/* Number of errors printed before the rest are only counted. */
+#define SIM_POLL_MAX_REPORTED_ERRORS    (10u)
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+/* What the scenario was doing when the supply was cut. */
+typedef enum
+{
+    SIM_POLL_PHASE_INIT,
+    SIM_POLL_PHASE_POLL,
+    SIM_POLL_PHASE_COUNT,
+} sim_poll_phase_t;
+
+typedef struct
+{
+    uint64_t completed;
+    uint64_t power_losses[SIM_POLL_PHASE_COUNT];
+    uint64_t halts;
+    uint64_t writes;
+    uint64_t flushes;
+    /* Oldest dirty data a flush wrote, in milliseconds. */
+    uint32_t max_age_ms;
+    /* Reboots that read back anything but the last flushed data. */
+    uint64_t data_errors;
+    /* Polls that left data dirty that an earlier poll had seen dirty
+     * EEPROM_CACHE_MAX_STALENESS_MS before.
+     */
+    uint64_t stale_errors;
+} sim_poll_results_t;
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_poll_area[SIM_POLL_AREA_SIZE] = {0u};
+
+static cy_stc_eeprom_config_t sim_poll_config =
+{
+    .eepromSize = SIM_POLL_SIZE,
+    .blockingWrite = 1u,
+    .redundantCopy = 1u,
+    .wearLevelingFactor = SIM_POLL_WEAR_LEVELLING,
+    .simpleMode = 0u,
+};
+
+/* The state below is kept in RAM across the simulated boots. */
+static cy_stc_eeprom_context_t sim_poll_context;
+static eeprom_cache_t sim_poll_cache;
+static uint8_t sim_poll_image[SIM_POLL_SIZE];
+static sim_poll_results_t sim_poll_results;
+static sim_poll_phase_t sim_poll_phase;
+static uint64_t sim_poll_boots;
+static uint32_t sim_poll_random_state;
+/* Content of the last flush that returned, and the content of the flush in
+ * flight. Em_EEPROM may split a long write, so after a power loss every byte
+ * must read back one of them.
+ */
+static uint8_t sim_poll_committed[SIM_POLL_SIZE];
+static uint8_t sim_poll_pending[SIM_POLL_SIZE];
+static bool sim_poll_in_flight;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static int sim_poll_boot(void);
+static void sim_poll_check(void);
+static void sim_poll_write(void);
+static uint32_t sim_poll_random(void);
+
+
+/*******************************************************************************
+* Function Name: sim_poll_run
+********************************************************************************
+*
+* Summary:
+* Runs the cache staleness scenario for a number of simulated boots. Every
+* boot opens the instance and its cache, checks the content and runs
+* SIM_POLL_STEPS_PER_BOOT steps. A step writes a random range to the cache
+* with a probability of one half, advances the clock by up to
+* SIM_POLL_MAX_STEP_MS and calls eeprom_cache_poll(). No data may stay dirty
+* once a poll has seen it dirty EEPROM_CACHE_MAX_STALENESS_MS before; written
+* between two polls, it is therefore flushed within
+* EEPROM_CACHE_MAX_STALENESS_MS plus one step. The boot ends
+* without a flush, so data that the poll did not write yet is lost with the
+* reset. The clock starts at a random value, so that it also wraps around.
+*
+* Parameters:
+* uint64_t cycles: number of boots.
+* uint32_t seed: seed of the written data and the clock.
+*
+* Return:
+* EXIT_SUCCESS if no check failed.
+*
+*******************************************************************************/
+int sim_poll_run(uint64_t cycles, uint32_t seed)
+{
+    sim_poll_random_state = (0u != seed) ? seed : 1u;
+    sim_poll_config.userFlashStartAddr = (uint32_t) (uintptr_t) sim_poll_area;
+
+    for(sim_poll_boots = 0u; sim_poll_boots < cycles; sim_poll_boots++)
+    {
+        uint32_t status;
+        sim_stop_t reason;
+
+        sim_poll_phase = SIM_POLL_PHASE_INIT;
+        reason = sim_boot(sim_poll_boot, &status);
+
+        switch(reason)
+        {
+            case SIM_STOP_NONE:
+                sim_poll_results.completed++;
+                break;
+
+            case SIM_STOP_POWER_LOSS:
+                sim_poll_results.power_losses[sim_poll_phase]++;
+                break;
+
+            default:
+                if(sim_poll_results.halts < SIM_POLL_MAX_REPORTED_ERRORS)
+                {
+                    printf("poll boot %llu: halted with status 0x%lx\n",
+                           (unsigned long long) sim_poll_boots, (unsigned long) status);
+                }
+                sim_poll_results.halts++;
+                sim_flash_format();
+                memset(sim_poll_committed, 0, sizeof(sim_poll_committed));
+                sim_poll_in_flight = false;
+                break;
+        }
+    }
+
+    printf("poll boots:        %llu (%llu completed, %llu halts)\n",
+           (unsigned long long) cycles, (unsigned long long) sim_poll_results.completed,
+           (unsigned long long) sim_poll_results.halts);
+    printf("poll power losses: %llu in init, %llu in flushes\n",
+           (unsigned long long) sim_poll_results.power_losses[SIM_POLL_PHASE_INIT],
+           (unsigned long long) sim_poll_results.power_losses[SIM_POLL_PHASE_POLL]);
+    printf("poll operations:   %llu writes, %llu flushes, oldest data flushed after %lu ms\n",
+           (unsigned long long) sim_poll_results.writes,
+           (unsigned long long) sim_poll_results.flushes,
+           (unsigned long) sim_poll_results.max_age_ms);
+    printf("poll data errors:  %llu\n", (unsigned long long) sim_poll_results.data_errors);
+    printf("poll stale errors: %llu polls left data dirty for %lu ms after it was seen\n",
+           (unsigned long long) sim_poll_results.stale_errors,
+           (unsigned long) EEPROM_CACHE_MAX_STALENESS_MS);
+
+    return (((0u == sim_poll_results.data_errors) && (0u == sim_poll_results.stale_errors) &&
+             (0u == sim_poll_results.halts)) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_poll_boot
+********************************************************************************
+*
+* Summary:
+* One simulated boot of the scenario.
+*
+*******************************************************************************/
+static int sim_poll_boot(void)
+{
+    cy_en_em_eeprom_status_t status;
+    uint32_t now_ms = sim_poll_random();
+    /* Time of the first write since the last flush, and of the first poll
+     * after it.
+     */
+    uint32_t dirty_since_ms = 0u;
+    uint32_t seen_ms = 0u;
+    bool dirty = false;
+    bool seen = false;
+
+    /* CY_EM_EEPROM_REDUNDANT_COPY_USED is expected after a power loss. */
+    status = Cy_Em_EEPROM_Init(&sim_poll_config, &sim_poll_context);
+    if(!eeprom_status_failed(status))
+    {
+        status = eeprom_cache_init(&sim_poll_cache, &sim_poll_context, 0u, sim_poll_image,
+                                   SIM_POLL_SIZE);
+    }
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_poll_check();
+
+    for(uint32_t i = 0u; i < SIM_POLL_STEPS_PER_BOOT; i++)
+    {
+        if(0u != (sim_poll_random() % 2u))
+        {
+            sim_poll_write();
+            if(!dirty)
+            {
+                dirty = true;
+                seen = false;
+                dirty_since_ms = now_ms;
+            }
+        }
+
+        now_ms += sim_poll_random() % (SIM_POLL_MAX_STEP_MS + 1u);
+        if(dirty && !seen)
+        {
+            seen = true;
+            seen_ms = now_ms;
+        }
+
+        /* The flush writes the whole image; its clean bytes match the flash. */
+        memcpy(sim_poll_pending, sim_poll_image, SIM_POLL_SIZE);
+        sim_poll_in_flight = true;
+        sim_poll_phase = SIM_POLL_PHASE_POLL;
+        status = eeprom_cache_poll(&sim_poll_cache, now_ms);
+        if(eeprom_status_failed(status))
+        {
+            sim_stop(SIM_STOP_HALT, (uint32_t) status);
+        }
+        sim_poll_in_flight = false;
+
+        if(eeprom_cache_is_dirty(&sim_poll_cache))
+        {
+            if((now_ms - seen_ms) >= EEPROM_CACHE_MAX_STALENESS_MS)
+            {
+                if(sim_poll_results.stale_errors < SIM_POLL_MAX_REPORTED_ERRORS)
+                {
+                    printf("poll boot %llu: data dirty for %lu ms after it was seen\n",
+                           (unsigned long long) sim_poll_boots,
+                           (unsigned long) (now_ms - seen_ms));
+                }
+                sim_poll_results.stale_errors++;
+            }
+        }
+        else if(dirty)
+        {
+            memcpy(sim_poll_committed, sim_poll_image, SIM_POLL_SIZE);
+            sim_poll_results.flushes++;
+            if((now_ms - dirty_since_ms) > sim_poll_results.max_age_ms)
+            {
+                sim_poll_results.max_age_ms = now_ms - dirty_since_ms;
+            }
+            dirty = false;
+        }
+        else
+        {
+            /* Nothing was written since the last flush. */
+        }
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_poll_check
+********************************************************************************
+*
+* Summary:
+* Compares the content of the instance after a boot with the last flushed
+* data. The bytes of the flush that was in flight at the power loss may have
+* been committed as well.
+*
+*******************************************************************************/
+static void sim_poll_check(void)
+{
+    for(uint32_t offset = 0u; offset < SIM_POLL_SIZE; offset++)
+    {
+        if((sim_poll_image[offset] != sim_poll_committed[offset]) &&
+           (!sim_poll_in_flight || (sim_poll_image[offset] != sim_poll_pending[offset])))
+        {
+            if(sim_poll_results.data_errors < SIM_POLL_MAX_REPORTED_ERRORS)
+            {
+                printf("poll boot %llu: byte %lu reads 0x%02x, flushed 0x%02x\n",
+                       (unsigned long long) sim_poll_boots, (unsigned long) offset,
+                       sim_poll_image[offset], sim_poll_committed[offset]);
+            }
+            sim_poll_results.data_errors++;
+            break;
+        }
+    }
+
+    /* Continue from what the instance holds, so that one error is counted once. */
+    memcpy(sim_poll_committed, sim_poll_image, SIM_POLL_SIZE);
+    sim_poll_in_flight = false;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_poll_write
+********************************************************************************
+*
+* Summary:
+* Writes random data to a random range of the cache.
+*
+*******************************************************************************/
+static void sim_poll_write(void)
+{
+    uint32_t addr = sim_poll_random() % SIM_POLL_SIZE;
+    uint32_t size = 1u + (sim_poll_random() % SIM_POLL_MAX_WRITE);
+    uint8_t data[SIM_POLL_MAX_WRITE];
+    cy_en_em_eeprom_status_t status;
+
+    if(size > (SIM_POLL_SIZE - addr))
+    {
+        size = SIM_POLL_SIZE - addr;
+    }
+    for(uint32_t i = 0u; i < size; i++)
+    {
+        data[i] = (uint8_t) sim_poll_random();
+    }
+
+    status = eeprom_cache_write(&sim_poll_cache, addr, data, size);
+    if(CY_EM_EEPROM_SUCCESS != status)
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_poll_results.writes++;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_poll_random
+********************************************************************************
+*
+* Summary:
+* xorshift32, separate from the fault injection of the flash model.
+*
+*******************************************************************************/
+static uint32_t sim_poll_random(void)
+{
+    sim_poll_random_state ^= sim_poll_random_state << 13u;
+    sim_poll_random_state ^= sim_poll_random_state >> 17u;
+    sim_poll_random_state ^= sim_poll_random_state << 5u;
+    return sim_poll_random_state;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,484 @@
+/******************************************************************************
+* File Name: sim_stream.c
+*
+* Description: This file contains the blob stream scenario of the host simulator.
+*              It writes random blobs of eeprom_stream.c across several rows in
+*              random chunks, reads each one back, cuts the supply while a blob is
+*              written, and checks that a boot reads the last closed blob, the blob
+*              in flight or no blob, but never a torn one.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "eeprom_status.h"
+#include "eeprom_stream.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Four rows of logical data. The blob starts off a row boundary, so that the
+ * rows the writer buffers start in the middle of the blob.
+ */
+#define SIM_STREAM_SIZE                 (4u * CY_EM_EEPROM_EEPROM_DATA_LEN(0u))
+#define SIM_STREAM_WEAR_LEVELLING       (2u)
+#define SIM_STREAM_AREA_SIZE            (CY_EM_EEPROM_GET_PHYSICAL_SIZE(SIM_STREAM_SIZE, 0u, \
+                                         SIM_STREAM_WEAR_LEVELLING, 1u))
+#define SIM_STREAM_ADDR                 (40u)
+#define SIM_STREAM_CAPACITY             (SIM_STREAM_SIZE - SIM_STREAM_ADDR)
+#define SIM_STREAM_MAX_LENGTH           (SIM_STREAM_CAPACITY - EEPROM_STREAM_HEADER_SIZE)
+
+/* Blobs per boot and the largest chunk passed to a write or a read. */
+#define SIM_STREAM_BLOBS_PER_BOOT       (4u)
+#define SIM_STREAM_MAX_CHUNK            (100u)
+
+/* Number of errors printed before the rest are only counted. */
+#define SIM_STREAM_MAX_REPORTED_ERRORS  (10u)
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+/* What the writer was doing when the supply was cut. */
+typedef enum
+{
+    /* Opening the instance and reading the blob back. */
+    SIM_STREAM_PHASE_INIT,
+    /* Clearing the header in eeprom_stream_write_open(). */
+    SIM_STREAM_PHASE_OPEN,
+    /* Writing the rows of the data. */
+    SIM_STREAM_PHASE_DATA,
+    /* Writing the rest of the data and the header in eeprom_stream_write_close(). */
+    SIM_STREAM_PHASE_CLOSE,
+    SIM_STREAM_PHASE_COUNT,
+} sim_stream_phase_t;
+
+typedef struct
+{
+    uint64_t completed;
+    uint64_t power_losses[SIM_STREAM_PHASE_COUNT];
+    uint64_t halts;
+    uint64_t blobs;
+    /* Blobs that span more than one row of logical data. */
+    uint64_t multi_row;
+    uint64_t bytes;
+    /* Blobs that did not read back as written right after the close. */
+    uint64_t readback_errors;
+    /* Reboots that read back a torn blob, or a blob or its absence that the
+     * step cut does not allow.
+     */
+    uint64_t data_errors;
+} sim_stream_results_t;
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_stream_area[SIM_STREAM_AREA_SIZE] = {0u};
+
+static cy_stc_eeprom_config_t sim_stream_config =
+{
+    .eepromSize = SIM_STREAM_SIZE,
+    .blockingWrite = 1u,
+    .redundantCopy = 1u,
+    .wearLevelingFactor = SIM_STREAM_WEAR_LEVELLING,
+    .simpleMode = 0u,
+};
+
+/* The state below is kept in RAM across the simulated boots. */
+static cy_stc_eeprom_context_t sim_stream_context;
+static eeprom_stream_writer_t sim_stream_writer;
+static sim_stream_results_t sim_stream_results;
+static uint64_t sim_stream_boots;
+static uint32_t sim_stream_random_state;
+/* Last closed blob, which a formatted instance does not hold yet, and the
+ * blob in flight. After a power loss, the instance must hold one of them or
+ * none, depending on the step that was cut.
+ */
+static uint8_t sim_stream_committed[SIM_STREAM_MAX_LENGTH];
+static uint32_t sim_stream_committed_length;
+static bool sim_stream_committed_valid;
+static uint8_t sim_stream_pending[SIM_STREAM_MAX_LENGTH];
+static uint32_t sim_stream_pending_length;
+static bool sim_stream_in_flight;
+/* Phase of the boot, and the step of the blob in flight that a power loss
+ * cut, which a later power loss during the init does not change.
+ */
+static sim_stream_phase_t sim_stream_phase;
+static sim_stream_phase_t sim_stream_cut_phase;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static int sim_stream_boot(void);
+static void sim_stream_check(void);
+static void sim_stream_write(void);
+static cy_en_em_eeprom_status_t sim_stream_read(uint8_t *data, uint32_t *length);
+static void sim_stream_error(uint64_t *errors, const char *message);
+static uint32_t sim_stream_random(void);
+
+
+/*******************************************************************************
+* Function Name: sim_stream_run
+********************************************************************************
+*
+* Summary:
+* Runs the blob stream scenario for a number of simulated boots. Every boot
+* opens the instance, checks the blob stored at SIM_STREAM_ADDR and writes
+* SIM_STREAM_BLOBS_PER_BOOT blobs of random length in random chunks, through
+* eeprom_stream_write() or in place through eeprom_stream_write_reserve().
+* Each blob is read back in random chunks after its close.
+*
+* Parameters:
+* uint64_t cycles: number of boots.
+* uint32_t seed: seed of the lengths, the chunks and the data.
+*
+* Return:
+* EXIT_SUCCESS if no check failed.
+*
+*******************************************************************************/
+int sim_stream_run(uint64_t cycles, uint32_t seed)
+{
+    sim_stream_random_state = (0u != seed) ? seed : 1u;
+    sim_stream_config.userFlashStartAddr = (uint32_t) (uintptr_t) sim_stream_area;
+
+    for(sim_stream_boots = 0u; sim_stream_boots < cycles; sim_stream_boots++)
+    {
+        uint32_t status;
+        sim_stop_t reason;
+
+        sim_stream_phase = SIM_STREAM_PHASE_INIT;
+        reason = sim_boot(sim_stream_boot, &status);
+
+        switch(reason)
+        {
+            case SIM_STOP_NONE:
+                sim_stream_results.completed++;
+                break;
+
+            case SIM_STOP_POWER_LOSS:
+                if(SIM_STREAM_PHASE_INIT != sim_stream_phase)
+                {
+                    sim_stream_cut_phase = sim_stream_phase;
+                }
+                sim_stream_results.power_losses[sim_stream_phase]++;
+                break;
+
+            default:
+                if(sim_stream_results.halts < SIM_STREAM_MAX_REPORTED_ERRORS)
+                {
+                    printf("stream boot %llu: halted with status 0x%lx\n",
+                           (unsigned long long) sim_stream_boots, (unsigned long) status);
+                }
+                sim_stream_results.halts++;
+                sim_flash_format();
+                sim_stream_committed_valid = false;
+                sim_stream_in_flight = false;
+                break;
+        }
+    }
+
+    printf("stream boots:            %llu (%llu completed, %llu halts)\n",
+           (unsigned long long) cycles, (unsigned long long) sim_stream_results.completed,
+           (unsigned long long) sim_stream_results.halts);
+    printf("stream power losses:     %llu in init, %llu in opens, %llu in data, %llu in closes\n",
+           (unsigned long long) sim_stream_results.power_losses[SIM_STREAM_PHASE_INIT],
+           (unsigned long long) sim_stream_results.power_losses[SIM_STREAM_PHASE_OPEN],
+           (unsigned long long) sim_stream_results.power_losses[SIM_STREAM_PHASE_DATA],
+           (unsigned long long) sim_stream_results.power_losses[SIM_STREAM_PHASE_CLOSE]);
+    printf("stream operations:       %llu blobs closed, %llu across rows, %llu bytes\n",
+           (unsigned long long) sim_stream_results.blobs,
+           (unsigned long long) sim_stream_results.multi_row,
+           (unsigned long long) sim_stream_results.bytes);
+    printf("stream read-back errors: %llu\n",
+           (unsigned long long) sim_stream_results.readback_errors);
+    printf("stream data errors:      %llu\n", (unsigned long long) sim_stream_results.data_errors);
+
+    return (((0u == sim_stream_results.data_errors) &&
+             (0u == sim_stream_results.readback_errors) &&
+             (0u == sim_stream_results.halts)) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_stream_boot
+********************************************************************************
+*
+* Summary:
+* One simulated boot of the scenario.
+*
+*******************************************************************************/
+static int sim_stream_boot(void)
+{
+    cy_en_em_eeprom_status_t status;
+
+    /* CY_EM_EEPROM_REDUNDANT_COPY_USED is expected after a power loss. */
+    status = Cy_Em_EEPROM_Init(&sim_stream_config, &sim_stream_context);
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+
+    sim_stream_check();
+
+    for(uint32_t i = 0u; i < SIM_STREAM_BLOBS_PER_BOOT; i++)
+    {
+        sim_stream_write();
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_stream_check
+********************************************************************************
+*
+* Summary:
+* Reads the blob after a boot. A cut open may leave the last closed blob or
+* none, a cut data row only none, and a cut close none or the new blob.
+*
+*******************************************************************************/
+static void sim_stream_check(void)
+{
+    uint8_t data[SIM_STREAM_MAX_LENGTH];
+    uint32_t length;
+    cy_en_em_eeprom_status_t status = sim_stream_read(data, &length);
+    bool valid = !eeprom_status_failed(status);
+    bool before = sim_stream_committed_valid &&
+                  (!sim_stream_in_flight || (SIM_STREAM_PHASE_OPEN == sim_stream_cut_phase));
+    bool after = sim_stream_in_flight && (SIM_STREAM_PHASE_CLOSE == sim_stream_cut_phase);
+
+    if(CY_EM_EEPROM_BAD_CHECKSUM == status)
+    {
+        sim_stream_error(&sim_stream_results.data_errors, "torn blob");
+    }
+    else if(!valid)
+    {
+        if(sim_stream_committed_valid && !sim_stream_in_flight)
+        {
+            sim_stream_error(&sim_stream_results.data_errors, "closed blob missing");
+        }
+    }
+    else if(!(before && (length == sim_stream_committed_length) &&
+              (0 == memcmp(data, sim_stream_committed, length))) &&
+            !(after && (length == sim_stream_pending_length) &&
+              (0 == memcmp(data, sim_stream_pending, length))))
+    {
+        sim_stream_error(&sim_stream_results.data_errors, "unexpected blob");
+    }
+
+    /* Continue from what the instance holds, so that one error is counted once. */
+    sim_stream_committed_valid = valid;
+    if(valid)
+    {
+        memcpy(sim_stream_committed, data, length);
+        sim_stream_committed_length = length;
+    }
+    sim_stream_in_flight = false;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_stream_write
+********************************************************************************
+*
+* Summary:
+* Writes a blob of random length and data in random chunks and reads it
+* back.
+*
+*******************************************************************************/
+static void sim_stream_write(void)
+{
+    uint8_t data[SIM_STREAM_MAX_LENGTH];
+    uint32_t length = 1u + (sim_stream_random() % SIM_STREAM_MAX_LENGTH);
+    uint32_t row_size = CY_EM_EEPROM_EEPROM_DATA_LEN(0u);
+    uint32_t first = SIM_STREAM_ADDR + EEPROM_STREAM_HEADER_SIZE;
+    uint32_t written = 0u;
+    bool in_place = (0u != (sim_stream_random() & 1u));
+    cy_en_em_eeprom_status_t status;
+
+    for(uint32_t i = 0u; i < length; i++)
+    {
+        sim_stream_pending[i] = (uint8_t) sim_stream_random();
+    }
+    sim_stream_pending_length = length;
+    sim_stream_in_flight = true;
+
+    sim_stream_phase = SIM_STREAM_PHASE_OPEN;
+    status = eeprom_stream_write_open(&sim_stream_writer, &sim_stream_context,
+                                      SIM_STREAM_ADDR, SIM_STREAM_CAPACITY);
+    sim_stream_phase = SIM_STREAM_PHASE_DATA;
+    while(!eeprom_status_failed(status) && (written < length))
+    {
+        uint32_t chunk = 1u + (sim_stream_random() % SIM_STREAM_MAX_CHUNK);
+        uint8_t *space;
+
+        if(chunk > (length - written))
+        {
+            chunk = length - written;
+        }
+        if(in_place)
+        {
+            /* A transfer fills at most the space up to the row boundary. */
+            uint32_t room = eeprom_stream_write_reserve(&sim_stream_writer, &space);
+
+            chunk = (chunk < room) ? chunk : room;
+            memcpy(space, &sim_stream_pending[written], chunk);
+            status = eeprom_stream_write_commit(&sim_stream_writer, chunk);
+        }
+        else
+        {
+            status = eeprom_stream_write(&sim_stream_writer, &sim_stream_pending[written], chunk);
+        }
+        written += chunk;
+    }
+    sim_stream_phase = SIM_STREAM_PHASE_CLOSE;
+    if(!eeprom_status_failed(status))
+    {
+        status = eeprom_stream_write_close(&sim_stream_writer);
+    }
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_stream_phase = SIM_STREAM_PHASE_INIT;
+    sim_stream_in_flight = false;
+
+    memcpy(sim_stream_committed, sim_stream_pending, length);
+    sim_stream_committed_length = length;
+    sim_stream_committed_valid = true;
+    sim_stream_results.blobs++;
+    sim_stream_results.bytes += length;
+    if((first / row_size) != ((first + length - 1u) / row_size))
+    {
+        sim_stream_results.multi_row++;
+    }
+
+    status = sim_stream_read(data, &written);
+    if(eeprom_status_failed(status) || (written != length) ||
+       (0 != memcmp(data, sim_stream_pending, length)))
+    {
+        sim_stream_error(&sim_stream_results.readback_errors, "blob read back differs");
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_stream_read
+********************************************************************************
+*
+* Summary:
+* Reads the blob at SIM_STREAM_ADDR in random chunks. Returns
+* CY_EM_EEPROM_BAD_DATA if the instance holds no closed blob, and halts the
+* boot on a failure of the middleware.
+*
+*******************************************************************************/
+static cy_en_em_eeprom_status_t sim_stream_read(uint8_t *data, uint32_t *length)
+{
+    eeprom_stream_reader_t reader;
+    cy_en_em_eeprom_status_t status;
+    uint32_t count;
+
+    *length = 0u;
+    status = eeprom_stream_read_open(&reader, &sim_stream_context, SIM_STREAM_ADDR);
+    if((CY_EM_EEPROM_BAD_DATA == status) ||
+       (!eeprom_status_failed(status) && (reader.length > SIM_STREAM_MAX_LENGTH)))
+    {
+        return CY_EM_EEPROM_BAD_DATA;
+    }
+
+    do
+    {
+        if(eeprom_status_failed(status))
+        {
+            break;
+        }
+        status = eeprom_stream_read(&reader, &data[*length],
+                                    1u + (sim_stream_random() % SIM_STREAM_MAX_CHUNK), &count);
+        *length += count;
+    } while(0u != count);
+
+    if(eeprom_status_failed(status) && (CY_EM_EEPROM_BAD_CHECKSUM != status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_stream_error
+********************************************************************************
+*
+* Summary:
+* Counts an error and prints the first SIM_STREAM_MAX_REPORTED_ERRORS of its
+* kind.
+*
+*******************************************************************************/
+static void sim_stream_error(uint64_t *errors, const char *message)
+{
+    if(*errors < SIM_STREAM_MAX_REPORTED_ERRORS)
+    {
+        printf("stream boot %llu: %s\n", (unsigned long long) sim_stream_boots, message);
+    }
+    (*errors)++;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_stream_random
+********************************************************************************
+*
+* Summary:
+* xorshift32, separate from the fault injection of the flash model.
+*
+*******************************************************************************/
+static uint32_t sim_stream_random(void)
+{
+    sim_stream_random_state ^= sim_stream_random_state << 13u;
+    sim_stream_random_state ^= sim_stream_random_state >> 17u;
+    sim_stream_random_state ^= sim_stream_random_state << 5u;
+    return sim_stream_random_state;
+}
+
+
+/* [] END OF FILE */
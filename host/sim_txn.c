@@ -0,0 +1,538 @@
+/******************************************************************************
+* File Name: sim_txn.c
+*
+* Description: This file contains the transaction scenario of the host simulator.
+*              It commits random multi-range transactions of eeprom_txn.c across
+*              power cycles, cuts the supply during the journal write, the row
+*              writes and the update of the journal state, and checks that the
+*              replay of eeprom_txn_init() leaves each transaction applied
+*              completely or not at all.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "eeprom_area.h"
+#include "eeprom_status.h"
+#include "eeprom_txn.h"
+
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* Two rows of logical data, so that transactions span rows, and a journal of
+ * one record. The redundant copies let Cy_Em_EEPROM_Init() recover from a
+ * row that a power loss left partially programmed.
+ */
+#define SIM_TXN_SIZE                    (2u * CY_EM_EEPROM_EEPROM_DATA_LEN(0u))
+#define SIM_TXN_WEAR_LEVELLING          (2u)
+#define SIM_TXN_AREA_SIZE               (CY_EM_EEPROM_GET_PHYSICAL_SIZE(SIM_TXN_SIZE, 0u, \
+                                         SIM_TXN_WEAR_LEVELLING, 1u))
+#define SIM_TXN_JOURNAL_SIZE            (EEPROM_TXN_RECORD_SIZE)
+#define SIM_TXN_JOURNAL_AREA_SIZE       (CY_EM_EEPROM_GET_PHYSICAL_SIZE(SIM_TXN_JOURNAL_SIZE, 0u, \
+                                         SIM_TXN_WEAR_LEVELLING, 1u))
+
+/* Transactions per boot, and the ranges and largest range of each. */
+#define SIM_TXN_COMMITS_PER_BOOT        (8u)
+#define SIM_TXN_MAX_RANGES              (4u)
+#define SIM_TXN_MAX_RANGE_SIZE          (48u)
+
+/* Number of errors printed before the rest are only counted. */
+#define SIM_TXN_MAX_REPORTED_ERRORS     (10u)
+
+
+/*******************************************************************************
+ * Data types
+ ******************************************************************************/
+/* What the transaction was doing when the supply was cut, told from the row
+ * the flash model cut.
+ */
+typedef enum
+{
+    /* Opening the instances, including the replay. */
+    SIM_TXN_PHASE_INIT,
+    /* Writing the journal record. */
+    SIM_TXN_PHASE_JOURNAL,
+    /* Writing the rows of a journaled transaction. */
+    SIM_TXN_PHASE_ROWS,
+    /* Marking the journal record applied. */
+    SIM_TXN_PHASE_STATE,
+    /* Writing a transaction that fits into one row write, which is not
+     * journaled.
+     */
+    SIM_TXN_PHASE_DIRECT,
+    SIM_TXN_PHASE_COUNT,
+} sim_txn_phase_t;
+
+typedef struct
+{
+    uint64_t completed;
+    uint64_t power_losses[SIM_TXN_PHASE_COUNT];
+    uint64_t halts;
+    uint64_t commits;
+    uint64_t journaled;
+    /* Reboots that read back neither the data before nor after the
+     * transaction in flight, or the data before it although the journal
+     * record was complete.
+     */
+    uint64_t data_errors;
+    /* Second eeprom_txn_init() calls that wrote to the flash, because the
+     * replay left the record pending.
+     */
+    uint64_t replay_errors;
+} sim_txn_results_t;
+
+
+/*******************************************************************************
+ * Global variables
+ ******************************************************************************/
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_txn_area[SIM_TXN_AREA_SIZE] = {0u};
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const uint8_t sim_txn_journal_area[SIM_TXN_JOURNAL_AREA_SIZE] = {0u};
+
+static cy_stc_eeprom_config_t sim_txn_config =
+{
+    .eepromSize = SIM_TXN_SIZE,
+    .blockingWrite = 1u,
+    .redundantCopy = 1u,
+    .wearLevelingFactor = SIM_TXN_WEAR_LEVELLING,
+    .simpleMode = 0u,
+};
+
+static cy_stc_eeprom_config_t sim_txn_journal_config =
+{
+    .eepromSize = SIM_TXN_JOURNAL_SIZE,
+    .blockingWrite = 1u,
+    .redundantCopy = 1u,
+    .wearLevelingFactor = SIM_TXN_WEAR_LEVELLING,
+    .simpleMode = 0u,
+};
+
+/* The state below is kept in RAM across the simulated boots. */
+static cy_stc_eeprom_context_t sim_txn_context;
+static cy_stc_eeprom_context_t sim_txn_journal_context;
+static eeprom_txn_t sim_txn;
+static sim_txn_results_t sim_txn_results;
+static uint64_t sim_txn_boots;
+static uint32_t sim_txn_random_state;
+/* Content after the last commit that returned, and that content with the
+ * transaction in flight applied. After a power loss, the instance must read
+ * back one of them, the second if the record of a journaled transaction was
+ * complete.
+ */
+static uint8_t sim_txn_committed[SIM_TXN_SIZE];
+static uint8_t sim_txn_pending[SIM_TXN_SIZE];
+static bool sim_txn_in_flight;
+static bool sim_txn_in_journal;
+static bool sim_txn_replay_due;
+/* Phase of the boot, SIM_TXN_PHASE_JOURNAL standing for the whole commit of
+ * a journaled transaction, and the programs of the data rows before it.
+ */
+static sim_txn_phase_t sim_txn_phase;
+static uint64_t sim_txn_rows_before;
+
+
+/*******************************************************************************
+ * Function Prototypes
+ ******************************************************************************/
+static int sim_txn_boot(void);
+static void sim_txn_open(void);
+static void sim_txn_check(void);
+static void sim_txn_commit(void);
+static sim_txn_phase_t sim_txn_cut_phase(void);
+static uint64_t sim_txn_programs(const uint8_t *area, uint32_t size);
+static bool sim_txn_in_area(uint32_t row, const uint8_t *area, uint32_t size);
+static uint32_t sim_txn_random(void);
+
+
+/*******************************************************************************
+* Function Name: sim_txn_run
+********************************************************************************
+*
+* Summary:
+* Runs the transaction scenario for a number of simulated boots. Every boot
+* opens both instances, lets eeprom_txn_init() replay a pending record,
+* checks the content and commits SIM_TXN_COMMITS_PER_BOOT transactions of up
+* to SIM_TXN_MAX_RANGES random ranges. Most of them span both rows and are
+* journaled; the others must be committed by a single row write. A power loss is attributed to the journal write, the rows or the
+* state update from the row that was cut.
+*
+* Parameters:
+* uint64_t cycles: number of boots.
+* uint32_t seed: seed of the ranges and the data.
+*
+* Return:
+* EXIT_SUCCESS if no check failed.
+*
+*******************************************************************************/
+int sim_txn_run(uint64_t cycles, uint32_t seed)
+{
+    sim_txn_random_state = (0u != seed) ? seed : 1u;
+    sim_txn_config.userFlashStartAddr = (uint32_t) (uintptr_t) sim_txn_area;
+    sim_txn_journal_config.userFlashStartAddr = (uint32_t) (uintptr_t) sim_txn_journal_area;
+
+    for(sim_txn_boots = 0u; sim_txn_boots < cycles; sim_txn_boots++)
+    {
+        uint32_t status;
+        sim_stop_t reason;
+
+        sim_txn_phase = SIM_TXN_PHASE_INIT;
+        reason = sim_boot(sim_txn_boot, &status);
+
+        switch(reason)
+        {
+            case SIM_STOP_NONE:
+                sim_txn_results.completed++;
+                break;
+
+            case SIM_STOP_POWER_LOSS:
+            {
+                sim_txn_phase_t phase = sim_txn_cut_phase();
+
+                /* Once the record is complete, the replay must apply it. */
+                if((SIM_TXN_PHASE_ROWS == phase) || (SIM_TXN_PHASE_STATE == phase))
+                {
+                    sim_txn_replay_due = true;
+                }
+                sim_txn_results.power_losses[phase]++;
+                break;
+            }
+
+            default:
+                if(sim_txn_results.halts < SIM_TXN_MAX_REPORTED_ERRORS)
+                {
+                    printf("txn boot %llu: halted with status 0x%lx\n",
+                           (unsigned long long) sim_txn_boots, (unsigned long) status);
+                }
+                sim_txn_results.halts++;
+                sim_flash_format();
+                memset(sim_txn_committed, 0, sizeof(sim_txn_committed));
+                sim_txn_in_flight = false;
+                sim_txn_replay_due = false;
+                break;
+        }
+    }
+
+    printf("txn boots:         %llu (%llu completed, %llu halts)\n",
+           (unsigned long long) cycles, (unsigned long long) sim_txn_results.completed,
+           (unsigned long long) sim_txn_results.halts);
+    printf("txn power losses:  %llu in init, %llu in journal writes, %llu in rows, "
+           "%llu in state updates, %llu in single-write commits\n",
+           (unsigned long long) sim_txn_results.power_losses[SIM_TXN_PHASE_INIT],
+           (unsigned long long) sim_txn_results.power_losses[SIM_TXN_PHASE_JOURNAL],
+           (unsigned long long) sim_txn_results.power_losses[SIM_TXN_PHASE_ROWS],
+           (unsigned long long) sim_txn_results.power_losses[SIM_TXN_PHASE_STATE],
+           (unsigned long long) sim_txn_results.power_losses[SIM_TXN_PHASE_DIRECT]);
+    printf("txn operations:    %llu commits, %llu journaled\n",
+           (unsigned long long) sim_txn_results.commits,
+           (unsigned long long) sim_txn_results.journaled);
+    printf("txn data errors:   %llu\n", (unsigned long long) sim_txn_results.data_errors);
+    printf("txn replay errors: %llu\n", (unsigned long long) sim_txn_results.replay_errors);
+
+    return (((0u == sim_txn_results.data_errors) && (0u == sim_txn_results.replay_errors) &&
+             (0u == sim_txn_results.halts)) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*******************************************************************************
+* Function Name: sim_txn_boot
+********************************************************************************
+*
+* Summary:
+* One simulated boot of the scenario.
+*
+*******************************************************************************/
+static int sim_txn_boot(void)
+{
+    uint64_t programs;
+
+    sim_txn_open();
+    sim_txn_check();
+
+    /* The replay marked the record applied, so opening again writes nothing. */
+    programs = sim_txn_programs(sim_txn_area, SIM_TXN_AREA_SIZE) +
+               sim_txn_programs(sim_txn_journal_area, SIM_TXN_JOURNAL_AREA_SIZE);
+    sim_txn_open();
+    if(programs != (sim_txn_programs(sim_txn_area, SIM_TXN_AREA_SIZE) +
+                    sim_txn_programs(sim_txn_journal_area, SIM_TXN_JOURNAL_AREA_SIZE)))
+    {
+        if(sim_txn_results.replay_errors < SIM_TXN_MAX_REPORTED_ERRORS)
+        {
+            printf("txn boot %llu: second init wrote to the flash\n",
+                   (unsigned long long) sim_txn_boots);
+        }
+        sim_txn_results.replay_errors++;
+    }
+
+    for(uint32_t i = 0u; i < SIM_TXN_COMMITS_PER_BOOT; i++)
+    {
+        sim_txn_commit();
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_txn_open
+********************************************************************************
+*
+* Summary:
+* Opens both instances and the transaction instance, which replays a pending
+* journal record.
+*
+*******************************************************************************/
+static void sim_txn_open(void)
+{
+    cy_en_em_eeprom_status_t status;
+
+    /* CY_EM_EEPROM_REDUNDANT_COPY_USED is expected after a power loss. */
+    status = Cy_Em_EEPROM_Init(&sim_txn_config, &sim_txn_context);
+    status = eeprom_status_combine(status, Cy_Em_EEPROM_Init(&sim_txn_journal_config,
+                                                             &sim_txn_journal_context));
+    if(!eeprom_status_failed(status))
+    {
+        status = eeprom_txn_init(&sim_txn, &sim_txn_context, &sim_txn_journal_context);
+    }
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_txn_check
+********************************************************************************
+*
+* Summary:
+* Compares the content of the instance after the replay with the content
+* before and after the transaction that was in flight at the power loss.
+*
+*******************************************************************************/
+static void sim_txn_check(void)
+{
+    uint8_t data[SIM_TXN_SIZE];
+    cy_en_em_eeprom_status_t status;
+    bool before;
+    bool after;
+
+    status = Cy_Em_EEPROM_Read(0u, data, SIM_TXN_SIZE, &sim_txn_context);
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+
+    before = (0 == memcmp(data, sim_txn_committed, SIM_TXN_SIZE)) && !sim_txn_replay_due;
+    after = sim_txn_in_flight && (0 == memcmp(data, sim_txn_pending, SIM_TXN_SIZE));
+    if(!before && !after)
+    {
+        if(sim_txn_results.data_errors < SIM_TXN_MAX_REPORTED_ERRORS)
+        {
+            printf("txn boot %llu: %s after a %sjournaled transaction\n",
+                   (unsigned long long) sim_txn_boots,
+                   (0 == memcmp(data, sim_txn_committed, SIM_TXN_SIZE)) ?
+                   "complete record not replayed" : "partial content",
+                   sim_txn_in_journal ? "" : "non-");
+        }
+        sim_txn_results.data_errors++;
+    }
+
+    /* Continue from what the instance holds, so that one error is counted once. */
+    memcpy(sim_txn_committed, data, SIM_TXN_SIZE);
+    sim_txn_in_flight = false;
+    sim_txn_replay_due = false;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_txn_commit
+********************************************************************************
+*
+* Summary:
+* Stages random ranges with random data and commits them.
+*
+*******************************************************************************/
+static void sim_txn_commit(void)
+{
+    uint32_t ranges = 1u + (sim_txn_random() % SIM_TXN_MAX_RANGES);
+    uint32_t row_size = CY_EM_EEPROM_EEPROM_DATA_LEN(0u);
+    uint32_t low = UINT32_MAX;
+    uint32_t high = 0u;
+    bool one_row;
+    cy_en_em_eeprom_status_t status;
+
+    memcpy(sim_txn_pending, sim_txn_committed, SIM_TXN_SIZE);
+
+    status = eeprom_txn_begin(&sim_txn);
+    for(uint32_t i = 0u; (i < ranges) && !eeprom_status_failed(status); i++)
+    {
+        uint32_t addr = sim_txn_random() % SIM_TXN_SIZE;
+        uint32_t size = 1u + (sim_txn_random() % SIM_TXN_MAX_RANGE_SIZE);
+        uint8_t data[SIM_TXN_MAX_RANGE_SIZE];
+
+        if(size > (SIM_TXN_SIZE - addr))
+        {
+            size = SIM_TXN_SIZE - addr;
+        }
+        for(uint32_t j = 0u; j < size; j++)
+        {
+            data[j] = (uint8_t) sim_txn_random();
+        }
+
+        /* Later ranges win where two overlap. */
+        memcpy(&sim_txn_pending[addr], data, size);
+        low = (addr < low) ? addr : low;
+        high = ((addr + size) > high) ? (addr + size) : high;
+
+        status = eeprom_txn_stage(&sim_txn, addr, data, size);
+    }
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+
+    /* Only ranges that one row write commits are not journaled. */
+    one_row = ((low / row_size) == ((high - 1u) / row_size)) &&
+              ((high - low) <= EEPROM_AREA_WRITE_DATA_LEN);
+    sim_txn_in_flight = true;
+    sim_txn_in_journal = !one_row;
+    sim_txn_rows_before = sim_txn_programs(sim_txn_area, SIM_TXN_AREA_SIZE);
+    sim_txn_phase = one_row ? SIM_TXN_PHASE_DIRECT : SIM_TXN_PHASE_JOURNAL;
+    status = eeprom_txn_commit(&sim_txn);
+    if(eeprom_status_failed(status))
+    {
+        sim_stop(SIM_STOP_HALT, (uint32_t) status);
+    }
+    sim_txn_phase = SIM_TXN_PHASE_INIT;
+    sim_txn_in_flight = false;
+
+    memcpy(sim_txn_committed, sim_txn_pending, SIM_TXN_SIZE);
+    sim_txn_results.commits++;
+    if(!one_row)
+    {
+        sim_txn_results.journaled++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: sim_txn_cut_phase
+********************************************************************************
+*
+* Summary:
+* Tells the step of a journaled commit that a power loss cut from the row
+* that was cut: a journal row before any data row was written is the record,
+* a data row is one of the rows, and a journal row after them is the state.
+*
+*******************************************************************************/
+static sim_txn_phase_t sim_txn_cut_phase(void)
+{
+    uint32_t row = sim_flash_last_row();
+
+    if(SIM_TXN_PHASE_JOURNAL != sim_txn_phase)
+    {
+        return sim_txn_phase;
+    }
+    if(sim_txn_in_area(row, sim_txn_area, SIM_TXN_AREA_SIZE))
+    {
+        return SIM_TXN_PHASE_ROWS;
+    }
+    return (sim_txn_programs(sim_txn_area, SIM_TXN_AREA_SIZE) == sim_txn_rows_before) ?
+           SIM_TXN_PHASE_JOURNAL : SIM_TXN_PHASE_STATE;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_txn_programs
+********************************************************************************
+*
+* Summary:
+* Returns the programs of the rows of an area counted by the flash model.
+*
+*******************************************************************************/
+static uint64_t sim_txn_programs(const uint8_t *area, uint32_t size)
+{
+    uint32_t first = (uint32_t) (((uintptr_t) area - (uintptr_t) sim_flash_row_address(0u)) /
+                                 CY_FLASH_SIZEOF_ROW);
+    uint64_t programs = 0u;
+
+    for(uint32_t row = first; row < (first + (size / CY_FLASH_SIZEOF_ROW)); row++)
+    {
+        programs += sim_flash_row_programs(row);
+    }
+    return programs;
+}
+
+
+/*******************************************************************************
+* Function Name: sim_txn_in_area
+********************************************************************************
+*
+* Summary:
+* Tells whether a row of the flash model belongs to an area.
+*
+*******************************************************************************/
+static bool sim_txn_in_area(uint32_t row, const uint8_t *area, uint32_t size)
+{
+    uint32_t first = (uint32_t) (((uintptr_t) area - (uintptr_t) sim_flash_row_address(0u)) /
+                                 CY_FLASH_SIZEOF_ROW);
+
+    return ((row >= first) && (row < (first + (size / CY_FLASH_SIZEOF_ROW))));
+}
+
+
+/*******************************************************************************
+* Function Name: sim_txn_random
+********************************************************************************
+*
+* Summary:
+* xorshift32, separate from the fault injection of the flash model.
+*
+*******************************************************************************/
+static uint32_t sim_txn_random(void)
+{
+    sim_txn_random_state ^= sim_txn_random_state << 13u;
+    sim_txn_random_state ^= sim_txn_random_state >> 17u;
+    sim_txn_random_state ^= sim_txn_random_state << 5u;
+    return sim_txn_random_state;
+}
+
+
+/* [] END OF FILE */
@@ -45,22 +45,55 @@
 #include "cybsp.h"
 #include "cy_retarget_io.h"
 #include "cy_em_eeprom.h"
+#include "eeprom_area.h"
+#include "eeprom_cache.h"
+#include "eeprom_async.h"
+#include "eeprom_counter.h"
+#include "eeprom_crc.h"
+#include "eeprom_direct.h"
+#include "eeprom_fastinit.h"
+#include "eeprom_format.h"
+#include "eeprom_io.h"
+#include "eeprom_journal.h"
+#include "eeprom_layout.h"
+#include "eeprom_partition.h"
+#include "eeprom_scrub.h"
+#include "eeprom_shadow.h"
+#include "eeprom_stats.h"
+#include "eeprom_status.h"
+#include "eeprom_trace.h"
+#if defined(EEPROM_BENCH)
+#include "eeprom_bench.h"
+#endif
 
 
 /*******************************************************************************
  * Macros
  ******************************************************************************/
-/* Logical Size of Emulated EEPROM in bytes. */
-#define LOGICAL_EEPROM_SIZE     (15u)
+/* Logical Size of Emulated EEPROM in bytes. The fields are listed in
+ * eeprom_layout.h.
+ */
+#define LOGICAL_EEPROM_SIZE     ((uint32_t) sizeof(eeprom_layout_t))
 #define LOGICAL_EEPROM_START    (0u)
 
-/* Location of reset counter in Em_EEPROM. */
-#define RESET_COUNT_LOCATION    (13u)
-/* Size of reset counter in bytes. */
-#define RESET_COUNT_SIZE        (2u)
+/* Location of the printed digits of the reset counter in Em_EEPROM. */
+#define RESET_COUNT_LOCATION    (LOGICAL_EEPROM_START + EEPROM_FIELD_OFFSET(reset_count))
+/* Size of the digits in bytes. */
+#define RESET_COUNT_SIZE        EEPROM_FIELD_SIZE(reset_count)
+
+/* The digits show the reset counter modulo 100. */
+#define RESET_COUNT_MODULO      (100u)
+
+/* Location of the telemetry record in the COLD partition, which holds it
+ * with the partitions of eeprom_partition.c. It fits into one row write, so a
+ * save cut by a power loss leaves the record of the last save.
+ */
+#define STATS_RECORD_LOCATION   (0u)
 
-/* ASCII "9" */
-#define ASCII_NINE              (0x39)
+#if defined(EEPROM_PARTITIONS)
+_Static_assert(EEPROM_STATS_RECORD_SIZE <= EEPROM_AREA_WRITE_DATA_LEN,
+               "The telemetry record takes more than one row write");
+#endif
 
 /* ASCII "0" */
 #define ASCII_ZERO              (0x30)
@@ -75,10 +108,56 @@
  * Cypress Em_EEPROM middleware API reference manual
  */
 #define EEPROM_SIZE             (256u)
+/* Set ASYNC_WRITE to 1 to queue the writes in the deferred write queue
+ * (eeprom_async.c) and program the flash with non-blocking writes.
+ */
+#define ASYNC_WRITE             (0u)
+#if ASYNC_WRITE
+#define BLOCKING_WRITE          (0u)
+#else
 #define BLOCKING_WRITE          (1u)
+#endif
 #define REDUNDANT_COPY          (1u)
 #define WEAR_LEVELLING_FACTOR   (2u)
+/* Set SIMPLE_MODE to 1 to store the data as-is, without wear leveling,
+ * redundant copy or checksums.
+ */
+#ifndef SIMPLE_MODE
 #define SIMPLE_MODE             (0u)
+#endif
+/* Set HARDWARE_CRC to 1 to compute the CRCs of the EEPROM modules, such as the
+ * row checks of the fast initialization, on the Crypto block. Devices without
+ * it fall back to software.
+ */
+#define HARDWARE_CRC            (1u)
+/* Set PREFORMATTED_EEPROM to 1 to ship the EEPROM formatted with
+ * eeprom_write_array in the application image, so that the first boot does
+ * not have to format it. Generate eeprom_image.h with "make eeprom_image"
+ * first, see README.md.
+ */
+#ifndef PREFORMATTED_EEPROM
+#define PREFORMATTED_EEPROM     (0u)
+#endif
+/* Read verification policy of the EEPROM content:
+ * READ_VERIFY_ALWAYS - every read checks the row checksums in the flash.
+ * READ_VERIFY_ONCE   - the checksums are checked once, when the RAM shadow is
+ *                      filled from the flash. Reads are served from the
+ *                      shadow, which every successful write keeps current.
+ * READ_VERIFY_SCRUB  - as READ_VERIFY_ONCE; in addition, the idle loop checks
+ *                      one row of data against the shadow every
+ *                      SCRUB_INTERVAL_MS and repairs whichever side is bad.
+ */
+#define READ_VERIFY_ALWAYS      (0u)
+#define READ_VERIFY_ONCE        (1u)
+#define READ_VERIFY_SCRUB       (2u)
+#define READ_VERIFY             (READ_VERIFY_ALWAYS)
+#define SCRUB_INTERVAL_MS       (1000u)
+
+/* Period of the idle loop. Each pass calls eeprom_cache_poll(), so data
+ * written to the cache in the loop reaches the flash within
+ * EEPROM_CACHE_MAX_STALENESS_MS plus one period.
+ */
+#define IDLE_INTERVAL_MS        (100u)
 
 /* Set the macro FLASH_REGION_TO_USE to either USER_FLASH or
  * EMULATED_EEPROM_FLASH to specify the region of the flash used for
@@ -94,12 +173,39 @@
 #define FLASH_REGION_TO_USE     USER_FLASH
 #endif
 
+#if (ASYNC_WRITE && (USER_FLASH == FLASH_REGION_TO_USE))
+/* Non-blocking writes to the sector the code executes from may cause a
+ * HardFault, see README.md.
+ */
+#error "ASYNC_WRITE requires the emulated EEPROM flash region"
+#endif
+
+#if PREFORMATTED_EEPROM
+#if (defined(CY_DEVICE_SECURE) && (USER_FLASH == FLASH_REGION_TO_USE ))
+/* The EEPROM is outside the signed image there. */
+#error "PREFORMATTED_EEPROM requires the EEPROM array in the application image"
+#endif
+/* Content of eeprom_storage generated by the host simulator. */
+#include "eeprom_image.h"
+_Static_assert(EEPROM_IMAGE_SIZE ==
+               CY_EM_EEPROM_GET_PHYSICAL_SIZE(EEPROM_SIZE, SIMPLE_MODE, WEAR_LEVELLING_FACTOR, REDUNDANT_COPY),
+               "eeprom_image.h was generated for another EEPROM configuration");
+#else
+#define EEPROM_IMAGE            {0u}
+#endif
+
 #define GPIO_LOW                (0u)
 
+/* Fail the build if the layout does not fit or a field straddles a row. */
+EEPROM_LAYOUT_CHECK(LOGICAL_EEPROM_START, EEPROM_SIZE, CY_EM_EEPROM_EEPROM_DATA_LEN(SIMPLE_MODE))
+
 /*******************************************************************************
  * Function Prototypes
  ******************************************************************************/
 void handle_error(uint32_t status, char *message);
+#if ASYNC_WRITE
+static void write_complete(cy_en_em_eeprom_status_t status, void *arg);
+#endif
 
 
 /*******************************************************************************
@@ -112,40 +218,145 @@ cy_stc_eeprom_config_t Em_EEPROM_config =
         .blockingWrite = BLOCKING_WRITE,
         .redundantCopy = REDUNDANT_COPY,
         .wearLevelingFactor = WEAR_LEVELLING_FACTOR,
+        .simpleMode = SIMPLE_MODE,
 };
 
 cy_stc_eeprom_context_t Em_EEPROM_context;
 
-#if (EMULATED_EEPROM_FLASH == FLASH_REGION_TO_USE)
-CY_SECTION(".cy_em_eeprom")
-#endif /* #if(FLASH_REGION_TO_USE) */
-CY_ALIGN(CY_EM_EEPROM_FLASH_SIZEOF_ROW)
+/* Write-back cache in front of the logical EEPROM. eeprom_cache_image is used
+ * as its RAM image.
+ */
+eeprom_cache_t Em_EEPROM_cache;
+
+/* Wear and latency telemetry of the EEPROM. */
+eeprom_stats_t Em_EEPROM_stats;
+
+/* Emergency journal the brown-out interrupt saves the cache to. */
+eeprom_journal_t Em_EEPROM_journal;
+
+/* Number of resets, kept in its own two rows outside Em_EEPROM. */
+eeprom_counter_t eeprom_reset_counter;
+
+#if ASYNC_WRITE
+/* Deferred write queue used to commit the cache. */
+eeprom_async_t Em_EEPROM_async;
+#endif
+
+#if (READ_VERIFY_ALWAYS != READ_VERIFY)
+/* Verified RAM copy of the logical EEPROM that serves the reads. */
+eeprom_shadow_t Em_EEPROM_shadow;
+uint8_t eeprom_shadow_image[LOGICAL_EEPROM_START + LOGICAL_EEPROM_SIZE];
+#endif
+
+#if (READ_VERIFY_SCRUB == READ_VERIFY)
+/* Background check of the flash against the shadow. */
+eeprom_scrub_t Em_EEPROM_scrub;
+#endif
 
 #if (defined(CY_DEVICE_SECURE) && (USER_FLASH == FLASH_REGION_TO_USE ))
 /* When CY8CKIT-064B0S2-4343W is selected as the target and EEPROM array is
- * stored in user flash, the EEPROM array is placed in a fixed location in
- * memory. The adddress of the fixed location can be arrived at by determining
- * the amount of flash consumed by the application. In this case, the example
- * consumes approximately 104000 bytes for the above target using GCC_ARM 
- * compiler and Debug configuration. The start address specified in the linker
- * script is 0x10000000, providing an offset of approximately 32 KB, the EEPROM
- * array is placed at 0x10021000 in this example. Note that changing the
- * compiler and the build configuration will change the amount of flash
- * consumed. As a resut, you will need to modify the value accordingly. Among
- * the supported compilers and build configurations, the amount of flash
- * consumed is highest for GCC_ARM compiler and Debug build configuration.
+ * stored in user flash, the EEPROM array is placed in a fixed area outside the
+ * signed application image; writing inside the image would invalidate its
+ * signature. The area is given by EEPROM_SECURE_ADDR and EEPROM_SECURE_SIZE in
+ * the Makefile. The checks below make sure the EEPROM and the journal row fit
+ * into the area, and the post-build step fails the build when the application
+ * image grows into it, reporting the flash left between the two otherwise.
+ */
+#ifndef EEPROM_SECURE_ADDR
+#define EEPROM_SECURE_ADDR                       (0x10021000)
+#endif
+
+#ifndef EEPROM_SECURE_SIZE
+#define EEPROM_SECURE_SIZE                       (0x1000)
+#endif
+
+#define APP_DEFINED_EM_EEPROM_LOCATION_IN_FLASH  (EEPROM_SECURE_ADDR)
+
+/* The journal row follows the EEPROM array in the same area, and the rows of
+ * the reset counter follow the journal.
  */
-#define APP_DEFINED_EM_EEPROM_LOCATION_IN_FLASH  (0x10021000)
+#define EEPROM_JOURNAL_LOCATION                  (EEPROM_SECURE_ADDR + \
+    CY_EM_EEPROM_GET_PHYSICAL_SIZE(EEPROM_SIZE, SIMPLE_MODE, WEAR_LEVELLING_FACTOR, REDUNDANT_COPY))
+#define EEPROM_COUNTER_LOCATION                  (EEPROM_JOURNAL_LOCATION + EEPROM_JOURNAL_AREA_SIZE)
+
+_Static_assert((EEPROM_SECURE_ADDR % CY_EM_EEPROM_FLASH_SIZEOF_ROW) == 0u,
+               "EEPROM_SECURE_ADDR must be aligned to a flash row");
+_Static_assert((CY_EM_EEPROM_GET_PHYSICAL_SIZE(EEPROM_SIZE, SIMPLE_MODE, WEAR_LEVELLING_FACTOR, REDUNDANT_COPY) +
+                EEPROM_JOURNAL_AREA_SIZE + EEPROM_COUNTER_AREA_SIZE) <= EEPROM_SECURE_SIZE,
+               "EEPROM, journal and reset counter do not fit into EEPROM_SECURE_SIZE");
 #else
 /* EEPROM storage in user flash or emulated EEPROM flash. */
-const uint8_t eeprom_storage[CY_EM_EEPROM_GET_PHYSICAL_SIZE(EEPROM_SIZE, SIMPLE_MODE, WEAR_LEVELLING_FACTOR, REDUNDANT_COPY)] = {0u};
+#if (EMULATED_EEPROM_FLASH == FLASH_REGION_TO_USE)
+CY_SECTION(".cy_em_eeprom")
+#endif /* #if(FLASH_REGION_TO_USE) */
+CY_ALIGN(CY_EM_EEPROM_FLASH_SIZEOF_ROW)
+const uint8_t eeprom_storage[CY_EM_EEPROM_GET_PHYSICAL_SIZE(EEPROM_SIZE, SIMPLE_MODE, WEAR_LEVELLING_FACTOR, REDUNDANT_COPY)] = EEPROM_IMAGE;
 
 #endif /* #if (defined(CY_DEVICE_SECURE)) */
 
-/* RAM arrays for holding EEPROM read and write data respectively. */
-uint8_t eeprom_read_array[LOGICAL_EEPROM_SIZE];
-uint8_t eeprom_write_array[LOGICAL_EEPROM_SIZE] = { 0x50, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x43, 0x79, 0x63, 0x6C, 0x65, 0x23, 0x20, 0x30, 0x30};
-                                                /* P, o, w, e, r, , C, y, c, l, e, #, , 0, 0 */
+#if !(defined(CY_DEVICE_SECURE) && (USER_FLASH == FLASH_REGION_TO_USE ))
+/* Row of the emergency journal, erased whenever it holds no records. */
+#if (EMULATED_EEPROM_FLASH == FLASH_REGION_TO_USE)
+CY_SECTION(".cy_em_eeprom")
+#endif /* #if(FLASH_REGION_TO_USE) */
+CY_ALIGN(CY_EM_EEPROM_FLASH_SIZEOF_ROW)
+const uint8_t eeprom_journal_storage[EEPROM_JOURNAL_AREA_SIZE] = {0u};
+
+#define EEPROM_JOURNAL_LOCATION                  ((uint32_t) eeprom_journal_storage)
+
+/* Two rows of the reset counter, erased in turn. */
+#if (EMULATED_EEPROM_FLASH == FLASH_REGION_TO_USE)
+CY_SECTION(".cy_em_eeprom")
+#endif /* #if(FLASH_REGION_TO_USE) */
+CY_ALIGN(CY_EM_EEPROM_FLASH_SIZEOF_ROW)
+const uint8_t eeprom_counter_storage[EEPROM_COUNTER_AREA_SIZE] = {0u};
+
+#define EEPROM_COUNTER_LOCATION                  ((uint32_t) eeprom_counter_storage)
+#endif /* #if !(defined(CY_DEVICE_SECURE)) */
+
+#if (EMULATED_EEPROM_FLASH == FLASH_REGION_TO_USE)
+/* Everything the application links into the emulated EEPROM flash region:
+ * the EEPROM array, the journal row and the counter rows above, the
+ * partitions of eeprom_partition.c if EEPROM_PARTITIONS is defined and, in the
+ * Bench configuration, the flash area of eeprom_bench.c. All of them are
+ * multiples of a row, so the alignment adds no padding. eeprom_log.c and
+ * eeprom_relocate.c own no flash; they work in areas or instances the caller
+ * takes from these.
+ */
+#if defined(EEPROM_PARTITIONS)
+#define EEPROM_REGION_PARTITION_SIZE             (EEPROM_PARTITION_TOTAL_SIZE)
+#else
+#define EEPROM_REGION_PARTITION_SIZE             (0u)
+#endif
+
+#if defined(EEPROM_BENCH)
+#define EEPROM_REGION_BENCH_SIZE                 (EEPROM_BENCH_STORAGE_SIZE)
+#else
+#define EEPROM_REGION_BENCH_SIZE                 (0u)
+#endif
+
+_Static_assert((CY_EM_EEPROM_GET_PHYSICAL_SIZE(EEPROM_SIZE, SIMPLE_MODE, WEAR_LEVELLING_FACTOR, REDUNDANT_COPY) +
+                EEPROM_JOURNAL_AREA_SIZE + EEPROM_COUNTER_AREA_SIZE + EEPROM_REGION_PARTITION_SIZE +
+                EEPROM_REGION_BENCH_SIZE) <=
+               CY_EM_EEPROM_SIZE,
+               "Flash areas exceed the emulated EEPROM flash region");
+#endif /* #if (EMULATED_EEPROM_FLASH == FLASH_REGION_TO_USE) */
+
+/* RAM image of the cache, which serves the reads of the EEPROM, and the
+ * initial EEPROM data.
+ */
+uint8_t eeprom_cache_image[LOGICAL_EEPROM_SIZE];
+/* Content read back at the end of main(): the Em_EEPROM area itself if the
+ * range is stored in one row, eeprom_cache_image otherwise.
+ */
+const uint8_t *eeprom_read_data = eeprom_cache_image;
+const eeprom_layout_t eeprom_write_array =
+{
+    .banner = { 0x50, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x43, 0x79, 0x63, 0x6C, 0x65, 0x23, 0x20},
+                /* P, o, w, e, r, , C, y, c, l, e, #, */
+    .reset_count = { 0x30, 0x30}
+                /* 0, 0 */
+};
 
 
 /*******************************************************************************
@@ -154,8 +365,8 @@ uint8_t eeprom_write_array[LOGICAL_EEPROM_SIZE] = { 0x50, 0x6F, 0x77, 0x65, 0x72
 *
 * Summary:
 * System entry point. This function configures and initializes UART and
-* Emulated EEPROM, reads the EEPROM content, increments it by one and writes the
-* new content back to EEPROM.
+* Emulated EEPROM, reads the EEPROM content, increments the reset counter and
+* writes its last two digits back to EEPROM.
 *
 * Return: int
 *
@@ -163,8 +374,17 @@ uint8_t eeprom_write_array[LOGICAL_EEPROM_SIZE] = { 0x50, 0x6F, 0x77, 0x65, 0x72
 int main(void)
 {
     int count;
+    /* Reset counter modulo RESET_COUNT_MODULO, and its two ASCII digits. */
+    uint32_t reset_digits;
+    uint8_t reset_count[RESET_COUNT_SIZE];
     /* Return status for EEPROM. */
     cy_en_em_eeprom_status_t eeprom_return_value;
+    /* Return status of the reset counter. */
+    cy_en_flashdrv_status_t flash_return_value;
+    /* Rows and time taken by a first-boot format. */
+    eeprom_format_report_t format_report;
+    /* Time spent in the idle loop, the clock of eeprom_cache_poll(). */
+    uint32_t idle_ms = 0u;
 
     cy_rslt_t result;
 
@@ -201,8 +421,26 @@ int main(void)
         CY_ASSERT(0);
     }
 
+#if defined(EEPROM_BENCH)
+    /* CONFIG=Bench replaces the demo with the latency sweep. */
+    eeprom_bench_run();
+
+#if defined(EEPROM_HOST_SIM)
+    return 0;
+#endif
+    for(;;)
+    {
+
+    }
+#endif
+
     printf("EmEEPROM demo \r\n");
 
+    /* Stamp the trace records of the EEPROM operations, if EEPROM_TRACE is set. */
+    eeprom_trace_init();
+
+    (void) eeprom_crc_select(HARDWARE_CRC ? EEPROM_CRC_HARDWARE : EEPROM_CRC_SOFTWARE);
+
     /* Initialize the flash start address in EEPROM configuration structure. */
 #if (defined(CY_DEVICE_SECURE) && (USER_FLASH == FLASH_REGION_TO_USE ))
     Em_EEPROM_config.userFlashStartAddr = (uint32_t) APP_DEFINED_EM_EEPROM_LOCATION_IN_FLASH;
@@ -210,73 +448,216 @@ int main(void)
     Em_EEPROM_config.userFlashStartAddr = (uint32_t) eeprom_storage;
 #endif
 
-    eeprom_return_value = Cy_Em_EEPROM_Init(&Em_EEPROM_config, &Em_EEPROM_context);
+    /* Defer the initialization to the first access, which validates only the
+     * head row if the hint from the last boot is intact. Start-up work that
+     * does not need the EEPROM can run before that access. An initialization
+     * error is returned by the access.
+     */
+    eeprom_return_value = eeprom_io_lazy_init(&Em_EEPROM_config, &Em_EEPROM_context);
+    handle_error(eeprom_return_value, "Emulated EEPROM Initialization Error \r\n");
+
+    /* Records saved by the last brown-out are merged by the first access. */
+    eeprom_return_value = eeprom_journal_init(&Em_EEPROM_journal, &Em_EEPROM_config,
+                                              &Em_EEPROM_context,
+                                              (uint32_t) EEPROM_JOURNAL_LOCATION);
+    handle_error(eeprom_return_value, "Emulated EEPROM Initialization Error \r\n");
+
+    /* Count the accesses from here on. */
+    eeprom_return_value = eeprom_stats_init(&Em_EEPROM_stats, &Em_EEPROM_config,
+                                            &Em_EEPROM_context);
+    handle_error(eeprom_return_value, "Emulated EEPROM Initialization Error \r\n");
+
+#if defined(EEPROM_PARTITIONS)
+    /* Add the counters of the earlier boots. They are saved to another
+     * instance, so that saving them does not add to the wear they measure. A
+     * device that has never saved them starts from zero.
+     */
+    eeprom_return_value = eeprom_partition_init_all();
+    handle_error(eeprom_return_value, "Emulated EEPROM Initialization Error \r\n");
+    eeprom_return_value = eeprom_stats_load(&Em_EEPROM_stats, STATS_RECORD_LOCATION,
+                                            eeprom_partition_context(EEPROM_PARTITION_COLD));
+    if(CY_EM_EEPROM_BAD_DATA != eeprom_return_value)
+    {
+        handle_error(eeprom_return_value, "Telemetry load failed \r\n");
+    }
+#endif
+
+#if (READ_VERIFY_ALWAYS != READ_VERIFY)
+    /* Verify the content once; reads are served from RAM from here on. */
+    eeprom_return_value = eeprom_shadow_init(&Em_EEPROM_shadow, &Em_EEPROM_context,
+                                             eeprom_shadow_image,
+                                             (uint32_t) sizeof(eeprom_shadow_image));
+    handle_error(eeprom_return_value, "Emulated EEPROM Initialization Error \r\n");
+#endif
+#if (READ_VERIFY_SCRUB == READ_VERIFY)
+    eeprom_return_value = eeprom_scrub_init(&Em_EEPROM_scrub, &Em_EEPROM_config,
+                                            &Em_EEPROM_context);
     handle_error(eeprom_return_value, "Emulated EEPROM Initialization Error \r\n");
+#endif
 
 
-    /* Read 15 bytes out of EEPROM memory. */
-    eeprom_return_value = Cy_Em_EEPROM_Read(LOGICAL_EEPROM_START, eeprom_read_array,
-                                          LOGICAL_EEPROM_SIZE, &Em_EEPROM_context);
+    /* Restore the reset counter. The first boot on an erased device starts it
+     * at zero.
+     */
+    flash_return_value = eeprom_counter_init(&eeprom_reset_counter,
+                                             (uint32_t) EEPROM_COUNTER_LOCATION);
+    handle_error((uint32_t) flash_return_value, "Reset counter initialization failed \r\n");
+
+    /* Read 15 bytes out of EEPROM memory into the cache image. */
+    eeprom_return_value = eeprom_cache_init(&Em_EEPROM_cache, &Em_EEPROM_context,
+                                            LOGICAL_EEPROM_START, eeprom_cache_image,
+                                            LOGICAL_EEPROM_SIZE);
     handle_error(eeprom_return_value, "Emulated EEPROM Read failed \r\n");
 
+#if ASYNC_WRITE
+    eeprom_return_value = eeprom_async_init(&Em_EEPROM_async, &Em_EEPROM_context);
+    handle_error(eeprom_return_value, "Emulated EEPROM Initialization Error \r\n");
+#endif
 
-    /* If first byte of EEPROM is not 'P', then write the data for initializing
-     * the EEPROM content.
+    /* Save pending updates to the journal if the supply drops before the
+     * explicit flush. With ASYNC_WRITE, the save waits until the queued rows
+     * are written, and it covers what is still dirty then.
      */
-    if(ASCII_P != eeprom_read_array[0])
+    eeprom_cache_enable_brownout_journal(&Em_EEPROM_cache, &Em_EEPROM_journal);
+
+    /* Flush whatever is still pending before the CPU enters Deep Sleep. */
+    eeprom_cache_enable_deepsleep_flush(&Em_EEPROM_cache);
+
+
+    /* If first byte of EEPROM is not 'P', then format the EEPROM with the data
+     * for initializing the EEPROM content.
+     */
+    if(ASCII_P != eeprom_cache_image[0])
     {
-        /* Write initial data to EEPROM. */
-        eeprom_return_value = Cy_Em_EEPROM_Write(LOGICAL_EEPROM_START,
-                                               eeprom_write_array,
-                                               LOGICAL_EEPROM_SIZE,
-                                               &Em_EEPROM_context);
+        /* Erase the EEPROM and write initial data in one pass. */
+        eeprom_return_value = eeprom_format(&Em_EEPROM_config, &Em_EEPROM_context,
+                                            &eeprom_write_array, LOGICAL_EEPROM_SIZE,
+                                            &format_report);
         handle_error(eeprom_return_value, "Emulated EEPROM Write failed \r\n");
+
+        printf("EEPROM formatted: %lu rows erased, %lu already erased, erase %lu us, write %lu us\r\n",
+               (unsigned long) format_report.rows_erased,
+               (unsigned long) format_report.rows_skipped,
+               (unsigned long) format_report.erase_us,
+               (unsigned long) format_report.write_us);
+
+        /* Reload the cache image from the new content. */
+        eeprom_return_value = eeprom_cache_init(&Em_EEPROM_cache, &Em_EEPROM_context,
+                                                LOGICAL_EEPROM_START, eeprom_cache_image,
+                                                LOGICAL_EEPROM_SIZE);
+        handle_error(eeprom_return_value, "Emulated EEPROM Read failed \r\n");
     }
 
     else
     {
-        /* The EEPROM content is valid. Increment Counter by 1. */
-        eeprom_read_array[RESET_COUNT_LOCATION+1]++;
+        /* The EEPROM content is valid, so count the reset. */
+        flash_return_value = eeprom_counter_increment(&eeprom_reset_counter);
+        handle_error((uint32_t) flash_return_value, "Reset counter update failed \r\n");
+    }
 
-        /* Counter is in ASCII, so handle overflow. */
-        if(eeprom_read_array[RESET_COUNT_LOCATION+1] > ASCII_NINE)
+    /* Show the last two digits of the counter in the EEPROM content. They
+     * wrap from 99 to 00; the counter itself keeps counting. Both digits go
+     * into the cache as one write, which it skips if they did not change.
+     */
+    reset_digits = (uint32_t) (eeprom_counter_get(&eeprom_reset_counter) % RESET_COUNT_MODULO);
+    reset_count[0] = (uint8_t) (ASCII_ZERO + (reset_digits / 10u));
+    reset_count[1] = (uint8_t) (ASCII_ZERO + (reset_digits % 10u));
+    eeprom_return_value = eeprom_cache_write(&Em_EEPROM_cache, RESET_COUNT_LOCATION,
+                                             reset_count, RESET_COUNT_SIZE);
+    handle_error(eeprom_return_value, "Emulated EEPROM Write failed \r\n");
+
+    /* Commit all pending updates to the EEPROM. The head-row hint goes stale
+     * as soon as the flash changes, so drop it until the write is done.
+     */
+    eeprom_fastinit_invalidate();
+#if ASYNC_WRITE
+    do
+    {
+        eeprom_return_value = eeprom_async_flush_cache(&Em_EEPROM_async, &Em_EEPROM_cache,
+                                                       write_complete, NULL);
+        if(EEPROM_STATUS_BUSY != eeprom_return_value)
         {
-            /* Set lower digit to zero. */
-            eeprom_read_array[RESET_COUNT_LOCATION+1] = ASCII_ZERO;
-            /* Increment upper digit. */
-            eeprom_read_array[RESET_COUNT_LOCATION]++;
+            handle_error(eeprom_return_value, "Emulated EEPROM Write failed \r\n");
+        }
 
-            /* only increment to 99. */
-            if(eeprom_read_array[RESET_COUNT_LOCATION] > ASCII_NINE)
-            {
-                eeprom_read_array[RESET_COUNT_LOCATION] = ASCII_NINE;
-                eeprom_read_array[RESET_COUNT_LOCATION+1] = ASCII_NINE;
-            }
+        /* Each call runs the queued writes to the end. Nothing else to do
+         * here, so drain the queue, then queue the rows that did not fit.
+         */
+        while(eeprom_async_is_busy(&Em_EEPROM_async))
+        {
+            eeprom_async_process(&Em_EEPROM_async);
         }
+    } while(EEPROM_STATUS_BUSY == eeprom_return_value);
+#else
+    eeprom_return_value = eeprom_cache_flush(&Em_EEPROM_cache);
+    handle_error(eeprom_return_value, "Emulated EEPROM Write failed \r\n");
+#endif
+    eeprom_fastinit_update(&Em_EEPROM_config, &Em_EEPROM_context);
 
-        /* Only update the two count values in the EEPROM. */
-        eeprom_return_value = Cy_Em_EEPROM_Write(RESET_COUNT_LOCATION,
-                                               &eeprom_read_array[RESET_COUNT_LOCATION],
-                                               RESET_COUNT_SIZE,
-                                               &Em_EEPROM_context);
-        handle_error(eeprom_return_value, "Emulated EEPROM Write failed \r\n");
-    }
+#if defined(EEPROM_PARTITIONS)
+    /* A boot writes far less than EEPROM_STATS_SAVE_INTERVAL times, so save
+     * the counters once the writes of the boot are done; the idle loop saves
+     * them whenever eeprom_stats_save_due() asks for it.
+     */
+    eeprom_return_value = eeprom_stats_save(&Em_EEPROM_stats, STATS_RECORD_LOCATION,
+                                            eeprom_partition_context(EEPROM_PARTITION_COLD));
+    handle_error(eeprom_return_value, "Telemetry save failed \r\n");
+#endif
 
-    /* Read contents of EEPROM after write. */
-    eeprom_return_value = Cy_Em_EEPROM_Read(LOGICAL_EEPROM_START,
-                                          eeprom_read_array, LOGICAL_EEPROM_SIZE,
-                                          &Em_EEPROM_context);
+    /* Read contents of EEPROM after write, in place if the range is stored in
+     * one row. Otherwise it is copied into the cache image, which the flush
+     * has left with the same content.
+     */
+    eeprom_return_value = eeprom_direct_read(&Em_EEPROM_config, &Em_EEPROM_context,
+                                             LOGICAL_EEPROM_START, LOGICAL_EEPROM_SIZE,
+                                             eeprom_cache_image, &eeprom_read_data);
     handle_error(eeprom_return_value, "Emulated EEPROM Read failed \r\n" );
 
     for(count = 0; count < LOGICAL_EEPROM_SIZE ; count++)
     {
-        printf("%c",eeprom_read_array[count]);
+        printf("%c",eeprom_read_data[count]);
     }
     printf("\r\n");
 
+    /* The low word of the counter, which newlib-nano can print. */
+    printf("Resets: %lu\r\n", (unsigned long) eeprom_counter_get(&eeprom_reset_counter));
+
+    printf("EEPROM writes: %lu, suppressed: %lu, average %lu us, max row programs: %lu\r\n",
+           (unsigned long) eeprom_stats_get(&Em_EEPROM_stats)->writes,
+           (unsigned long) eeprom_stats_get(&Em_EEPROM_stats)->suppressed_writes,
+           (unsigned long) eeprom_stats_average_write_us(&Em_EEPROM_stats),
+           (unsigned long) eeprom_stats_max_row_programs(&Em_EEPROM_stats));
+    eeprom_trace_dump();
+
+#if defined(EEPROM_HOST_SIM)
+    /* The host simulator runs main() once per simulated power cycle. */
+    return 0;
+#endif
     for(;;)
     {
+        Cy_SysLib_Delay(IDLE_INTERVAL_MS);
+        idle_ms += IDLE_INTERVAL_MS;
 
+        /* Bound how long updates to the cache stay in RAM only. */
+        eeprom_return_value = eeprom_cache_poll(&Em_EEPROM_cache, idle_ms);
+        handle_error(eeprom_return_value, "Emulated EEPROM Write failed \r\n");
+
+#if defined(EEPROM_PARTITIONS)
+        if(eeprom_stats_save_due(&Em_EEPROM_stats))
+        {
+            eeprom_return_value = eeprom_stats_save(&Em_EEPROM_stats, STATS_RECORD_LOCATION,
+                                                    eeprom_partition_context(EEPROM_PARTITION_COLD));
+            handle_error(eeprom_return_value, "Telemetry save failed \r\n");
+        }
+#endif
+
+#if (READ_VERIFY_SCRUB == READ_VERIFY)
+        /* The shadow serves the reads, so check the flash behind it. */
+        if(0u == (idle_ms % SCRUB_INTERVAL_MS))
+        {
+            (void) eeprom_scrub_step(&Em_EEPROM_scrub);
+        }
+#endif
     }
 }
 
@@ -310,7 +691,12 @@ void handle_error(uint32_t status, char *message)
             {
                 printf("%s",message);
             }
+            /* The operations that led up to the error. */
+            eeprom_trace_dump();
 
+#if defined(EEPROM_HOST_SIM)
+            sim_halt(status);
+#endif
             while(1u);
         }
         else
@@ -321,4 +707,26 @@ void handle_error(uint32_t status, char *message)
     }
 }
 
+#if ASYNC_WRITE
+/*******************************************************************************
+* Function Name: write_complete
+********************************************************************************
+*
+* Summary:
+* Completion callback of the deferred write queue. Reports the status of
+* the write the same way as a blocking write.
+*
+* Parameters:
+* cy_en_em_eeprom_status_t status: status of the completed write.
+* void *arg: unused.
+*
+*******************************************************************************/
+static void write_complete(cy_en_em_eeprom_status_t status, void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    handle_error(status, "Emulated EEPROM Write failed \r\n");
+}
+#endif
+
 /* [] END OF FILE */
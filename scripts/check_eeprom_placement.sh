@@ -0,0 +1,91 @@
+#!/bin/bash
+################################################################################
+# File Name: check_eeprom_placement.sh
+#
+# Description: Post-build check of the EEPROM area of secure targets. Fails
+#              the build if a loadable segment of the image reaches into
+#              the area, and prints the flash left between the image and
+#              the area.
+#
+# Related Document: See README.md
+#
+#
+#******************************************************************************
+# Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer
+# of such system or application assumes all risk of such use and in doing
+# so agrees to indemnify Cypress against all liability.
+################################################################################
+#
+# Usage: check_eeprom_placement.sh <readelf> <elf> <eeprom address> <eeprom size>
+
+set -e
+
+if [ $# -ne 4 ]; then
+    echo "usage: $0 <readelf> <elf> <eeprom address> <eeprom size>" >&2
+    exit 2
+fi
+
+readelf=$1
+elf=$2
+area_start=$(( $3 ))
+area_end=$(( $3 + $4 ))
+
+# Main flash of PSoC 6.
+flash_start=$(( 0x10000000 ))
+flash_end=$(( 0x10200000 ))
+
+if [ ! -x "$readelf" ] && ! command -v "$readelf" > /dev/null; then
+    echo "EEPROM placement: $readelf not found, check skipped" >&2
+    exit 0
+fi
+
+image_end=$flash_start
+
+# LOAD  Offset  VirtAddr  PhysAddr  FileSiz  MemSiz  Flg  Align
+while read -r type offset vaddr paddr filesz rest; do
+    [ "$type" = "LOAD" ] || continue
+    start=$(( paddr ))
+    end=$(( paddr + filesz ))
+    if [ $(( filesz )) -eq 0 ] || [ $start -lt $flash_start ] || [ $start -ge $flash_end ]; then
+        continue
+    fi
+    if [ $start -lt $area_end ] && [ $end -gt $area_start ]; then
+        printf "EEPROM placement: image segment 0x%08X-0x%08X overlaps the EEPROM area 0x%08X-0x%08X\n" \
+               $start $end $area_start $area_end >&2
+        printf "Move EEPROM_SECURE_ADDR above the image and update the image size in the policy\n" >&2
+        exit 1
+    fi
+    if [ $end -gt $image_end ] && [ $end -le $area_start ]; then
+        image_end=$end
+    fi
+done < <("$readelf" -lW "$elf")
+
+printf "EEPROM placement: image ends at 0x%08X, EEPROM area 0x%08X-0x%08X, %d bytes free\n" \
+       $image_end $area_start $area_end $(( area_start - image_end ))